@@ -18,10 +18,21 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace common {
+static constexpr int32_t INVALID_NUMA_NODE = -1;
+
 uint32_t NumberOfCpuCore();
 size_t PhysicalSize();
+// Number of NUMA nodes that are online, 1 if the platform does not expose the topology.
+uint32_t NumberOfNumaNode();
+// NUMA node of the cpu the calling thread is running on, INVALID_NUMA_NODE if unknown.
+int32_t CurrentNumaNode();
+// Cpus that belong to the given NUMA node, empty if unknown.
+std::vector<uint32_t> CpusOfNumaNode(int32_t node);
+// Bind the thread with the given native thread id to the cpus, return false if not supported or failed.
+bool BindThreadToCpus(uint32_t threadId, const std::vector<uint32_t> &cpus);
 }  // namespace common
 
 #endif  // COMMON_COMPONENTS_PLATFORM_OS_H
@@ -15,9 +15,51 @@
 
 #include "common_components/platform/cpu.h"
 
+#include <cstdlib>
+#include <fstream>
+#include <sched.h>
+#include <sstream>
+#include <string>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 namespace common {
+static constexpr char NUMA_NODE_ONLINE_PATH[] = "/sys/devices/system/node/online";
+static constexpr char NUMA_NODE_PATH_PREFIX[] = "/sys/devices/system/node/node";
+
+// Parse a kernel cpu/node list such as "0-3,8,10-11".
+static std::vector<uint32_t> ParseKernelList(const std::string &list)
+{
+    std::vector<uint32_t> result;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        char *end = nullptr;
+        unsigned long first = std::strtoul(range.c_str(), &end, 10); // 10: decimal
+        unsigned long last = first;
+        if (end != nullptr && *end == '-') {
+            last = std::strtoul(end + 1, nullptr, 10); // 10: decimal
+        }
+        for (unsigned long i = first; i <= last; i++) {
+            result.emplace_back(static_cast<uint32_t>(i));
+        }
+    }
+    return result;
+}
+
+static std::string ReadFirstLine(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string line;
+    if (file.is_open()) {
+        std::getline(file, line);
+    }
+    return line;
+}
+
 uint32_t NumberOfCpuCore()
 {
     return static_cast<uint32_t>(sysconf(_SC_NPROCESSORS_ONLN));
@@ -29,5 +71,43 @@ size_t PhysicalSize()
     auto pageSize = sysconf(_SC_PAGE_SIZE);
     return pages * pageSize;
 }
+
+uint32_t NumberOfNumaNode()
+{
+    std::vector<uint32_t> nodes = ParseKernelList(ReadFirstLine(NUMA_NODE_ONLINE_PATH));
+    return nodes.empty() ? 1 : static_cast<uint32_t>(nodes.size());
+}
+
+int32_t CurrentNumaNode()
+{
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return INVALID_NUMA_NODE;
+    }
+    return static_cast<int32_t>(node);
+}
+
+std::vector<uint32_t> CpusOfNumaNode(int32_t node)
+{
+    if (node < 0) {
+        return {};
+    }
+    return ParseKernelList(ReadFirstLine(NUMA_NODE_PATH_PREFIX + std::to_string(node) + "/cpulist"));
+}
+
+bool BindThreadToCpus(uint32_t threadId, const std::vector<uint32_t> &cpus)
+{
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (uint32_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+    return sched_setaffinity(static_cast<pid_t>(threadId), sizeof(cpuset), &cpuset) == 0;
+}
 }  // namespace common
- 
\ No newline at end of file
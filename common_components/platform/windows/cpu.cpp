@@ -34,5 +34,24 @@ size_t PhysicalSize()
     DWORDLONG physSize = status.ullTotalPhys;
     return physSize;
 }
+
+uint32_t NumberOfNumaNode()
+{
+    return 1;
+}
+
+int32_t CurrentNumaNode()
+{
+    return INVALID_NUMA_NODE;
+}
+
+std::vector<uint32_t> CpusOfNumaNode([[maybe_unused]] int32_t node)
+{
+    return {};
+}
+
+bool BindThreadToCpus([[maybe_unused]] uint32_t threadId, [[maybe_unused]] const std::vector<uint32_t> &cpus)
+{
+    return false;
+}
 }  // namespace common
- 
\ No newline at end of file
@@ -15,6 +15,8 @@
 
 #include "common_components/taskpool/runner.h"
 
+#include "common_components/log/log.h"
+#include "common_components/platform/cpu.h"
 #include "libpandabase/os/thread.h"
 #ifdef ENABLE_QOS
 #include "qos.h"
@@ -119,10 +121,32 @@ void Runner::SetQosPriority([[maybe_unused]] PriorityMode mode)
 #endif
 }
 
+void Runner::SetThreadAffinity(const std::vector<uint32_t> &cpus)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    affinityCpus_ = cpus;
+    for (uint32_t threadId : gcThreadId_) {
+        BindThreadAffinity(threadId);
+    }
+}
+
+void Runner::BindThreadAffinity(uint32_t threadId)
+{
+    if (affinityCpus_.empty()) {
+        return;
+    }
+    if (!BindThreadToCpus(threadId, affinityCpus_)) {
+        LOG_COMMON(DEBUG) << "Bind gc thread " << threadId << " to cpus failed";
+    }
+}
+
 void Runner::RecordThreadId()
 {
     std::lock_guard<std::mutex> guard(mtx_);
-    gcThreadId_.emplace_back(panda::os::thread::GetCurrentThreadId());
+    uint32_t threadId = panda::os::thread::GetCurrentThreadId();
+    gcThreadId_.emplace_back(threadId);
+    // Threads started after SetThreadAffinity should follow the same placement.
+    BindThreadAffinity(threadId);
 }
 
 void Runner::SetRunTask(uint32_t threadId, Task *task)
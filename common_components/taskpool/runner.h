@@ -62,6 +62,7 @@ public:
     void PUBLIC_API TerminateThread();
     void TerminateTask(int32_t id, TaskType type);
     void SetQosPriority(PriorityMode mode);
+    void SetThreadAffinity(const std::vector<uint32_t> &cpus);
     void RecordThreadId();
 
     uint32_t GetTotalThreadNum() const
@@ -69,6 +70,12 @@ public:
         return totalThreadNum_;
     }
 
+    std::vector<uint32_t> GetThreadIds()
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        return gcThreadId_;
+    }
+
     bool IsInThreadPool(std::thread::id id)
     {
         std::lock_guard<std::mutex> guard(mtxPool_);
@@ -97,12 +104,14 @@ public:
 private:
     void Run(uint32_t threadId);
     void SetRunTask(uint32_t threadId, Task *task);
+    void BindThreadAffinity(uint32_t threadId);
 
     std::vector<std::unique_ptr<std::thread>> threadPool_ {};
     TaskQueue taskQueue_ {};
     std::array<Task*, MAX_TASKPOOL_THREAD_NUM + 1> runningTask_;
     uint32_t totalThreadNum_ {0};
     std::vector<uint32_t> gcThreadId_ {};
+    std::vector<uint32_t> affinityCpus_ {};
     std::mutex mtx_;
     std::mutex mtxPool_;
 
@@ -31,6 +31,7 @@ void Taskpool::Initialize(int threadNum,
     std::lock_guard<std::mutex> guard(mutex_);
     if (isInitialized_++ <= 0) {
         runner_ = std::make_unique<Runner>(TheMostSuitableThreadNum(threadNum), prologueHook, epilogueHook);
+        numaNode_ = INVALID_NUMA_NODE;
     }
 }
 
@@ -48,6 +49,22 @@ void Taskpool::Destroy(int32_t id)
     }
 }
 
+int32_t Taskpool::ApplyNumaPlacement()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (isInitialized_ <= 0 || numaNode_ != INVALID_NUMA_NODE) {
+        return numaNode_;
+    }
+    int32_t node = CurrentNumaNode();
+    std::vector<uint32_t> cpus = CpusOfNumaNode(node);
+    if (cpus.empty()) {
+        return INVALID_NUMA_NODE;
+    }
+    runner_->SetThreadAffinity(cpus);
+    numaNode_ = node;
+    return numaNode_;
+}
+
 void Taskpool::TerminateTask(int32_t id, TaskType type)
 {
     if (isInitialized_ <= 0) {
@@ -19,6 +19,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common_components/platform/cpu.h"
 #include "common_components/taskpool/runner.h"
 #include "base/common.h"
 
@@ -67,6 +68,16 @@ public:
         return runner_->GetTotalThreadNum();
     }
 
+    // Native ids of the worker threads which have started running so far.
+    std::vector<uint32_t> GetThreadIds()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (isInitialized_ <= 0) {
+            return {};
+        }
+        return runner_->GetThreadIds();
+    }
+
     bool IsInThreadPool(std::thread::id id) const
     {
         return runner_->IsInThreadPool(id);
@@ -77,6 +88,17 @@ public:
         runner_->SetQosPriority(mode);
     }
 
+    // Bind all worker threads to the cpus of the NUMA node of the calling thread. The binding is pool-wide, it also
+    // applies to the non-gc tasks posted here, and the workers are shared by every vm of the process, so only the
+    // first call after the runner is created places them and later callers keep that placement.
+    // Returns the node the workers are bound to, INVALID_NUMA_NODE if they are not bound.
+    int32_t ApplyNumaPlacement();
+
+    int32_t GetNumaNode() const
+    {
+        return numaNode_;
+    }
+
     void ForEachTask(const std::function<void(Task*)> &f);
 
 private:
@@ -84,6 +106,7 @@ private:
 
     std::unique_ptr<Runner> runner_;
     volatile int isInitialized_ = 0;
+    int32_t numaNode_ {INVALID_NUMA_NODE};
     std::mutex mutex_;
 };
 }  // namespace common
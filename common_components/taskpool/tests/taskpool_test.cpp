@@ -14,11 +14,13 @@
  */
 
 #include "common_components/tests/test_helper.h"
+#include "common_components/platform/cpu.h"
 #include "common_components/taskpool/taskpool.h"
 #include "common_components/taskpool/task.h"
 
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <thread>
 
 namespace common {
@@ -105,4 +107,39 @@ HWTEST_F_L0(TaskpoolTest, TerminateTask) {
 
     EXPECT_FALSE(isTerminated);
 }
-}
\ No newline at end of file
+
+HWTEST_F_L0(TaskpoolTest, ApplyNumaPlacement) {
+    // declared before the pool, so that it outlives the workers
+    std::promise<void> executed;
+    std::future<void> done = executed.get_future();
+    TaskpoolTest::ScopedTaskpool pool(2);
+    Taskpool* taskpool = pool.Get();
+    ASSERT_NE(taskpool, nullptr);
+
+    int32_t node = taskpool->ApplyNumaPlacement();
+    EXPECT_EQ(taskpool->GetNumaNode(), node);
+    // the workers are placed once, a second caller gets the same node whatever thread it runs on
+    int32_t otherNode = INVALID_NUMA_NODE;
+    std::thread other([taskpool, &otherNode]() { otherNode = taskpool->ApplyNumaPlacement(); });
+    other.join();
+    if (node != INVALID_NUMA_NODE) {
+        EXPECT_EQ(otherNode, node);
+    }
+
+    // Affinity must not stop workers from picking up tasks, whether or not binding is supported.
+    class SignalTask : public Task {
+    public:
+        SignalTask(int32_t id, std::promise<void> *promise) : Task(id), promise_(promise) {}
+        bool Run([[maybe_unused]] uint32_t threadId) override
+        {
+            promise_->set_value();
+            return true;
+        }
+    private:
+        std::promise<void> *promise_;
+    };
+    taskpool->PostTask(std::make_unique<SignalTask>(1, &executed));
+    constexpr auto MAX_WAIT = std::chrono::seconds(10);
+    EXPECT_EQ(done.wait_for(MAX_WAIT), std::future_status::ready);
+}
+}
@@ -54,8 +54,14 @@ bool BytecodePreprocessorNew::Run()
     SplitCriticalEdges();
     SetBasicBlockPointers();
     LoopAnalysis();
+    if (IsOSR() && !RedirectStartToOsrLoop()) {
+        return false;
+    }
     MakeRPO();
     ClearDeadPredecessors();
+    if (IsOSR() && !CheckOsrLoop()) {
+        return false;
+    }
     return true;
 }
 
@@ -747,6 +753,57 @@ void BytecodePreprocessorNew::ClearDeadPredecessors()
     }
 }
 
+// The OSR offset is the one of the jump back to the loop header, where the back-edge counter triggered compilation.
+// Only outermost loops are supported: entering an inner loop would leave the header of its parent loop without
+// a live entry edge.
+bool BytecodePreprocessorNew::RedirectStartToOsrLoop()
+{
+    if (osrOffset_ < 0 || static_cast<size_t>(osrOffset_) >= bcIndexOfOffset_.size() ||
+        bcIndexOfOffset_[osrOffset_] == NULL_INDEX) {
+        LOG_COMPILER(DEBUG) << "OSR offset " << osrOffset_ << " is not the start of a bytecode";
+        return false;
+    }
+    uint32_t loopBackBcIndex = bcIndexOfOffset_[osrOffset_];
+    uint32_t targetBcIndex = jumpTargetBcIndices_[loopBackBcIndex];
+    if (targetBcIndex == NULL_INDEX || targetBcIndex > loopBackBcIndex) {
+        LOG_COMPILER(DEBUG) << "OSR offset " << osrOffset_ << " is not a loop back edge";
+        return false;
+    }
+    BasicBlockInfo *header = &basicBlocks_[bytecodes_[targetBcIndex].blockIndex];
+    if (!header->IsLoopHeader()) {
+        LOG_COMPILER(DEBUG) << "OSR target BB[" << bytecodes_[targetBcIndex].blockIndex << "] is not a loop header";
+        return false;
+    }
+    if (header->loopHeaderBlock != nullptr) {
+        LOG_COMPILER(DEBUG) << "OSR into nested loops is not supported";
+        return false;
+    }
+    // The start block is synthetic and ends with the only unconditional jump to the first bytecode block.
+    BasicBlockInfo *startBlock = &basicBlocks_.front();
+    ASSERT(startBlock->IsSynthetic() && startBlock->fallthroughBlock == nullptr);
+    BasicBlockInfo *entry = BLOCK_PTR_CONST_CAST(startBlock->jumpBlock);
+    if (entry != header) {
+        auto &entryPreds = entry->jumpPredecessors;
+        entryPreds.erase(std::remove(entryPreds.begin(), entryPreds.end(), startBlock), entryPreds.end());
+        // Only the loop-back block has to stay the last, predecessors are sorted by RPO later
+        header->jumpPredecessors.insert(header->jumpPredecessors.begin(), startBlock);
+        startBlock->jumpBlock = header;
+    }
+    osrLoopHeaderIndex_ = static_cast<uint32_t>(header - basicBlocks_.data());
+    return true;
+}
+
+bool BytecodePreprocessorNew::CheckOsrLoop() const
+{
+    const BasicBlockInfo *header = &basicBlocks_[osrLoopHeaderIndex_];
+    // The original loop entry must be dead, otherwise the header would have a third predecessor.
+    if (header->jumpPredecessors.size() != 2 || header->jumpPredecessors.front() != &basicBlocks_.front()) {
+        LOG_COMPILER(DEBUG) << "Code before the OSR loop is still reachable";
+        return false;
+    }
+    return true;
+}
+
 namespace {
 struct PrintIndex {
     uint32_t index_;
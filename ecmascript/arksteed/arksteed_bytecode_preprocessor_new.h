@@ -19,6 +19,7 @@
 #include "ecmascript/arksteed/arksteed_vreg.h"
 #include "ecmascript/compiler/jit_compilation_env.h"
 #include "ecmascript/jspandafile/method_literal.h"
+#include "ecmascript/mem/machine_code.h"
 #include "ecmascript/mem/chunk_containers.h"
 
 namespace panda::ecmascript::arksteed {
@@ -90,6 +91,18 @@ public:
 
     bool Run();
 
+    // Compiles for on-stack replacement at the loop whose back edge is the jump at osrOffset (in bytes).
+    // The start block then jumps straight to the loop header, and code before the loop is dead.
+    void SetOsrOffset(int32_t osrOffset)
+    {
+        osrOffset_ = osrOffset;
+    }
+
+    bool IsOSR() const
+    {
+        return osrOffset_ != MachineCode::INVALID_OSR_OFFSET;
+    }
+
     uint32_t GetNumLiveBasicBlocks() const
     {
         return static_cast<uint32_t>(rpoList_.size());
@@ -163,6 +176,8 @@ private:
     void LoopAnalysis();
     void MakeRPO();
     void ClearDeadPredecessors();
+    bool RedirectStartToOsrLoop();
+    bool CheckOsrLoop() const;
 
     std::string DumpBasicBlocksString() const;
     std::string DumpTryBlocksString() const;
@@ -171,6 +186,8 @@ private:
 
     JitCompilationEnv *env_;
     MethodLiteral *method_;
+    int32_t osrOffset_ {MachineCode::INVALID_OSR_OFFSET};
+    uint32_t osrLoopHeaderIndex_ {NULL_INDEX};
 
     VRegIDType numLocalVRegs_;
     VRegIDType numParamVRegs_;
@@ -354,6 +354,16 @@ void ArkSteedCodeGenerator::VisitNonControlVertex<ActualArgcVertex>(ActualArgcVe
     assembler_->LoadActualArgc(dst);
 }
 
+template <>
+void ArkSteedCodeGenerator::VisitNonControlVertex<OsrFrameVertex>(OsrFrameVertex *osrFrame)
+{
+#ifndef NDEBUG
+    LOG_COMPILER(DEBUG) << "CodeGen: Visiting v" << osrFrame->GetId() << ": OsrFrameVertex [no-op]";
+#endif
+    // The prologue leaves the parameter registers untouched, so the sp is still where the OSR entry received it.
+    ASSERT(GetResultRegister(osrFrame).Code() == ArkSteedAssembler::GetParameterRegister(0).Code());
+}
+
 // ========================================= Slow Value Opcode =========================================
 
 template <>
@@ -121,6 +121,7 @@ bool ArkSteedCompilerTask::BuildGraph(JSThread *compilerThread, uintptr_t hostGl
     (void)compilerThread;  // Unused
 
     BytecodePreprocessorNew preproc(jitCompilationEnv_.get(), chunk_.get());
+    preproc.SetOsrOffset(offset_);
     if (!preproc.Run()) {
         return false;
     }
@@ -133,6 +134,10 @@ bool ArkSteedCompilerTask::BuildGraph(JSThread *compilerThread, uintptr_t hostGl
         return false;
     }
 #else
+    if (offset_ != MachineCode::INVALID_OSR_OFFSET) {
+        LOG_COMPILER(DEBUG) << "OSR is only supported by the refactored ArkSteed graph builder";
+        return false;
+    }
     ArkSteedGraphBuilder graphBuilder(compilerThread, hostGlueAddr, graph_, jitCompilationEnv_.get());
     if (!graphBuilder.Build()) {
         return false;
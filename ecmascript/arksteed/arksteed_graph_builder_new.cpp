@@ -15,6 +15,7 @@
 
 #include "ecmascript/arksteed/arksteed_graph_builder_new.h"
 #include "ecmascript/arksteed/arksteed_framestate.h"
+#include "ecmascript/frames.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/lexical_env.h"
 
@@ -236,6 +237,10 @@ void GraphBuilderNew::InitializeGlobalsAndParameters()
 
 void GraphBuilderNew::FinalizeStartBasicBlock(BCFrameState &frameState)
 {
+    if (preproc_->IsOSR()) {
+        FinalizeOsrStartBasicBlock(frameState);
+        return;
+    }
     for (VRegIDType i = 0, n = GetNumParamVRegs(); i < n; i++) {
         VRegIDType curIndex = VRegOfParam(GetNumLocalVRegs(), i).GetId();
         frameState.Set(curIndex, graph_->GetParameter(i));
@@ -245,6 +250,49 @@ void GraphBuilderNew::FinalizeStartBasicBlock(BCFrameState &frameState)
     NewControlVertex<JumpVertex>(blocks_[0], {}, blocks_[1]);
 }
 
+// The OSR entry is called like the function itself, with the sp of the interpreted or baseline frame added in the
+// first parameter register. The start block jumps straight to the OSR loop header, so everything live there is
+// loaded from that frame: vregs from the sp, env and acc from the AsmInterpretedFrame right below it.
+// The interpreted frame holds CallTarget, NewTarget and This only if the method uses them; otherwise the values
+// passed to the OSR entry are used.
+void GraphBuilderNew::FinalizeOsrStartBasicBlock(BCFrameState &frameState)
+{
+    BB *start = blocks_[0];
+    ValueVertex *sp = NewVertexNoInput<OsrFrameVertex>(start);
+    // 1 : The OSR loop header follows the start block
+    const kungfu::BitSet &liveIn = analysis_->GetLiveIn(1);
+    auto loadVReg = [this, start, sp](uint32_t frameSlot) -> ValueVertex * {
+        return NewVertex<LoadFromAddressVertex>(start, {sp}, static_cast<int32_t>(frameSlot * sizeof(JSTaggedType)));
+    };
+    auto loadFrameField = [this, start, sp](size_t fieldOffset) -> ValueVertex * {
+        int32_t frameSize = static_cast<int32_t>(AsmInterpretedFrame::GetSize(false));
+        return NewVertex<LoadFromAddressVertex>(start, {sp}, static_cast<int32_t>(fieldOffset) - frameSize);
+    };
+
+    for (VRegIDType i = 0, n = GetNumLocalVRegs(); i < n; i++) {
+        if (liveIn.TestBit(i)) {
+            frameState.Set(i, loadVReg(i));
+        }
+    }
+    MethodLiteral *method = preproc_->GetMethod();
+    const bool haveFixedParam[FIXED_PARAM_VREG_COUNT] = {
+        method->HaveFuncWithCallField(), method->HaveNewTargetWithCallField(), method->HaveThisWithCallField()};
+    uint32_t frameSlot = GetNumLocalVRegs();
+    for (VRegIDType i = 0, n = GetNumParamVRegs(); i < n; i++) {
+        bool inFrame = i >= FIXED_PARAM_VREG_COUNT || haveFixedParam[i];
+        uint32_t curSlot = inFrame ? frameSlot++ : 0;
+        VRegIDType curIndex = VRegOfParam(GetNumLocalVRegs(), i).GetId();
+        if (liveIn.TestBit(curIndex)) {
+            frameState.Set(curIndex, inFrame ? loadVReg(curSlot) : graph_->GetParameter(i));
+        }
+    }
+    frameState.SetEnv(loadFrameField(AsmInterpretedFrame::GetEnvOffset(false)));
+    if (liveIn.TestBit(VRegOfAcc(GetNumLocalVRegs(), GetNumParamVRegs()).GetId())) {
+        frameState.SetAcc(loadFrameField(AsmInterpretedFrame::GetAccOffset(false)));
+    }
+    NewControlVertex<JumpVertex>(start, {}, blocks_[1]);
+}
+
 void GraphBuilderNew::FinalizeBasicBlockRelations()
 {
     uint32_t n = preproc_->GetNumLiveBasicBlocks();
@@ -67,6 +67,7 @@ private:
     void InitializeBasicBlocks();
     void InitializeGlobalsAndParameters();
     void FinalizeStartBasicBlock(BCFrameState &frameState);
+    void FinalizeOsrStartBasicBlock(BCFrameState &frameState);
     void ProcessBasicBlock(BCFrameState &frameState, uint32_t rpoIndex);
     void ProcessCatchBlockHead(BCFrameState &frameState, uint32_t rpoIndex);
     void VisitBytecode(uint32_t rpoIndex, BCFrameState *frameState, const BytecodeInfo *bcInfo);
@@ -217,6 +217,17 @@ void ActualArgcVertex::Dump(std::ostream &output) const
     output << "  ActualArgc";
 }
 
+void OsrFrameVertex::SetValueLocationConstraints()
+{
+    // The OSR entry receives the sp in the first parameter register, and nothing runs before this vertex
+    DefineAsFixed(this, static_cast<uint32_t>(ArkSteedAssembler::GetParameterRegister(0).Code()));
+}
+
+void OsrFrameVertex::Dump(std::ostream &output) const
+{
+    output << "  OsrFrame";
+}
+
 void CallRuntimeVertex::SetValueLocationConstraints()
 {
     // Define return value in x0/rax (C calling convention)
@@ -379,6 +379,18 @@ public:
     void Dump(std::ostream &output) const;
 };
 
+// Sp of the interpreted or baseline frame that an OSR entry continues, i.e. the address of its first vreg.
+// Both kinds of frames are AsmInterpretedFrame, so the vregs and the frame fields are found the same way.
+class OsrFrameVertex : public FixedInputVertexMixin<0, ValueVertex, OsrFrameVertex> {
+public:
+    static constexpr VertexProperties PROPERTIES = VertexProperties::IntPtr();
+
+    explicit OsrFrameVertex(uint64_t bitfield) : FixedInputVertexMixin(bitfield) {}
+
+    void SetValueLocationConstraints();
+    void Dump(std::ostream &output) const;
+};
+
 // Loads from raw pointer
 class LoadFromAddressVertex : public FixedInputVertexMixin<1, ValueVertex, LoadFromAddressVertex> {
 public:
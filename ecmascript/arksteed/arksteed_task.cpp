@@ -99,7 +99,13 @@ void ArkSteedTask::InstallCode()
         JSFunction::SetProfileTypeInfo(hostThread, jsFunction, undefinedValue);
     }
 
-    InstallCodeByCompilerTier(machineCodeObj, methodHandle);
+    machineCodeObj->SetOSROffset(GetOffset());
+    if (IsOsrTask()) {
+        // Installed into the OSR code list of the profile, the function keeps its current entry
+        InstallOsrCode(machineCodeObj);
+    } else {
+        InstallCodeByCompilerTier(machineCodeObj, methodHandle);
+    }
 
     uintptr_t codeAddr = machineCodeObj->GetFuncAddr();
     uintptr_t codeAddrEnd = codeAddr + machineCodeObj->GetInstructionsSize();
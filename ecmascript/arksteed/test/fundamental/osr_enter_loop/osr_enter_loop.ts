@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+function osr_enter_loop(n) {
+    let sum = 0;
+    let compiled = false;
+    for (let i = 0; i < n; i++) {
+        sum += i & 7;
+        // Only true once the back edge has jumped into the OSR code
+        compiled = compiled || ArkTools.isInFastJit();
+    }
+    print(compiled);
+    print(sum);
+}
+
+// Called once, so compiled code can only be reached through the OSR entry of the loop
+osr_enter_loop(1000000);
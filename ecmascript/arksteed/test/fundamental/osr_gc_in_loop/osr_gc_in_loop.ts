@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+function osr_gc_in_loop(n) {
+    let head = {value: -1};
+    let keep = [];
+    let sum = 0;
+    let gcs = 0;
+    let compiled = false;
+    for (let i = 0; i < n; i++) {
+        let obj = {value: i};
+        sum += obj.value & 7;
+        if ((i & 1023) === 0) {
+            keep.push(obj);
+        }
+        compiled = compiled || ArkTools.isInFastJit();
+        // Collect from the OSR code, with objects live in its frame and in the interpreted frame below it
+        if (compiled && gcs < 3) {
+            ArkTools.forceFullGC();
+            gcs++;
+        }
+    }
+    let kept = 0;
+    for (let j = 0; j < keep.length; j++) {
+        kept += keep[j].value;
+    }
+    print(compiled);
+    print(gcs);
+    print(sum);
+    print(head.value);
+    print(keep.length);
+    print(kept);
+}
+
+// The back edge of a do-while loop is a conditional jump
+function osr_gc_in_do_while(n) {
+    let keep = [];
+    let i = 0;
+    let gcs = 0;
+    let compiled = false;
+    do {
+        keep.push({value: i & 7});
+        if (keep.length > 1000) {
+            keep = [keep[1000]];
+        }
+        compiled = compiled || ArkTools.isInFastJit();
+        if (compiled && gcs < 3) {
+            ArkTools.forceFullGC();
+            gcs++;
+        }
+        i++;
+    } while (i < n);
+    print(compiled);
+    print(gcs);
+    print(keep.length);
+    print(keep[keep.length - 1].value);
+}
+
+// Called once, so compiled code can only be reached through the OSR entry of the loops
+osr_gc_in_loop(1000000);
+osr_gc_in_do_while(1000000);
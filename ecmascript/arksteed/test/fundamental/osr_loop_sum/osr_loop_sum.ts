@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+function osr_loop_sum(n) {
+    let before = n * 2;
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        sum += i & 7;
+    }
+    let after = sum + before;
+    print(sum);
+    print(after);
+}
+
+function osr_nested_loop(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        for (let j = 0; j < 10; j++) {
+            sum += j;
+        }
+    }
+    print(sum);
+}
+
+// Called once, so the loops are only compiled at their back edges
+osr_loop_sum(20000);
+osr_nested_loop(2000);
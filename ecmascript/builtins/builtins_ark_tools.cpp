@@ -19,6 +19,7 @@
 #include "ecmascript/builtins/builtins_regexp.h"
 #include "ecmascript/dependent_infos.h"
 #include "ecmascript/dfx/stackinfo/js_stackinfo.h"
+#include "ecmascript/dfx/vmstat/ic_profiler.h"
 #include "ecmascript/dfx/vmstat/opt_code_profiler.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/mem/verification.h"
@@ -706,6 +707,20 @@ JSTaggedValue BuiltinsArkTools::ClearTypedOpProfiler(EcmaRuntimeCallInfo *info)
     return JSTaggedValue::Undefined();
 }
 
+JSTaggedValue BuiltinsArkTools::PrintICProfiler(EcmaRuntimeCallInfo *info)
+{
+    ASSERT(info);
+    JSThread *thread = info->GetThread();
+    RETURN_IF_DISALLOW_ARKTOOLS(thread);
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+
+    ICProfiler *profiler = thread->GetEcmaVM()->GetICProfiler();
+    if (profiler != nullptr) {
+        profiler->PrintAndReset();
+    }
+    return JSTaggedValue::Undefined();
+}
+
 JSTaggedValue BuiltinsArkTools::GetAPIVersion(EcmaRuntimeCallInfo *info)
 {
     ASSERT(info);
@@ -75,6 +75,7 @@
     V("isAOTDeoptimized",               IsAOTDeoptimized,               1, INVALID)       \
     V("printTypedOpProfiler",           PrintTypedOpProfiler,           1, INVALID)       \
     V("clearTypedOpProfiler",           ClearTypedOpProfiler,           0, INVALID)       \
+    V("printICProfiler",                PrintICProfiler,                0, INVALID)       \
     V("isOnHeap",                       IsOnHeap,                       1, INVALID)       \
     V("checkDeoptStatus",               CheckDeoptStatus,               2, INVALID)       \
     V("checkCircularImport",            CheckCircularImport,            2, INVALID)       \
@@ -325,6 +326,9 @@ public:
 
     static JSTaggedValue ClearTypedOpProfiler(EcmaRuntimeCallInfo *info);
 
+    // ArkTools.printICProfiler(), logs the ic report of --enable-ic-profiler and starts a new one
+    static JSTaggedValue PrintICProfiler(EcmaRuntimeCallInfo *info);
+
     static JSTaggedValue IsRegExpReplaceDetectorValid(EcmaRuntimeCallInfo *info);
 
     static JSTaggedValue IsRegExpFlagsDetectorValid(EcmaRuntimeCallInfo *info);
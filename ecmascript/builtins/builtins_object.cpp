@@ -626,6 +626,12 @@ JSTaggedValue BuiltinsObject::Keys(EcmaRuntimeCallInfo *argv)
     // 2. ReturnIfAbrupt(obj).
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
 
+    // objects of one hclass share their keys, the result copies them only once it is written to
+    JSTaggedValue snapshot = JSObject::GetEnumKeysSnapshot(thread, obj);
+    if (!snapshot.IsUndefined()) {
+        return JSArray::CreateArrayFromList(thread, JSHandle<TaggedArray>(thread, snapshot)).GetTaggedValue();
+    }
+
     // 3. Let nameList be EnumerableOwnNames(obj).
     JSHandle<TaggedArray> nameList = JSObject::EnumerableOwnNames(thread, obj);
 
@@ -390,8 +390,6 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
 {
     auto ecmaVm = thread->GetEcmaVM();
     BUILTINS_API_TRACE(thread, Promise, PerformPromiseThen);
-    JSHandle<job::MicroJobQueue> job = ecmaVm->GetMicroJobQueue();
-    JSHandle<GlobalEnv> env = ecmaVm->GetGlobalEnv();
     ObjectFactory *factory = ecmaVm->GetFactory();
     JSMutableHandle<JSTaggedValue> fulfilled(thread, onFulfilled.GetTaggedValue());
     auto globalConst = thread->GlobalConstants();
@@ -421,24 +419,17 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
         newQueue = TaggedQueue::Push(thread, rejectReactions, JSHandle<JSTaggedValue>::Cast(rejectReaction));
         promise->SetPromiseRejectReactions(thread, JSTaggedValue(newQueue));
     } else if (state == PromiseState::FULFILLED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, fulfillReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult(thread));
-
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, fulfillReaction.GetTaggedValue(),
+                                                      promise->GetPromiseResult(thread));
     } else if (state == PromiseState::REJECTED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, rejectReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult(thread));
         // When a handler is added to a rejected promise for the first time, it is called with its operation
         // argument set to "handle".
         if (!promise->GetPromiseIsHandled()) {
             JSHandle<JSTaggedValue> reason(thread, JSTaggedValue::Null());
             ecmaVm->PromiseRejectionTracker(promise, reason, PromiseRejectionEvent::HANDLE);
         }
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, rejectReaction.GetTaggedValue(),
+                                                      promise->GetPromiseResult(thread));
     }
     promise->SetPromiseIsHandled(true);
     if (promiseOrCapability->IsUndefined()) {
@@ -510,8 +501,6 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
 {
     auto ecmaVm = thread->GetEcmaVM();
     BUILTINS_API_TRACE(thread, Promise, PerformPromiseThen);
-    JSHandle<job::MicroJobQueue> job = ecmaVm->GetMicroJobQueue();
-    JSHandle<GlobalEnv> env = ecmaVm->GetGlobalEnv();
     ObjectFactory *factory = ecmaVm->GetFactory();
     JSMutableHandle<JSTaggedValue> fulfilled(thread, onFulfilled.GetTaggedValue());
     auto globalConst = thread->GlobalConstants();
@@ -541,24 +530,17 @@ JSTaggedValue BuiltinsPromise::PerformPromiseThen(JSThread *thread, const JSHand
         newQueue = TaggedQueue::Push(thread, rejectReactions, JSHandle<JSTaggedValue>::Cast(rejectReaction));
         promise->SetPromiseRejectReactions(thread, JSTaggedValue(newQueue));
     } else if (state == PromiseState::FULFILLED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, fulfillReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult(thread));
-
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, fulfillReaction.GetTaggedValue(),
+                                                      promise->GetPromiseResult(thread));
     } else if (state == PromiseState::REJECTED) {
-        JSHandle<TaggedArray> argv = factory->NewTaggedArray(2);  // 2: 2 means two args stored in array
-        argv->Set(thread, 0, rejectReaction.GetTaggedValue());
-        argv->Set(thread, 1, promise->GetPromiseResult(thread));
         // When a handler is added to a rejected promise for the first time, it is called with its operation
         // argument set to "handle".
         if (!promise->GetPromiseIsHandled()) {
             JSHandle<JSTaggedValue> reason(thread, JSTaggedValue::Null());
             ecmaVm->PromiseRejectionTracker(promise, reason, PromiseRejectionEvent::HANDLE);
         }
-        JSHandle<JSFunction> promiseReactionsJob(env->GetPromiseReactionJob());
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, argv);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, rejectReaction.GetTaggedValue(),
+                                                      promise->GetPromiseResult(thread));
     }
     promise->SetPromiseIsHandled(true);
     return capability->GetPromise(thread);
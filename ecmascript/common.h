@@ -73,7 +73,8 @@ namespace ecmascript {
     FULL_RECORD_DATA(V)                  \
     SHARED_RECORD_DATA(V)                \
     SWEEP_RECORD_DATA(V)                 \
-    LOCAL_CC_RECORD_DATA(V)
+    LOCAL_CC_RECORD_DATA(V)              \
+    MEMORY_COUNTER_RECORD_DATA(V)
 
 #define RECORD_DURATION(V)               \
     V(SEMI_MIN_PAUSE)                    \
@@ -147,6 +148,12 @@ namespace ecmascript {
     V(SWEEP_COMMIT_SIZE)                 \
     V(SWEEP_TOTAL_COMMIT)
 
+#define MEMORY_COUNTER_RECORD_DATA(V)    \
+    V(GC_PAGE_FAULTS)                    \
+    V(GC_TOTAL_PAGE_FAULTS)              \
+    V(GC_DTLB_MISSES)                    \
+    V(GC_TOTAL_DTLB_MISSES)
+
 #define TRACE_GC_SPEED(V)                \
     V(UPDATE_REFERENCE_SPEED)            \
     V(OLD_CLEAR_NATIVE_OBJ_SPEED)        \
@@ -1018,4 +1018,36 @@ GateRef AccessObjectStubBuilder::LdObjByIndex(GateRef glue, GateRef receiver, Ga
     env->SubCfgExit();
     return ret;
 }
+
+GateRef AccessObjectStubBuilder::IsIn(GateRef glue, GateRef prop, GateRef obj, GateRef profileTypeInfo,
+                                      GateRef slotId)
+{
+    auto env = GetEnvironment();
+    Label entry(env);
+    env->SubCfgEntry(&entry);
+    Label exit(env);
+    Label tryFastPath(env);
+    Label slowPath(env);
+
+    DEFVARIABLE(result, VariableType::JS_ANY(), Hole());
+    GateRef value = 0;
+    ICStubBuilder builder(this);
+    PropagateGlobalEnvTo(&builder);
+    builder.SetParameters(glue, obj, profileTypeInfo, value, slotId, prop);
+    builder.IsInIC(&result, &tryFastPath, &slowPath, &exit);
+    Bind(&tryFastPath);
+    {
+        result = StubBuilder::IsIn(glue, prop, obj);
+        Jump(&exit);
+    }
+    Bind(&slowPath);
+    {
+        result = CallRuntime(glue, RTSTUB_ID(IsInIC), { profileTypeInfo, prop, obj, IntToTaggedInt(slotId) });
+        Jump(&exit);
+    }
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
 }  // namespace panda::ecmascript::kungfu
@@ -81,6 +81,7 @@ public:
     GateRef StOwnByNameWithNameSet(GateRef glue, GateRef receiver, GateRef key, GateRef value);
     GateRef StObjByIndex(GateRef glue, GateRef receiver, GateRef index, GateRef value);
     GateRef LdObjByIndex(GateRef glue, GateRef receiver, GateRef index);
+    GateRef IsIn(GateRef glue, GateRef prop, GateRef obj, GateRef profileTypeInfo, GateRef slotId);
 
 private:
 #if !ECMASCRIPT_ENABLE_NOT_FOUND_IC_CHECK
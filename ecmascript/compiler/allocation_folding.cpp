@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/allocation_folding.h"
+
+namespace panda::ecmascript::kungfu {
+void AllocationFolding::Run()
+{
+    std::vector<GateRef> gateList;
+    circuit_->GetAllGates(gateList);
+    for (auto gate : gateList) {
+        Region region;
+        if (!MatchRegion(gate, region)) {
+            continue;
+        }
+        regions_.emplace_back(region);
+        size_t size = 0;
+        if (TryGetConstantSize(acc_.GetValueIn(region.alloc, 1), size)) {  // 1: size
+            regionSize_[region.finish] = size;
+        }
+    }
+    if (regions_.empty()) {
+        return;
+    }
+    for (const auto &region : regions_) {
+        SinkStores(region);
+        EliminateOverwrittenStores(region);
+    }
+    for (const auto &region : regions_) {
+        // regions folded into a predecessor no longer own their HEAP_ALLOC
+        if (acc_.GetValueIn(region.finish, 0) == region.alloc) {
+            FoldGroup(region);
+        }
+    }
+    if (enableLog_) {
+        PrintLog();
+    }
+}
+
+bool AllocationFolding::MatchRegion(GateRef finish, Region &region) const
+{
+    if (acc_.GetOpCode(finish) != OpCode::FINISH_ALLOCATE) {
+        return false;
+    }
+    GateRef alloc = acc_.GetValueIn(finish, 0);
+    if (acc_.GetOpCode(alloc) != OpCode::HEAP_ALLOC) {
+        return false;
+    }
+    GateRef cur = acc_.GetDep(finish);
+    while (acc_.GetOpCode(cur) != OpCode::START_ALLOCATE) {
+        if (cur != alloc && !IsSafepointFree(cur)) {
+            return false;
+        }
+        if (cur == alloc && (acc_.GetStateCount(cur) != 0 || acc_.GetDependCount(cur) != 1)) {
+            return false;
+        }
+        cur = acc_.GetDep(cur);
+    }
+    if (acc_.GetDep(alloc) != cur) {
+        return false;
+    }
+    region.start = cur;
+    region.alloc = alloc;
+    region.finish = finish;
+    return true;
+}
+
+bool AllocationFolding::TryGetConstantSize(GateRef size, size_t &value, size_t depth) const
+{
+    // sizes of tagged arrays are built as DATA_OFFSET + length * slot size and may not be folded yet
+    static constexpr size_t MAX_SIZE_EXPRESSION_DEPTH = 2;
+    switch (acc_.GetOpCode(size)) {
+        case OpCode::CONSTANT:
+            value = static_cast<size_t>(acc_.GetConstantValue(size));
+            return true;
+        case OpCode::ADD:
+        case OpCode::MUL: {
+            size_t left = 0;
+            size_t right = 0;
+            if (depth >= MAX_SIZE_EXPRESSION_DEPTH ||
+                !TryGetConstantSize(acc_.GetValueIn(size, 0), left, depth + 1) ||
+                !TryGetConstantSize(acc_.GetValueIn(size, 1), right, depth + 1)) {
+                return false;
+            }
+            value = acc_.GetOpCode(size) == OpCode::ADD ? left + right : left * right;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool AllocationFolding::IsFoldableAlloc(GateRef alloc) const
+{
+    // old and shared space allocations always go through the runtime, there is no bump to save
+    if (static_cast<int64_t>(acc_.TryGetValue(alloc)) != RegionSpaceFlag::IN_YOUNG_SPACE) {
+        return false;
+    }
+    size_t size = 0;
+    return TryGetConstantSize(acc_.GetValueIn(alloc, 1), size) && size <= MAX_FOLDED_SIZE;  // 1: size
+}
+
+GateRef AllocationFolding::GetSingleDependUse(GateRef gate)
+{
+    GateRef result = Circuit::NullGate();
+    auto uses = acc_.Uses(gate);
+    for (auto it = uses.begin(); it != uses.end(); it++) {
+        if (!acc_.IsDependIn(it)) {
+            continue;
+        }
+        if (result != Circuit::NullGate()) {
+            return Circuit::NullGate();
+        }
+        result = *it;
+    }
+    return result;
+}
+
+bool AllocationFolding::IsSafepointFree(GateRef gate) const
+{
+    // A folded group reserves the memory of all its objects at once. A gc at a safepoint inside the group would
+    // find objects which are allocated but not initialized yet, so only memory accesses may sit in between.
+    if (acc_.GetStateCount(gate) != 0 || acc_.GetDependCount(gate) != 1) {
+        return false;
+    }
+    switch (acc_.GetOpCode(gate)) {
+        case OpCode::LOAD:
+        case OpCode::LOAD_WITHOUT_BARRIER:
+        case OpCode::STORE:
+        case OpCode::STORE_WITHOUT_BARRIER:
+        case OpCode::START_ALLOCATE:
+        case OpCode::FINISH_ALLOCATE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool AllocationFolding::IsPlainStore(GateRef gate) const
+{
+    // write barriers are calls to no-gc stubs, so a plain store never reaches a safepoint
+    OpCode op = acc_.GetOpCode(gate);
+    return (op == OpCode::STORE || op == OpCode::STORE_WITHOUT_BARRIER) &&
+           acc_.GetStateCount(gate) == 0 && acc_.GetDependCount(gate) == 1;
+}
+
+bool AllocationFolding::DependsOn(GateRef gate, GateRef target, size_t depth) const
+{
+    if (gate == target) {
+        return true;
+    }
+    // gates pinned to the chain are scheduled before the stores we look at
+    if (acc_.GetStateCount(gate) != 0 || acc_.GetDependCount(gate) != 0) {
+        return false;
+    }
+    size_t numValueIn = acc_.GetNumValueIn(gate);
+    if (numValueIn == 0) {
+        return false;
+    }
+    if (depth == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < numValueIn; i++) {
+        if (DependsOn(acc_.GetValueIn(gate, i), target, depth - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AllocationFolding::SinkStores(const Region &region)
+{
+    // Moves `obj.x = v` right after the region into the region, where it becomes an initializing store. Its value
+    // must be available before the object is finished, so stores of values computed from the object stay put.
+    GateRef cur = GetSingleDependUse(region.finish);
+    while (cur != Circuit::NullGate() && acc_.GetOpCode(cur) == OpCode::STORE && IsPlainStore(cur) &&
+           acc_.GetValueIn(cur, 1) == region.finish) {  // 1: base
+        size_t numValueIn = acc_.GetNumValueIn(cur);
+        bool movable = true;
+        for (size_t i = 0; i < numValueIn && movable; i++) {
+            movable = (i == 1) || !DependsOn(acc_.GetValueIn(cur, i), region.finish, MAX_VALUE_SEARCH_DEPTH);
+        }
+        if (!movable) {
+            break;
+        }
+        GateRef next = GetSingleDependUse(cur);
+        auto uses = acc_.Uses(cur);
+        for (auto it = uses.begin(); it != uses.end();) {
+            it = acc_.ReplaceIn(it, region.finish);
+        }
+        acc_.ReplaceDependIn(cur, acc_.GetDep(region.finish));
+        acc_.ReplaceDependIn(region.finish, cur);
+        acc_.ReplaceValueIn(cur, region.alloc, 1);  // 1: base
+        sunkStoreCount_++;
+        cur = next;
+    }
+}
+
+void AllocationFolding::EliminateOverwrittenStores(const Region &region)
+{
+    ChunkVector<GateRef> stores(chunk_);
+    for (GateRef cur = acc_.GetDep(region.finish); cur != region.alloc; cur = acc_.GetDep(cur)) {
+        stores.emplace_back(cur);
+    }
+    // stores are visited from the last one, an offset is recorded once a full slot is written there
+    ChunkSet<uint64_t> written(chunk_);
+    for (auto store : stores) {
+        if (acc_.GetOpCode(store) != OpCode::STORE || acc_.GetValueIn(store, 1) != region.alloc) {  // 1: base
+            written.clear();
+            continue;
+        }
+        GateRef offset = acc_.GetValueIn(store, 2);  // 2: offset
+        if (acc_.GetOpCode(offset) != OpCode::CONSTANT) {
+            written.clear();
+            continue;
+        }
+        uint64_t offsetValue = acc_.GetConstantValue(offset);
+        // the hclass word is written with its own barrier and ordering constraints
+        if (offsetValue == 0) {
+            continue;
+        }
+        if (written.count(offsetValue) != 0) {
+            acc_.ReplaceGate(store, Circuit::NullGate(), acc_.GetDep(store), Circuit::NullGate());
+            eliminatedStoreCount_++;
+            continue;
+        }
+        if (acc_.GetMachineType(acc_.GetValueIn(store, 3)) == MachineType::I64) {  // 3: value
+            written.insert(offsetValue);
+        }
+    }
+}
+
+bool AllocationFolding::FindNextRegion(GateRef finish, Region &next)
+{
+    GateRef cur = GetSingleDependUse(finish);
+    for (size_t count = 0; cur != Circuit::NullGate() && IsPlainStore(cur); count++) {
+        if (count >= MAX_STORES_BETWEEN_REGIONS) {
+            return false;
+        }
+        cur = GetSingleDependUse(cur);
+    }
+    if (cur == Circuit::NullGate() || acc_.GetOpCode(cur) != OpCode::START_ALLOCATE) {
+        return false;
+    }
+    GateRef alloc = GetSingleDependUse(cur);
+    if (alloc == Circuit::NullGate() || acc_.GetOpCode(alloc) != OpCode::HEAP_ALLOC) {
+        return false;
+    }
+    cur = alloc;
+    while (cur != Circuit::NullGate() && acc_.GetOpCode(cur) != OpCode::FINISH_ALLOCATE) {
+        cur = GetSingleDependUse(cur);
+    }
+    return cur != Circuit::NullGate() && MatchRegion(cur, next) && next.alloc == alloc;
+}
+
+void AllocationFolding::FoldGroup(const Region &head)
+{
+    GateRef rootAlloc = head.alloc;
+    if (!IsFoldableAlloc(rootAlloc)) {
+        return;
+    }
+    GateRef glue = acc_.GetValueIn(rootAlloc, 0);
+    auto tailIt = groupTail_.find(rootAlloc);
+    GateRef tail = tailIt != groupTail_.end() ? tailIt->second : head.finish;
+    Region next;
+    while (FindNextRegion(tail, next) && IsFoldableAlloc(next.alloc) && acc_.GetValueIn(next.alloc, 0) == glue) {
+        size_t rootSize = 0;
+        size_t nextSize = 0;
+        TryGetConstantSize(acc_.GetValueIn(rootAlloc, 1), rootSize);  // 1: size
+        TryGetConstantSize(acc_.GetValueIn(next.alloc, 1), nextSize);  // 1: size
+        if (rootSize + nextSize > MAX_FOLDED_SIZE) {
+            break;
+        }
+        auto nextTailIt = groupTail_.find(next.alloc);
+        GateRef nextTail = nextTailIt != groupTail_.end() ? nextTailIt->second : next.finish;
+        if (nextTailIt != groupTail_.end()) {
+            groupTail_.erase(nextTailIt);
+        }
+        acc_.ReplaceValueIn(rootAlloc, builder_.IntPtr(rootSize + nextSize), 1);  // 1: size
+        Fold(tail, next);
+        tail = nextTail;
+    }
+    groupTail_[rootAlloc] = tail;
+    ASSERT(VerifyFoldedGroup(rootAlloc, tail));
+}
+
+void AllocationFolding::Fold(GateRef tailFinish, const Region &next)
+{
+    ASSERT(regionSize_.find(tailFinish) != regionSize_.end());
+    size_t tailSize = regionSize_[tailFinish];
+    // The object is addressed from the end of its predecessor. A pointer add on a tagged value would make it a
+    // pointer derived from the predecessor, which is wrong once the gc moves the two objects independently, so the
+    // address goes through an integer and comes back as a new tagged base.
+    GateRef tailAddr = builder_.ChangeTaggedPointerToInt64(tailFinish);
+    GateRef addr = builder_.Int64Add(tailAddr, builder_.Int64(tailSize));
+    GateRef object = builder_.Int64ToTaggedPtr(addr);
+    acc_.ReplaceGate(next.alloc, Circuit::NullGate(), acc_.GetDep(next.alloc), object);
+    foldedCount_++;
+}
+
+bool AllocationFolding::VerifyFoldedGroup(GateRef rootAlloc, GateRef tailFinish) const
+{
+    for (GateRef cur = tailFinish; cur != rootAlloc; cur = acc_.GetDep(cur)) {
+        if (!IsSafepointFree(cur)) {
+            LOG_COMPILER(ERROR) << "gate " << acc_.GetId(cur) << " in the folded allocations of " << methodName_
+                                << " may reach a safepoint";
+            return false;
+        }
+    }
+    return true;
+}
+
+void AllocationFolding::PrintLog() const
+{
+    LOG_COMPILER(INFO) << "";
+    LOG_COMPILER(INFO) << "\033[34m"
+                       << "===================="
+                       << " After Allocation Folding "
+                       << "[" << methodName_ << "]"
+                       << "===================="
+                       << "\033[0m";
+    LOG_COMPILER(INFO) << "folded allocations: " << foldedCount_ << ", sunk stores: " << sunkStoreCount_
+                       << ", eliminated stores: " << eliminatedStoreCount_;
+    circuit_->PrintAllGatesWithBytecode();
+    LOG_COMPILER(INFO) << "\033[34m" << "========================= End ==========================" << "\033[0m";
+}
+}  // panda::ecmascript::kungfu
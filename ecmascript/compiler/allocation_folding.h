@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_ALLOCATION_FOLDING_H
+#define ECMASCRIPT_COMPILER_ALLOCATION_FOLDING_H
+
+#include "ecmascript/compiler/circuit_builder-inl.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/mem/chunk_containers.h"
+
+namespace panda::ecmascript::kungfu {
+// Folds allocation regions (START_ALLOCATE .. HEAP_ALLOC .. FINISH_ALLOCATE) that follow each other on the depend
+// chain with nothing but plain stores in between. The first HEAP_ALLOC of a group reserves the memory of the whole
+// group, so the group pays for a single bump and limit check; every following object is addressed from the end of
+// its predecessor. Before folding, plain stores right after a region into the object it just created are sunk into
+// the region, and initializing stores they overwrite are removed. Only regions and gaps holding nothing but loads
+// and stores are folded, so no safepoint can see the memory of a group before all of its objects are initialized.
+class AllocationFolding {
+public:
+    AllocationFolding(Circuit *circuit, CompilationConfig *cmpCfg, bool enableLog, const std::string &name,
+                      Chunk *chunk)
+        : circuit_(circuit), acc_(circuit), builder_(circuit, cmpCfg), enableLog_(enableLog), methodName_(name),
+          regions_(chunk), regionSize_(chunk), groupTail_(chunk), chunk_(chunk) {}
+
+    ~AllocationFolding() = default;
+
+    void Run();
+
+private:
+    // the folded size is kept small, so that a group fits into what is left of the allocation buffer most of time
+    static constexpr size_t MAX_FOLDED_SIZE = 1024;
+    // bounds of the depend chain walks, allocation regions of large literals are longer than this
+    static constexpr size_t MAX_STORES_BETWEEN_REGIONS = 16;
+    static constexpr size_t MAX_VALUE_SEARCH_DEPTH = 4;
+
+    struct Region {
+        GateRef start {Circuit::NullGate()};
+        GateRef alloc {Circuit::NullGate()};
+        GateRef finish {Circuit::NullGate()};
+    };
+
+    bool MatchRegion(GateRef finish, Region &region) const;
+    bool TryGetConstantSize(GateRef size, size_t &value, size_t depth = 0) const;
+    bool IsFoldableAlloc(GateRef alloc) const;
+    GateRef GetSingleDependUse(GateRef gate);
+    bool IsSafepointFree(GateRef gate) const;
+    bool IsPlainStore(GateRef gate) const;
+    bool DependsOn(GateRef gate, GateRef target, size_t depth) const;
+
+    void SinkStores(const Region &region);
+    void EliminateOverwrittenStores(const Region &region);
+    bool FindNextRegion(GateRef finish, Region &next);
+    void FoldGroup(const Region &head);
+    void Fold(GateRef tailFinish, const Region &next);
+    // checks that nothing between the first allocation of a group and its last FINISH_ALLOCATE reaches a safepoint
+    bool VerifyFoldedGroup(GateRef rootAlloc, GateRef tailFinish) const;
+    void PrintLog() const;
+
+    Circuit *circuit_ {nullptr};
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    bool enableLog_ {false};
+    std::string methodName_;
+    ChunkVector<Region> regions_;
+    // size of the object allocated by each region, taken before any folding
+    ChunkUnorderedMap<GateRef, size_t> regionSize_;
+    // last FINISH_ALLOCATE of the group led by a HEAP_ALLOC
+    ChunkUnorderedMap<GateRef, GateRef> groupTail_;
+    Chunk *chunk_ {nullptr};
+    size_t foldedCount_ {0};
+    size_t sunkStoreCount_ {0};
+    size_t eliminatedStoreCount_ {0};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_ALLOCATION_FOLDING_H
@@ -16,6 +16,7 @@
 
 #include "ecmascript/checkpoint/thread_state_transition.h"
 #include "ecmascript/compiler/pass_manager.h"
+#include "ecmascript/compiler/pgo_type/pgo_type_manager.h"
 #include "ecmascript/log_wrapper.h"
 #include "ecmascript/ohos/ohos_pkg_verifier.h"
 #include "ecmascript/platform/aot_crash_info.h"
@@ -179,6 +180,8 @@ int Main(const int argc, const char **argv)
                 .EnableInductionVariableAnalysis(cOptions.isEnableInductionVariableAnalysis_)
                 .EnableVerifierPass(cOptions.isEnableVerifierPass_)
                 .EnableMergePoly(cOptions.isEnableMergePoly_)
+                .EnableAllocationFolding(cOptions.isEnableAllocationFolding_)
+                .EnableOptLoopUnrolling(cOptions.isEnableOptLoopUnrolling_)
                 .Build();
 
         PassManager passManager(&aotCompilationEnv,
@@ -201,6 +204,20 @@ int Main(const int argc, const char **argv)
 
         AOTFileGenerator generator(&log, &logList, &aotCompilationEnv, cOptions.triple_, isEnableLiteCG,
                                    cOptions.anFileMaxByteSize_);
+        generator.SetCodegenThreadNum(runtimeOptions.GetCompilerCodegenThreads());
+        std::unique_ptr<AOTIncrementalCache> incrementalCache = nullptr;
+        if (runtimeOptions.IsCompilerIncrementalAot()) {
+            if (anFd >= 0 || isEnableLiteCG) {
+                LOG_COMPILER(WARN) << "Incremental aot needs the last an file on disk and llvm codegen, "
+                                   << "compile all abc files";
+            } else {
+                uint64_t snapshotDigest = aotCompilationEnv.GetPTManager()->ComputeSnapshotDigest();
+                incrementalCache = std::make_unique<AOTIncrementalCache>(anPath,
+                    AOTIncrementalCache::ComputeFingerprint(argc, argv, snapshotDigest));
+                incrementalCache->Load();
+                generator.SetIncrementalCache(incrementalCache.get());
+            }
+        }
         if (runtimeOptions.IsTargetCompilerMode() && runtimeOptions.IsEnableAotCodeComment()) {
             if (!generator.CreateAOTCodeCommentFile(cOptions.outputFileName_ + AOTFileManager::FILE_EXTENSION_AN)) {
                 LOG_COMPILER(ERROR) << "Generate aot code comment file failed.";
@@ -217,6 +234,9 @@ int Main(const int argc, const char **argv)
             }
             LOG_COMPILER(DEBUG) << "SaveAOTFile via FD completed successfully";
         } else {
+            if (incrementalCache != nullptr) {
+                incrementalCache->RemoveManifest();
+            }
             if (!generator.SaveAOTFile(cOptions.outputFileName_ + AOTFileManager::FILE_EXTENSION_AN, appSignature,
                                        fileNameToChecksumMap)) {
                 return ERR_AN_FAIL;
@@ -225,6 +245,9 @@ int Main(const int argc, const char **argv)
         if (!generator.SaveSnapshotFile()) {
             return ERR_AI_FAIL;
         }
+        if (incrementalCache != nullptr && incrementalCache->SaveManifest()) {
+            incrementalCache->PrintReuseRatio();
+        }
         log.Print();
         if (runtimeOptions.IsTargetCompilerMode()) {
             compilerStats.PrintCompilerStatsLog();
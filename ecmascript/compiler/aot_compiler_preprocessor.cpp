@@ -69,6 +69,8 @@ CompilationOptions::CompilationOptions(JSRuntimeOptions &runtimeOptions)
     isEnableVerifierPass_ = !runtimeOptions.IsTargetCompilerMode();
     isEnableBaselinePgo_ = runtimeOptions.IsEnableBaselinePgo();
     isEnableMergePoly_ = runtimeOptions.IsEnableMergePoly();
+    isEnableAllocationFolding_ = runtimeOptions.IsEnableAllocationFolding();
+    isEnableOptLoopUnrolling_ = runtimeOptions.IsEnableOptLoopUnrolling();
     std::string optionSelectMethods = runtimeOptions.GetCompilerSelectMethods();
     std::string optionSkipMethods = runtimeOptions.GetCompilerSkipMethods();
     if (!optionSelectMethods.empty() && !optionSkipMethods.empty()) {
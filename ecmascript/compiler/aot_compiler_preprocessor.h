@@ -96,6 +96,8 @@ struct CompilationOptions {
     bool isEnableVerifierPass_ {true};
     bool isEnableBaselinePgo_ {false};
     bool isEnableMergePoly_ {true};
+    bool isEnableAllocationFolding_ {false};
+    bool isEnableOptLoopUnrolling_ {false};
     bool enableAotCodeComment_ {false};
     std::map<std::string, std::vector<std::string>> optionSelectMethods_;
     std::map<std::string, std::vector<std::string>> optionSkipMethods_;
@@ -99,7 +99,7 @@ void AnFileDataManager::SafePopulateStubIndexMapping()
 }
 #endif
 
-bool AnFileDataManager::SafeLoad(const std::string &fileName, Type type)
+bool AnFileDataManager::SafeLoad(const std::string &fileName, Type type, bool isLazyLoad)
 {
     WriteLockHolder lock(lock_);
     if (type == Type::STUB) {
@@ -112,7 +112,7 @@ bool AnFileDataManager::SafeLoad(const std::string &fileName, Type type)
         if (aotFileInfo != nullptr) {
             return true;
         }
-        return UnsafeLoadFromAOT(fileName);
+        return UnsafeLoadFromAOT(fileName, isLazyLoad);
     }
 }
 
@@ -159,11 +159,12 @@ bool AnFileDataManager::UnsafeLoadFromAOTInternal(const std::string &fileName, s
     return true;
 }
 
-bool AnFileDataManager::UnsafeLoadFromAOT(const std::string &fileName)
+bool AnFileDataManager::UnsafeLoadFromAOT(const std::string &fileName, bool isLazyLoad)
 {
     // note: This method is not thread-safe
     // need to ensure that the instance of AnFileDataManager has been locked before use
-    std::shared_ptr<AnFileInfo> info = std::make_shared<AnFileInfo>(AnFileInfo());
+    std::shared_ptr<AnFileInfo> info = std::make_shared<AnFileInfo>();
+    info->SetLazyLoad(isLazyLoad);
     if (!info->Load(fileName)) {
         return false;
     }
@@ -32,7 +32,7 @@ public:
     static AnFileDataManager *GetInstance();
     ~AnFileDataManager();
 
-    bool SafeLoad(const std::string &fileName, Type type);
+    bool SafeLoad(const std::string &fileName, Type type, bool isLazyLoad = false);
     uint32_t SafeGetFileInfoIndex(const std::string &fileName);
     std::shared_ptr<AnFileInfo> SafeGetAnFileInfo(uint32_t index);
     std::string SafeGetAnFileNameNoSuffix(uint32_t index);
@@ -81,7 +81,7 @@ private:
     AnFileDataManager() = default;
     std::shared_ptr<AnFileInfo> UnsafeFind(const std::string &fileName) const;
     bool UnsafeLoadFromAOTInternal(const std::string &fileName, std::shared_ptr<AnFileInfo> &info);
-    bool UnsafeLoadFromAOT(const std::string &fileName);
+    bool UnsafeLoadFromAOT(const std::string &fileName, bool isLazyLoad);
     bool UnsafeLoadFromStub(const std::string &fileName);
     bool UnsafeCheckFilenameToChecksum(const CString &fileName, uint32_t checksum);
     uint32_t UnSafeGetFileInfoIndex(const std::string &fileName);
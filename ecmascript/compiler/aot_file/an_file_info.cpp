@@ -24,6 +24,86 @@
 #include <unistd.h>
 
 namespace panda::ecmascript {
+LazyFuncEntryTable::LazyFuncEntryTable(const FuncEntryDes *entries, uint32_t entryNum, uint64_t textAddr,
+                                       const std::vector<ModuleRange> &modules)
+    : entries_(entries), entryNum_(entryNum), textAddr_(textAddr)
+{
+    uint64_t nextIndex = 0;
+    bool isContiguous = !modules.empty();
+    for (const auto &[startIndex, funcCount] : modules) {
+        if (startIndex != nextIndex) {
+            isContiguous = false;
+            break;
+        }
+        nextIndex += funcCount;
+    }
+    if (!isContiguous || nextIndex != entryNum) {
+        moduleNum_ = 1;
+        modules_ = std::make_unique<Module[]>(moduleNum_);
+        modules_[0].funcCount = entryNum;
+        return;
+    }
+    moduleNum_ = static_cast<uint32_t>(modules.size());
+    modules_ = std::make_unique<Module[]>(moduleNum_);
+    for (uint32_t i = 0; i < moduleNum_; i++) {
+        modules_[i].startIndex = modules[i].first;
+        modules_[i].funcCount = modules[i].second;
+    }
+}
+
+const FuncEntryDes &LazyFuncEntryTable::GetEntry(uint32_t index)
+{
+    ASSERT(index < entryNum_);
+    Module &module = modules_[FindModule(index)];
+    const FuncEntryDes *relocated = module.relocated.load(std::memory_order_acquire);
+    if (relocated == nullptr) {
+        relocated = RelocateModule(module);
+    }
+    return relocated[index - module.startIndex];
+}
+
+uint32_t LazyFuncEntryTable::FindModule(uint32_t index) const
+{
+    // the last module starting at or before the index, empty modules share the start index of the next one
+    const Module *begin = modules_.get();
+    const Module *end = begin + moduleNum_;
+    const Module *it = std::upper_bound(begin, end, index,
+        [](uint32_t idx, const Module &module) { return idx < module.startIndex; });
+    ASSERT(it != begin);
+    return static_cast<uint32_t>(it - begin) - 1;
+}
+
+const FuncEntryDes *LazyFuncEntryTable::RelocateModule(Module &module)
+{
+    LockHolder lock(mutex_);
+    const FuncEntryDes *relocated = module.relocated.load(std::memory_order_relaxed);
+    if (relocated != nullptr) {
+        return relocated;
+    }
+    module.storage.assign(entries_ + module.startIndex, entries_ + module.startIndex + module.funcCount);
+    for (FuncEntryDes &funcDes : module.storage) {
+        funcDes.codeAddr_ += textAddr_;
+    }
+    module.relocated.store(module.storage.data(), std::memory_order_release);
+    relocatedModuleNum_.fetch_add(1, std::memory_order_relaxed);
+    return module.storage.data();
+}
+
+const FuncEntryDes *LazyFuncEntryTable::FindEntryByTextOffset(uint64_t offset) const
+{
+    const FuncEntryDes *end = entries_ + entryNum_;
+    const FuncEntryDes *it = std::upper_bound(entries_, end, offset,
+        [](uint64_t addr, const FuncEntryDes &e) { return addr < e.codeAddr_; });
+    if (it == entries_) {
+        return nullptr;
+    }
+    --it;
+    if (offset >= it->codeAddr_ + it->funcSize_) {
+        return nullptr;
+    }
+    return it;
+}
+
 bool AnFileInfo::Save(const std::string &filename, Triple triple, size_t anFileMaxByteSize,
     const std::unordered_map<CString, uint32_t> &fileNameToChecksumMap)
 {
@@ -147,9 +227,12 @@ bool AnFileInfo::LoadInternal(const std::string &filename)
         LOG_ECMA(ERROR) << "update fileName to checksum map failed";
         return false;
     }
-    ParseFunctionEntrySection(des);
-
-    UpdateFuncEntries();
+    if (isLazyLoad_) {
+        ParseLazyFunctionEntrySection(des, reader);
+    } else {
+        ParseFunctionEntrySection(des);
+        UpdateFuncEntries();
+    }
 
     LOG_COMPILER(INFO) << "loaded an file: " << filename.c_str();
     isLoad_ = true;
@@ -196,6 +279,39 @@ void AnFileInfo::ParseFunctionEntrySection(ModuleSectionDes &des)
     des.SetFuncCount(entryNum_);
 }
 
+void AnFileInfo::ParseLazyFunctionEntrySection(ModuleSectionDes &des, ElfReader &reader)
+{
+    uint64_t secAddr = des.GetSecAddr(ElfSecName::ARK_FUNCENTRY);
+    uint32_t secSize = des.GetSecSize(ElfSecName::ARK_FUNCENTRY);
+    const FuncEntryDes *entryDes = reinterpret_cast<const FuncEntryDes *>(secAddr);
+    entryNum_ = secSize / sizeof(FuncEntryDes);
+    des.SetStartIndex(0);
+    des.SetFuncCount(entryNum_);
+
+    // the module table is only needed to relocate the entries module by module
+    ModuleSectionDes moduleInfoDes;
+    std::vector<ElfSecName> moduleInfoSecs = {ElfSecName::ARK_MODULEINFO};
+    reader.ParseELFSections(moduleInfoDes, moduleInfoSecs);
+    using ModuleRegionInfo = ModuleSectionDes::ModuleRegionInfo;
+    const ModuleRegionInfo *infos =
+        reinterpret_cast<const ModuleRegionInfo *>(moduleInfoDes.GetSecAddr(ElfSecName::ARK_MODULEINFO));
+    uint32_t moduleNum = moduleInfoDes.GetSecSize(ElfSecName::ARK_MODULEINFO) / sizeof(ModuleRegionInfo);
+    std::vector<LazyFuncEntryTable::ModuleRange> modules;
+    for (uint32_t i = 0; infos != nullptr && i < moduleNum; i++) {
+        modules.emplace_back(infos[i].startIndex, infos[i].funcCount);
+    }
+
+    uint64_t textAddr = des.GetSecAddr(ElfSecName::TEXT);
+    for (uint32_t i = 0; i < entryNum_; i++) {
+        if (entryDes[i].isMainFunc_) {
+            AddMainFuncEntry(entryDes[i], entryDes[i].codeAddr_ + textAddr);
+        }
+    }
+    lazyEntries_ = std::make_unique<LazyFuncEntryTable>(entryDes, entryNum_, textAddr, modules);
+    LOG_COMPILER(INFO) << "an file is loaded lazily, " << entryNum_ << " func entries in "
+                       << lazyEntries_->GetModuleNum() << " modules";
+}
+
 bool AnFileInfo::ParseChecksumInfo(ModuleSectionDes &des)
 {
     uint64_t secAddr = des.GetSecAddr(ElfSecName::ARK_CHECKSUMINFO);
@@ -238,14 +354,50 @@ void AnFileInfo::UpdateFuncEntries()
         FuncEntryDes &funcDes = entries_[i];
         funcDes.codeAddr_ += des.GetSecAddr(ElfSecName::TEXT);
         if (funcDes.isMainFunc_) {
-            EntryKey key = std::make_pair(funcDes.abcIndexInAi_, funcDes.indexInKindOrMethodId_);
-            mainEntryMap_[key] = MainFuncEntry { funcDes.codeAddr_, funcDes.fpDeltaPrevFrameSp_, funcDes.isFastCall_ };
+            AddMainFuncEntry(funcDes, funcDes.codeAddr_);
+        }
+    }
+}
+
+void AnFileInfo::AddMainFuncEntry(const FuncEntryDes &funcDes, uint64_t codeAddr)
+{
+    EntryKey key = std::make_pair(funcDes.abcIndexInAi_, funcDes.indexInKindOrMethodId_);
+    mainEntryMap_[key] = MainFuncEntry { codeAddr, funcDes.fpDeltaPrevFrameSp_, funcDes.isFastCall_ };
 #ifndef NDEBUG
-            LOG_COMPILER(INFO) << "AnFileInfo Load main method id: " << funcDes.indexInKindOrMethodId_
-                               << " code addr: " << reinterpret_cast<void *>(funcDes.codeAddr_);
+    LOG_COMPILER(INFO) << "AnFileInfo Load main method id: " << funcDes.indexInKindOrMethodId_
+                       << " code addr: " << reinterpret_cast<void *>(codeAddr);
 #endif
+}
+
+bool AnFileInfo::CalCallSiteInfo(uintptr_t retAddr, CallSiteInfo &ret, bool isInStub, bool isDeopt) const
+{
+    if (lazyEntries_ == nullptr) {
+        return AOTFileInfo::CalCallSiteInfo(retAddr, ret, isInStub, isDeopt);
+    }
+    // the entries of a module which never was bound are not relocated, so they are searched by text offset
+    const ModuleSectionDes &des = des_[0];
+    uint64_t textStart = des.GetSecAddr(ElfSecName::TEXT);
+    uint32_t size = des.GetSecSize(ElfSecName::TEXT);
+    if (retAddr < textStart || retAddr >= textStart + size) {
+        return false;
+    }
+    uint8_t *stackmapAddr = des.GetArkStackMapRawPtr();
+    ASSERT(stackmapAddr != nullptr);
+    int delta = 0;
+    CalleeRegAndOffsetVec calleeRegInfo;
+    if (isInStub || isDeopt) {
+        ASSERT(retAddr > textStart);
+        const FuncEntryDes *entry = lazyEntries_->FindEntryByTextOffset(retAddr - 1 - textStart);  // -1: for pc
+        ASSERT(entry != nullptr);
+        if (entry != nullptr) {
+            delta = entry->fpDeltaPrevFrameSp_;
+            if (isDeopt) {
+                StoreCalleeRegInfo(entry->calleeRegisterNum_, entry->CalleeReg2Offset_, calleeRegInfo);
+            }
         }
     }
+    ret = std::make_tuple(textStart, stackmapAddr, delta, calleeRegInfo);
+    return true;
 }
 
 const std::vector<ElfSecName> &AnFileInfo::GetDumpSectionNames()
@@ -266,6 +418,8 @@ void AnFileInfo::Destroy()
 {
     mainEntryMap_.clear();
     isLoad_ = false;
+    isLazyLoad_ = false;
+    lazyEntries_.reset();
     curTextSecOffset_ = 0;
     AOTFileInfo::Destroy();
 }
@@ -284,6 +438,10 @@ void AnFileInfo::Dump() const
                                 << std::hex << addr + size << "]";
         }
     }
+    if (lazyEntries_ != nullptr) {
+        LOG_COMPILER(INFO) << " - relocated modules: " << std::dec << lazyEntries_->GetRelocatedModuleNum() << "/"
+                           << lazyEntries_->GetModuleNum();
+    }
 }
 
 bool AnFileInfo::IsLoadMain(uint32_t fileIndex, const JSPandaFile *jsPandaFile, const CString &entry) const
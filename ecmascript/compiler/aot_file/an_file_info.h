@@ -15,16 +15,71 @@
 #ifndef ECMASCRIPT_COMPILER_AOT_FILE_AN_FILE_INFO_H
 #define ECMASCRIPT_COMPILER_AOT_FILE_AN_FILE_INFO_H
 
+#include <atomic>
+
 #include "ecmascript/compiler/aot_file/aot_file_info.h"
 #include "ecmascript/compiler/assembler/assembler.h"
+#include "ecmascript/platform/mutex.h"
 
 namespace panda::ecmascript {
+class ElfReader;
+
 struct MainFuncEntry {
     uint64_t mainEntry {0};
     int32_t fpDelta {0};
     bool isFastCall {false};
 };
 
+// Func entries of an an file which is loaded lazily. They stay in the mapped ARK_FUNCENTRY section, where code
+// addresses are relative to the text section, and the entries of a module are copied out and relocated when one
+// of them is looked up for the first time. A session only pays for the modules whose methods it binds.
+class PUBLIC_API LazyFuncEntryTable {
+public:
+    using ModuleRange = std::pair<uint32_t, uint32_t>;  // (startIndex, funcCount)
+
+    // modules must be sorted by start index and cover all entries, otherwise the table has a single module
+    LazyFuncEntryTable(const FuncEntryDes *entries, uint32_t entryNum, uint64_t textAddr,
+                       const std::vector<ModuleRange> &modules);
+    ~LazyFuncEntryTable() = default;
+
+    NO_COPY_SEMANTIC(LazyFuncEntryTable);
+    NO_MOVE_SEMANTIC(LazyFuncEntryTable);
+
+    const FuncEntryDes &GetEntry(uint32_t index);
+
+    // the unrelocated entry whose code contains the given offset into the text section, or nullptr
+    const FuncEntryDes *FindEntryByTextOffset(uint64_t offset) const;
+
+    uint32_t GetModuleNum() const
+    {
+        return moduleNum_;
+    }
+
+    uint32_t GetRelocatedModuleNum() const
+    {
+        return relocatedModuleNum_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Module {
+        uint32_t startIndex {0};
+        uint32_t funcCount {0};
+        std::atomic<const FuncEntryDes *> relocated {nullptr};
+        std::vector<FuncEntryDes> storage {};
+    };
+
+    uint32_t FindModule(uint32_t index) const;
+    const FuncEntryDes *RelocateModule(Module &module);
+
+    const FuncEntryDes *entries_ {nullptr};
+    uint32_t entryNum_ {0};
+    uint64_t textAddr_ {0};
+    std::unique_ptr<Module[]> modules_ {nullptr};
+    uint32_t moduleNum_ {0};
+    std::atomic<uint32_t> relocatedModuleNum_ {0};
+    Mutex mutex_;
+};
+
 class PUBLIC_API AnFileInfo : public AOTFileInfo {
 public:
     using FuncEntryIndexKey = std::pair<std::string, uint32_t>; // (compilefileName, MethodID)
@@ -79,6 +134,26 @@ public:
         return isLoad_;
     }
 
+    void SetLazyLoad(bool isLazyLoad)
+    {
+        isLazyLoad_ = isLazyLoad;
+    }
+
+    bool IsLazyLoad() const override
+    {
+        return lazyEntries_ != nullptr;
+    }
+
+    const FuncEntryDes &GetStubDes(int index) const
+    {
+        if (lazyEntries_ != nullptr) {
+            return lazyEntries_->GetEntry(static_cast<uint32_t>(index));
+        }
+        return AOTFileInfo::GetStubDes(index);
+    }
+
+    bool CalCallSiteInfo(uintptr_t retAddr, CallSiteInfo &ret, bool isInStub, bool isDeopt) const;
+
     void Destroy() override;
 
     void MappingEntryFuncsToAbcFiles(std::string curCompileFileName, uint32_t start, uint32_t end)
@@ -104,6 +179,8 @@ private:
     bool LoadInternal(const std::string &filename);
     bool Load(const std::string &filename);
     void ParseFunctionEntrySection(ModuleSectionDes &moduleDes);
+    void ParseLazyFunctionEntrySection(ModuleSectionDes &moduleDes, ElfReader &reader);
+    void AddMainFuncEntry(const FuncEntryDes &funcDes, uint64_t codeAddr);
     bool ParseChecksumInfo(ModuleSectionDes &moduleDes);
     void UpdateFuncEntries();
     void AddFuncEntrySec();
@@ -114,6 +191,8 @@ private:
     // Future work: add main entry mapping to ai file
     std::map<EntryKey, MainFuncEntry> mainEntryMap_ {};
     bool isLoad_ {false};
+    bool isLazyLoad_ {false};
+    std::unique_ptr<LazyFuncEntryTable> lazyEntries_ {nullptr};
     CUnorderedMap<uint32_t, std::string> entryIdxToFileNameMap_ {};
     CMap<FuncEntryIndexKey, uint32_t> methodToEntryIndexMap_ {};
 
@@ -35,6 +35,7 @@ void AOTFileInfo::Destroy()
 bool AOTFileInfo::CalCallSiteInfo(uintptr_t retAddr, std::tuple<uint64_t, uint8_t *, int, CalleeRegAndOffsetVec> &ret,
                                   bool isInStub, bool isDeopt) const
 {
+    ASSERT(!IsLazyLoad());
     uint64_t textStart = 0;
     uint8_t *stackmapAddr = nullptr;
     int delta = 0;
@@ -118,7 +119,7 @@ AOTFileInfo::FuncEntryDes AOTFileInfo::GetFuncEntryDesWithCallsite(uintptr_t cod
 }
 #endif
 
-void AOTFileInfo::StoreCalleeRegInfo(uint32_t calleeRegNum, int32_t *calleeReg2Offset,
+void AOTFileInfo::StoreCalleeRegInfo(uint32_t calleeRegNum, const int32_t *calleeReg2Offset,
                                      CalleeRegAndOffsetVec &calleeRegInfo) const
 {
     for (uint32_t j = 0; j < calleeRegNum; j++) {
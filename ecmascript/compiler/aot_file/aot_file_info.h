@@ -113,8 +113,16 @@ public:
     static constexpr uint32_t DATA_SEC_ALIGN = 8;
     static constexpr uint32_t PAGE_ALIGN = 4096;
 
+    // An an file loaded lazily keeps its func entries out of entries_, the accessors of AnFileInfo must be used for it,
+    // see AnFileInfo::GetStubDes.
+    virtual bool IsLazyLoad() const
+    {
+        return false;
+    }
+
     const FuncEntryDes &GetStubDes(int index) const
     {
+        ASSERT(!IsLazyLoad());
 #if ENABLE_MEMORY_OPTIMIZATION
         return GetRawEntries()[index];
 #else
@@ -124,6 +132,7 @@ public:
 
     uint32_t GetEntrySize() const
     {
+        ASSERT(!IsLazyLoad());
 #if ENABLE_MEMORY_OPTIMIZATION
         return rawEntries_ != nullptr ? entryNum_ : static_cast<uint32_t>(entries_.size());
 #else
@@ -133,6 +142,7 @@ public:
 
     const std::vector<FuncEntryDes> &GetStubs() const
     {
+        ASSERT(!IsLazyLoad());
         return entries_;
     }
 
@@ -150,6 +160,7 @@ public:
 
     uint32_t GetStubNum() const
     {
+        ASSERT(!IsLazyLoad());
         return entryNum_;
     }
 
@@ -186,6 +197,11 @@ public:
         entries_.emplace_back(des);
     }
 
+    void AddEntry(const FuncEntryDes &des)
+    {
+        entries_.emplace_back(des);
+    }
+
     const std::vector<ModuleSectionDes> &GetModuleSectionDes() const
     {
         return des_;
@@ -221,6 +237,9 @@ public:
     virtual void Destroy();
 
 protected:
+    void StoreCalleeRegInfo(uint32_t calleeRegNum, const int32_t *calleeReg2Offset,
+                            CalleeRegAndOffsetVec &calleeRegInfo) const;
+
     ExecutedMemoryAllocator::ExeMem &GetStubsMem()
     {
         return stubsMem_;
@@ -246,9 +265,6 @@ protected:
 private:
     AOTFileInfo::FuncEntryDes GetFuncEntryDesWithCallsite(uintptr_t codeAddr, uint32_t startIndex,
                                                           uint32_t funcCount) const;
-
-    void StoreCalleeRegInfo(uint32_t calleeRegNum, int32_t *calleeReg2Offset,
-                            CalleeRegAndOffsetVec &calleeRegInfo) const;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_COMPILER_AOT_FILE_AOT_FILE_INFO_H
@@ -92,11 +92,11 @@ void AOTFileManager::LoadStubFile(const std::string &fileName)
 #endif
 }
 
-bool AOTFileManager::LoadAnFile(const std::string &fileName)
+bool AOTFileManager::LoadAnFile(const std::string &fileName, bool isLazyLoad)
 {
     DISALLOW_GARBAGE_COLLECTION;
     AnFileDataManager *anFileDataManager = AnFileDataManager::GetInstance();
-    return anFileDataManager->SafeLoad(fileName, AnFileDataManager::Type::AOT);
+    return anFileDataManager->SafeLoad(fileName, AnFileDataManager::Type::AOT, isLazyLoad);
 }
 
 bool AOTFileManager::LoadAiFile([[maybe_unused]] const std::string &filename)
@@ -171,7 +171,7 @@ public:
     static constexpr uint32_t STUB_FILE_INDEX = 1;
 
     void LoadStubFile(const std::string& fileName);
-    static bool LoadAnFile(const std::string& fileName);
+    static bool LoadAnFile(const std::string& fileName, bool isLazyLoad = false);
     static AOTFileInfo::CallSiteInfo CalCallSiteInfo(uintptr_t retAddr, bool isDeopt);
     static bool TryReadLock();
     static bool InsideStub(uintptr_t pc);
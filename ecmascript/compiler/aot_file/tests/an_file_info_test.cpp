@@ -308,4 +308,69 @@ HWTEST_F_L0(AnFileInfoTest, Save_FailsWhenAddFileNameToChecksumSecFails)
     ASSERT_EQ(result, false);
 }
 
+static std::vector<FuncEntryDes> MakeLazyTestEntries()
+{
+    // 5 functions of 0x10 bytes each, 2 in the first module and 3 in the second
+    constexpr uint32_t entryNum = 5;
+    constexpr uint64_t funcSize = 0x10;
+    std::vector<FuncEntryDes> entries(entryNum);
+    for (uint32_t i = 0; i < entryNum; i++) {
+        entries[i].codeAddr_ = i * funcSize;
+        entries[i].funcSize_ = funcSize;
+        entries[i].indexInKindOrMethodId_ = i;
+        entries[i].fpDeltaPrevFrameSp_ = static_cast<int>(i);
+    }
+    return entries;
+}
+
+HWTEST_F_L0(AnFileInfoTest, LazyFuncEntryTable_RelocateByModule)
+{
+    constexpr uint64_t textAddr = 0x1000;
+    std::vector<FuncEntryDes> entries = MakeLazyTestEntries();
+    LazyFuncEntryTable table(entries.data(), entries.size(), textAddr, {{0, 2}, {2, 3}});
+    ASSERT_EQ(table.GetModuleNum(), 2U);
+    ASSERT_EQ(table.GetRelocatedModuleNum(), 0U);
+
+    const FuncEntryDes &entry = table.GetEntry(3);
+    EXPECT_EQ(entry.codeAddr_, textAddr + 0x30);
+    EXPECT_EQ(entry.indexInKindOrMethodId_, 3U);
+    EXPECT_EQ(table.GetRelocatedModuleNum(), 1U);
+    // the mapped entries are left as they are
+    EXPECT_EQ(entries[3].codeAddr_, 0x30U);
+
+    EXPECT_EQ(table.GetEntry(4).codeAddr_, textAddr + 0x40);
+    EXPECT_EQ(table.GetRelocatedModuleNum(), 1U);
+    EXPECT_EQ(table.GetEntry(0).codeAddr_, textAddr);
+    EXPECT_EQ(table.GetRelocatedModuleNum(), 2U);
+}
+
+HWTEST_F_L0(AnFileInfoTest, LazyFuncEntryTable_BrokenModuleInfo)
+{
+    std::vector<FuncEntryDes> entries = MakeLazyTestEntries();
+    // a gap between the modules falls back to a single module
+    LazyFuncEntryTable gap(entries.data(), entries.size(), 0, {{0, 2}, {3, 2}});
+    EXPECT_EQ(gap.GetModuleNum(), 1U);
+    EXPECT_EQ(gap.GetEntry(4).indexInKindOrMethodId_, 4U);
+
+    LazyFuncEntryTable empty(entries.data(), entries.size(), 0, {});
+    EXPECT_EQ(empty.GetModuleNum(), 1U);
+
+    // an empty module shares the start index of the next one
+    LazyFuncEntryTable withEmpty(entries.data(), entries.size(), 0, {{0, 2}, {2, 0}, {2, 3}});
+    EXPECT_EQ(withEmpty.GetModuleNum(), 3U);
+    EXPECT_EQ(withEmpty.GetEntry(2).indexInKindOrMethodId_, 2U);
+}
+
+HWTEST_F_L0(AnFileInfoTest, LazyFuncEntryTable_FindEntryByTextOffset)
+{
+    std::vector<FuncEntryDes> entries = MakeLazyTestEntries();
+    LazyFuncEntryTable table(entries.data(), entries.size(), 0x1000, {{0, 2}, {2, 3}});
+    const FuncEntryDes *entry = table.FindEntryByTextOffset(0x25);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->indexInKindOrMethodId_, 2U);
+    EXPECT_EQ(table.FindEntryByTextOffset(0x50), nullptr);
+    // nothing is relocated for a lookup by pc
+    EXPECT_EQ(table.GetRelocatedModuleNum(), 0U);
+}
+
 }  // namespace panda::test
\ No newline at end of file
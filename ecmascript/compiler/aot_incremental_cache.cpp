@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/aot_incremental_cache.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+#include "ecmascript/base/hash_combine.h"
+#include "ecmascript/compiler/aot_file/aot_version.h"
+#include "ecmascript/compiler/aot_file/elf_reader.h"
+#include "ecmascript/log_wrapper.h"
+#include "ecmascript/platform/file.h"
+
+namespace panda::ecmascript::kungfu {
+namespace {
+uint64_t HashBytes(uint64_t seed, const void *data, size_t size)
+{
+    std::string_view bytes(reinterpret_cast<const char *>(data), size);
+    return base::HashCombiner::HashCombine(seed, std::hash<std::string_view>{}(bytes));
+}
+
+template <typename T>
+bool CopySection(const ModuleSectionDes &des, ElfSecName sec, std::vector<T> &out)
+{
+    uint64_t addr = des.GetSecAddr(sec);
+    uint32_t size = des.GetSecSize(sec);
+    if (addr == 0 || size == 0) {
+        return false;
+    }
+    out.resize((size + sizeof(T) - 1) / sizeof(T));
+    if (memcpy_s(out.data(), out.size() * sizeof(T), reinterpret_cast<void *>(addr), size) != EOK) {
+        LOG_COMPILER(ERROR) << "memcpy_s failed";
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
+bool AOTIncrementalManifest::Parse(std::istream &in)
+{
+    std::string magic;
+    uint32_t version = 0;
+    if (!(in >> magic >> version) || magic != MAGIC || version != VERSION) {
+        return false;
+    }
+    std::string label;
+    if (!(in >> label >> fingerprint_) || label != "fingerprint") {
+        return false;
+    }
+    if (!(in >> label >> anDigest_) || label != "an") {
+        return false;
+    }
+    files_.clear();
+    while (in >> label) {
+        if (label != "file") {
+            return false;
+        }
+        FileRecord record;
+        if (!(in >> record.checksum >> record.profileDigest >> record.firstModule >> record.moduleCount
+                 >> record.methodCount)) {
+            return false;
+        }
+        // the name is the rest of the line, abc paths may contain spaces
+        std::string name;
+        std::getline(in >> std::ws, name);
+        if (name.empty()) {
+            return false;
+        }
+        files_[name] = record;
+    }
+    return in.eof();
+}
+
+void AOTIncrementalManifest::Dump(std::ostream &out) const
+{
+    out << MAGIC << " " << VERSION << "\n";
+    out << "fingerprint " << fingerprint_ << "\n";
+    out << "an " << anDigest_ << "\n";
+    for (auto &[name, record] : files_) {
+        out << "file " << record.checksum << " " << record.profileDigest << " " << record.firstModule << " "
+            << record.moduleCount << " " << record.methodCount << " " << name << "\n";
+    }
+}
+
+bool AOTIncrementalManifest::Load(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file.good()) {
+        return false;
+    }
+    return Parse(file);
+}
+
+bool AOTIncrementalManifest::Save(const std::string &path) const
+{
+    std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+    if (!file.good()) {
+        return false;
+    }
+    Dump(file);
+    file.close();
+    return !file.fail();
+}
+
+const AOTIncrementalManifest::FileRecord *AOTIncrementalManifest::FindFile(const std::string &name) const
+{
+    auto iter = files_.find(name);
+    return iter == files_.end() ? nullptr : &iter->second;
+}
+
+void AOTIncrementalManifest::AddFile(const std::string &name, const FileRecord &record)
+{
+    files_[name] = record;
+}
+
+bool ReusableAnFile::Load(const std::string &anPath)
+{
+    isLoaded_ = false;
+    std::string realPath;
+    if (!RealPath(anPath, realPath, false) || !FileExist(realPath.c_str())) {
+        return false;
+    }
+    MemMap fileMapMem = FileMap(realPath.c_str(), FILE_RDONLY, PAGE_PROT_READ);
+    if (fileMapMem.GetOriginAddr() == nullptr) {
+        LOG_COMPILER(ERROR) << "Fail to map the last an file: " << anPath;
+        return false;
+    }
+    // everything is copied out, the new an file unlinks this one before it is written
+    MemMapScope memMapScope(fileMapMem);
+    ElfReader reader(fileMapMem);
+    if (!reader.VerifyELFHeader(base::FileHeaderBase::ToVersionNumber(AOTFileVersion::AN_VERSION),
+                                AOTFileVersion::AN_STRICT_MATCH)) {
+        return false;
+    }
+    ModuleSectionDes des;
+    std::vector<ElfSecName> secs = {ElfSecName::TEXT, ElfSecName::STRTAB, ElfSecName::SYMTAB,
+                                    ElfSecName::ARK_STACKMAP, ElfSecName::ARK_FUNCENTRY, ElfSecName::ARK_MODULEINFO};
+    reader.ParseELFSections(des, secs);
+    std::vector<uint8_t> moduleInfo;
+    if (!CopySection(des, ElfSecName::TEXT, text_) || !CopySection(des, ElfSecName::STRTAB, strtab_) ||
+        !CopySection(des, ElfSecName::SYMTAB, symtab_) || !CopySection(des, ElfSecName::ARK_FUNCENTRY, entries_) ||
+        !CopySection(des, ElfSecName::ARK_MODULEINFO, moduleInfo)) {
+        LOG_COMPILER(INFO) << "The last an file has no code to reuse: " << anPath;
+        return false;
+    }
+    uint8_t *stackMapAddr = des.GetArkStackMapRawPtr();
+    uint32_t stackMapSize = des.GetArkStackMapSize();
+    if (stackMapAddr != nullptr && stackMapSize != 0) {
+        stackMap_.assign(stackMapAddr, stackMapAddr + stackMapSize);
+    }
+    if (!SeparateModules(moduleInfo)) {
+        LOG_COMPILER(ERROR) << "Broken module info in the last an file: " << anPath;
+        return false;
+    }
+    digest_ = HashBytes(0, text_.data(), text_.size());
+    digest_ = HashBytes(digest_, entries_.data(), entries_.size() * sizeof(FuncEntryDes));
+    digest_ = HashBytes(digest_, moduleInfo.data(), moduleInfo.size());
+    uintptr_t fileAddr = reinterpret_cast<uintptr_t>(fileMapMem.GetOriginAddr());
+    RestoreSymbols(des.GetSecAddr(ElfSecName::TEXT) - fileAddr);
+    isLoaded_ = true;
+    return true;
+}
+
+// follows the layout of ElfBuilder::MergeTextSections
+bool ReusableAnFile::SeparateModules(const std::vector<uint8_t> &moduleInfo)
+{
+    using ModuleRegionInfo = ModuleSectionDes::ModuleRegionInfo;
+    size_t num = moduleInfo.size() / sizeof(ModuleRegionInfo);
+    const ModuleRegionInfo *infos = reinterpret_cast<const ModuleRegionInfo *>(moduleInfo.data());
+    uint64_t secOffset = 0;
+    uint64_t strtabOffset = 0;
+    uint64_t symtabOffset = 0;
+    modules_.clear();
+    for (size_t i = 0; i < num; ++i) {
+        const ModuleRegionInfo &info = infos[i];
+        ModuleRegion region;
+        secOffset = AlignUp(secOffset, AOTFileInfo::PAGE_ALIGN);
+        region.regionOffset = static_cast<uint32_t>(secOffset);
+        region.rodataSizeBeforeText = info.rodataSizeBeforeText;
+        if (info.rodataSizeBeforeText != 0) {
+            secOffset += info.rodataSizeBeforeText;
+            secOffset = AlignUp(secOffset, AOTFileInfo::TEXT_SEC_ALIGN);
+        }
+        region.textOffset = static_cast<uint32_t>(secOffset);
+        region.textSize = info.textSize;
+        secOffset += info.textSize;
+        if (info.rodataSizeAfterText != 0) {
+            secOffset = AlignUp(secOffset, AOTFileInfo::RODATA_SEC_ALIGN);
+            region.rodataOffsetAfterText = static_cast<uint32_t>(secOffset);
+            region.rodataSizeAfterText = info.rodataSizeAfterText;
+            secOffset += info.rodataSizeAfterText;
+        }
+        region.startIndex = info.startIndex;
+        region.funcCount = info.funcCount;
+        region.strtabOffset = static_cast<uint32_t>(strtabOffset);
+        region.strtabSize = info.strtabSize;
+        region.symtabOffset = static_cast<uint32_t>(symtabOffset);
+        region.symtabSize = info.symtabSize;
+        strtabOffset += info.strtabSize;
+        symtabOffset += info.symtabSize;
+        if (static_cast<uint64_t>(info.startIndex) + info.funcCount > entries_.size()) {
+            return false;
+        }
+        modules_.emplace_back(region);
+    }
+    return secOffset <= text_.size() && strtabOffset <= strtab_.size() &&
+           symtabOffset <= symtab_.size() * sizeof(uint64_t);
+}
+
+// undoes what ElfBuilder::FixSymtab did to the symbols of every module
+void ReusableAnFile::RestoreSymbols(uint64_t textFileOffset)
+{
+    using Elf64_Sym = llvm::ELF::Elf64_Sym;
+    uint8_t *symtab = GetSymtabAddr();
+    for (const ModuleRegion &region : modules_) {
+        Elf64_Sym *syms = reinterpret_cast<Elf64_Sym *>(symtab + region.symtabOffset);
+        size_t n = region.symtabSize / sizeof(Elf64_Sym);
+        for (size_t i = 0; i < n; ++i) {
+            Elf64_Sym *sy = &syms[i];
+            if (sy->getType() == llvm::ELF::STT_FUNC) {
+                sy->st_value -= textFileOffset + region.textOffset;
+            }
+            sy->st_name -= region.strtabOffset;
+        }
+    }
+}
+
+uint64_t AOTIncrementalCache::ComputeFingerprint(int argc, const char **argv, uint64_t snapshotDigest)
+{
+    std::string version = AOTFileVersion::GetAOTVersion();
+    uint64_t fingerprint = HashBytes(0, version.data(), version.size());
+    // argv[0] is the path of the compiler, which does not change the code
+    for (int i = 1; i < argc; ++i) {
+        fingerprint = HashBytes(fingerprint, argv[i], strlen(argv[i]));
+    }
+    return base::HashCombiner::HashCombine(fingerprint, snapshotDigest);
+}
+
+bool AOTIncrementalCache::Load()
+{
+    isLoaded_ = false;
+    if (!lastManifest_.Load(manifestPath_)) {
+        LOG_COMPILER(INFO) << "No incremental manifest of the last compilation: " << manifestPath_;
+        return false;
+    }
+    if (lastManifest_.GetFingerprint() != fingerprint_) {
+        LOG_COMPILER(INFO) << "Compile options or aot snapshot changed, compile all abc files";
+        return false;
+    }
+    if (!lastAnFile_.Load(anPath_) || lastAnFile_.GetDigest() != lastManifest_.GetAnDigest()) {
+        LOG_COMPILER(INFO) << "The last an file is not the one of the manifest, compile all abc files";
+        return false;
+    }
+    isLoaded_ = true;
+    return true;
+}
+
+const AOTIncrementalManifest::FileRecord *AOTIncrementalCache::FindReusableFile(const std::string &name,
+                                                                               uint32_t checksum,
+                                                                               uint64_t profileDigest) const
+{
+    if (!isLoaded_) {
+        return nullptr;
+    }
+    const AOTIncrementalManifest::FileRecord *record = lastManifest_.FindFile(name);
+    if (record == nullptr || record->checksum != checksum || record->profileDigest != profileDigest) {
+        return nullptr;
+    }
+    if (record->moduleCount == 0 ||
+        static_cast<uint64_t>(record->firstModule) + record->moduleCount > lastAnFile_.GetModuleNum()) {
+        return nullptr;
+    }
+    return record;
+}
+
+void AOTIncrementalCache::RecordFile(const std::string &name, const AOTIncrementalManifest::FileRecord &record,
+                                     bool reused)
+{
+    newManifest_.AddFile(name, record);
+    totalFileCount_++;
+    totalMethodCount_ += record.methodCount;
+    if (reused) {
+        reusedFileCount_++;
+        reusedMethodCount_ += record.methodCount;
+    }
+}
+
+void AOTIncrementalCache::RemoveManifest() const
+{
+    if (FileExist(manifestPath_.c_str()) && Unlink(manifestPath_.c_str()) == -1) {
+        LOG_COMPILER(ERROR) << "remove " << manifestPath_ << " failed and errno is " << errno;
+    }
+}
+
+bool AOTIncrementalCache::SaveManifest()
+{
+    ReusableAnFile savedAnFile;
+    if (!savedAnFile.Load(anPath_)) {
+        LOG_COMPILER(ERROR) << "Fail to read back the an file for the incremental manifest: " << anPath_;
+        return false;
+    }
+    newManifest_.SetAnDigest(savedAnFile.GetDigest());
+    if (!newManifest_.Save(manifestPath_)) {
+        LOG_COMPILER(ERROR) << "Fail to save the incremental manifest: " << manifestPath_;
+        return false;
+    }
+    return true;
+}
+
+void AOTIncrementalCache::PrintReuseRatio() const
+{
+    LOG_COMPILER(INFO) << "Incremental aot reused " << reusedFileCount_ << "/" << totalFileCount_
+                       << " abc files and " << reusedMethodCount_ << "/" << totalMethodCount_ << " methods";
+}
+}  // namespace panda::ecmascript::kungfu
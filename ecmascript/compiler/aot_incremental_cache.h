@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_AOT_INCREMENTAL_CACHE_H
+#define ECMASCRIPT_COMPILER_AOT_INCREMENTAL_CACHE_H
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ecmascript/common.h"
+#include "ecmascript/compiler/aot_file/func_entry_des.h"
+
+namespace panda::ecmascript::kungfu {
+// Records, next to an an file, which modules of it were compiled from which abc file, and under which bytecode
+// and profile. A later compilation with the same options may take those modules over instead of compiling again.
+//
+// The manifest is plain text:
+//     ark-aot-incremental 1
+//     fingerprint <options and snapshot digest>
+//     an <digest of the an file>
+//     file <checksum> <profile digest> <first module> <module count> <method count> <abc name>
+class PUBLIC_API AOTIncrementalManifest {
+public:
+    struct FileRecord {
+        uint32_t checksum {0};
+        uint64_t profileDigest {0};
+        uint32_t firstModule {0};
+        uint32_t moduleCount {0};
+        uint32_t methodCount {0};
+    };
+
+    AOTIncrementalManifest() = default;
+    explicit AOTIncrementalManifest(uint64_t fingerprint) : fingerprint_(fingerprint) {}
+    ~AOTIncrementalManifest() = default;
+
+    bool Parse(std::istream &in);
+    void Dump(std::ostream &out) const;
+    bool Load(const std::string &path);
+    bool Save(const std::string &path) const;
+
+    const FileRecord *FindFile(const std::string &name) const;
+    void AddFile(const std::string &name, const FileRecord &record);
+
+    uint64_t GetFingerprint() const
+    {
+        return fingerprint_;
+    }
+
+    uint64_t GetAnDigest() const
+    {
+        return anDigest_;
+    }
+
+    void SetAnDigest(uint64_t digest)
+    {
+        anDigest_ = digest;
+    }
+
+    size_t GetFileCount() const
+    {
+        return files_.size();
+    }
+
+private:
+    static constexpr const char *MAGIC = "ark-aot-incremental";
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t fingerprint_ {0};
+    uint64_t anDigest_ {0};
+    std::map<std::string, FileRecord> files_ {};
+};
+
+// The code of an an file of a previous compilation, copied out of the file so that the new an file can be written
+// to the same path. Symbols are brought back to what codegen emits, so ElfBuilder can place them once again.
+class ReusableAnFile {
+public:
+    struct ModuleRegion {
+        // offsets are relative to the start of the TEXT section
+        uint32_t regionOffset {0};
+        uint32_t rodataSizeBeforeText {0};
+        uint32_t textOffset {0};
+        uint32_t textSize {0};
+        uint32_t rodataOffsetAfterText {0};
+        uint32_t rodataSizeAfterText {0};
+        uint32_t startIndex {0};
+        uint32_t funcCount {0};
+        uint32_t strtabOffset {0};
+        uint32_t strtabSize {0};
+        uint32_t symtabOffset {0};
+        uint32_t symtabSize {0};
+    };
+
+    ReusableAnFile() = default;
+    ~ReusableAnFile() = default;
+
+    NO_COPY_SEMANTIC(ReusableAnFile);
+    NO_MOVE_SEMANTIC(ReusableAnFile);
+
+    bool Load(const std::string &anPath);
+
+    bool IsLoaded() const
+    {
+        return isLoaded_;
+    }
+
+    uint64_t GetDigest() const
+    {
+        return digest_;
+    }
+
+    uint32_t GetModuleNum() const
+    {
+        return static_cast<uint32_t>(modules_.size());
+    }
+
+    const ModuleRegion &GetModule(uint32_t index) const
+    {
+        return modules_.at(index);
+    }
+
+    const std::vector<FuncEntryDes> &GetEntries() const
+    {
+        return entries_;
+    }
+
+    uint8_t *GetTextAddr()
+    {
+        return text_.data();
+    }
+
+    uint8_t *GetStrtabAddr()
+    {
+        return strtab_.data();
+    }
+
+    uint8_t *GetSymtabAddr()
+    {
+        return reinterpret_cast<uint8_t *>(symtab_.data());
+    }
+
+    uint8_t *GetStackMapAddr()
+    {
+        return stackMap_.empty() ? nullptr : stackMap_.data();
+    }
+
+private:
+    bool SeparateModules(const std::vector<uint8_t> &moduleInfo);
+    void RestoreSymbols(uint64_t textFileOffset);
+
+    bool isLoaded_ {false};
+    uint64_t digest_ {0};
+    std::vector<ModuleRegion> modules_ {};
+    std::vector<FuncEntryDes> entries_ {};
+    std::vector<uint8_t> text_ {};
+    std::vector<uint8_t> strtab_ {};
+    std::vector<uint64_t> symtab_ {};
+    std::vector<uint8_t> stackMap_ {};
+};
+
+class AOTIncrementalCache {
+public:
+    AOTIncrementalCache(const std::string &anPath, uint64_t fingerprint)
+        : anPath_(anPath), manifestPath_(anPath + MANIFEST_EXTENSION), fingerprint_(fingerprint),
+          newManifest_(fingerprint) {}
+    ~AOTIncrementalCache() = default;
+
+    NO_COPY_SEMANTIC(AOTIncrementalCache);
+    NO_MOVE_SEMANTIC(AOTIncrementalCache);
+
+    // hashes what decides the code of every method besides its bytecode and profile: the compiler version,
+    // the compile options and the tables of the aot snapshot
+    static uint64_t PUBLIC_API ComputeFingerprint(int argc, const char **argv, uint64_t snapshotDigest);
+
+    // loads the manifest and the an file of the last compilation, returns whether anything may be reused
+    bool PUBLIC_API Load();
+
+    // the modules of the abc file in the last an file, or nullptr if they cannot be taken over
+    const AOTIncrementalManifest::FileRecord *FindReusableFile(const std::string &name, uint32_t checksum,
+                                                               uint64_t profileDigest) const;
+
+    void RecordFile(const std::string &name, const AOTIncrementalManifest::FileRecord &record, bool reused);
+
+    ReusableAnFile &GetReusableAnFile()
+    {
+        return lastAnFile_;
+    }
+
+    // the manifest is removed before the an file is written and saved after, so it never describes a broken file
+    void PUBLIC_API RemoveManifest() const;
+    bool PUBLIC_API SaveManifest();
+
+    void PUBLIC_API PrintReuseRatio() const;
+
+private:
+    static constexpr const char *MANIFEST_EXTENSION = ".inc";
+
+    std::string anPath_;
+    std::string manifestPath_;
+    uint64_t fingerprint_ {0};
+    AOTIncrementalManifest lastManifest_ {};
+    AOTIncrementalManifest newManifest_;
+    ReusableAnFile lastAnFile_ {};
+    bool isLoaded_ {false};
+    uint32_t reusedFileCount_ {0};
+    uint32_t totalFileCount_ {0};
+    uint32_t reusedMethodCount_ {0};
+    uint32_t totalMethodCount_ {0};
+};
+}  // namespace panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_AOT_INCREMENTAL_CACHE_H
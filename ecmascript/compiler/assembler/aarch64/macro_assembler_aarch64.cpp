@@ -97,7 +97,17 @@ void MacroAssemblerAArch64::CallBuiltin(Address funcAddress,
         }
         MovParameterIntoParamReg(param, registerParamVec[i]);
     }
-    assembler.Mov(LOCAL_SCOPE_REGISTER, aarch64::Immediate(funcAddress));
+    if (patchableStubCalls) {
+        // materialize the full address with movz + 3 movk so the sequence can be patched in place
+        RecordStubRelocation(funcAddress);
+        uint64_t address = static_cast<uint64_t>(funcAddress);
+        assembler.Movz(LOCAL_SCOPE_REGISTER, address & 0xFFFFULL, 0);
+        for (uint32_t shift = k16BitSize; shift < k64BitSize; shift += k16BitSize) {
+            assembler.Movk(LOCAL_SCOPE_REGISTER, (address >> shift) & 0xFFFFULL, static_cast<int>(shift));
+        }
+    } else {
+        assembler.Mov(LOCAL_SCOPE_REGISTER, aarch64::Immediate(funcAddress));
+    }
     assembler.Blr(LOCAL_SCOPE_REGISTER);
 }
 
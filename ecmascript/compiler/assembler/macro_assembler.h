@@ -19,6 +19,7 @@
 #include "ecmascript/compiler/assembler/assembler.h"
 #include "ecmascript/compiler/bytecodes.h"
 #include "ecmascript/ecma_vm.h"
+#include "ecmascript/mem/machine_code.h"
 #include "ecmascript/mem/native_area_allocator.h"
 
 namespace panda::ecmascript::kungfu {
@@ -85,9 +86,35 @@ public:
     virtual void CallBuiltin(Address funcAddress,
                              const std::vector<MacroParameter> &parameters) = 0;
 
+    // Only needed when the code is stored in the jit code cache: the builtin addresses are then materialized in a
+    // fixed length sequence and recorded, so that they can be patched when the code is loaded by another process.
+    void SetPatchableStubCalls(bool patchable)
+    {
+        patchableStubCalls = patchable;
+    }
+
+    bool IsPatchableStubCalls() const
+    {
+        return patchableStubCalls;
+    }
+
+    const std::vector<StubRelocation> &GetStubRelocations() const
+    {
+        return stubRelocations;
+    }
+
 protected:
+    void RecordStubRelocation(Address funcAddress)
+    {
+        if (patchableStubCalls) {
+            stubRelocations.push_back({static_cast<uint32_t>(GetBufferCurrentSize()), funcAddress});
+        }
+    }
+
     NativeAreaAllocator allocator;
     Chunk chunk;
+    bool patchableStubCalls {false};
+    std::vector<StubRelocation> stubRelocations;
     static constexpr int32_t FUNCTION_OFFSET_FROM_SP = -72; // 72: includes 9 slots
 };
 }  // namespace panda::ecmascript::kungfu
@@ -150,6 +150,7 @@ void MacroAssemblerX64::CallBuiltin(Address funcAddress,
         }
         MovParameterIntoParamReg(param, registerParamVec[i]);
     }
+    RecordStubRelocation(funcAddress);
     assembler.Movabs(static_cast<uint64_t>(funcAddress), LOCAL_SCOPE_REGISTER);
     assembler.Callq(LOCAL_SCOPE_REGISTER);
 }
@@ -130,6 +130,7 @@ void BaselineCompiler::Compile(const JSPandaFile *jsPandaFile, const MethodLiter
     const uint8_t *methodBytecodeLast = bytecodeArray + codeSize;
     StackOffsetDescriptor stackOffsetDescriptor(methodLiteral->GetCallField());
     GetBaselineAssembler().SetStackOffsetDescriptor(stackOffsetDescriptor);
+    GetBaselineAssembler().GetMacroAssembler().SetPatchableStubCalls(Jit::GetInstance()->GetCodeCache() != nullptr);
     SetPfHeaderAddr(jsPandaFile);
     firstPC = bytecodeArray;
 
@@ -184,6 +185,11 @@ bool BaselineCompiler::CollectMemoryCodeInfos(MachineCodeDesc &codeDesc)
     codeDesc.codeType = MachineCodeType::BASELINE_CODE;
     codeDesc.stackMapOrOffsetTableAddr = reinterpret_cast<uint64_t>(nativePcOffsetTable.GetData());
     codeDesc.stackMapOrOffsetTableSize = nativePcOffsetTable.GetSize();
+    MacroAssembler &macroAssembler = GetBaselineAssembler().GetMacroAssembler();
+    const std::vector<StubRelocation> &stubRelocations = macroAssembler.GetStubRelocations();
+    codeDesc.stubRelocationAddr = reinterpret_cast<uintptr_t>(stubRelocations.data());
+    codeDesc.stubRelocationCount = stubRelocations.size();
+    codeDesc.stubCallsPatchable = macroAssembler.IsPatchableStubCalls();
 #ifdef JIT_ENABLE_CODE_SIGN
     codeDesc.codeSigner = 0;
     JitSignCode *singleton = JitSignCode::GetInstance();
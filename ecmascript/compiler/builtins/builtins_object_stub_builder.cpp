@@ -882,6 +882,47 @@ GateRef BuiltinsObjectStubBuilder::GetAllEnumKeys(GateRef glue, GateRef obj)
     return ret;
 }
 
+// JSObject::GetEnumKeysSnapshot(), the runtime turns the cached keys of the hclass into the snapshot
+GateRef BuiltinsObjectStubBuilder::GetEnumKeysSnapshot(GateRef glue, GateRef obj)
+{
+    auto env = GetEnvironment();
+    Label subEntry(env);
+    env->SubCfgEntry(&subEntry);
+    Label exit(env);
+    Label isPlainObject(env);
+    Label hasEnumCache(env);
+    Label hasEnumCacheOwn(env);
+    Label isCOWArray(env);
+    Label createSnapshot(env);
+    DEFVARIABLE(result, VariableType::JS_ANY(), Undefined());
+    GateRef hclass = LoadHClass(glue, obj);
+    GateRef isPlain = LogicAndBuilder(env)
+        .And(Int32Equal(GetObjectType(hclass), Int32(static_cast<int32_t>(JSType::JS_OBJECT))))
+        .And(BoolNot(IsDictionaryModeByHClass(hclass)))
+        .And(BoolNot(InSharedHeap(ObjectAddressToRange(hclass))))
+        .And(Int32Equal(GetLengthOfTaggedArray(GetElementsArray(glue, obj)), Int32(0)))
+        .Done();
+    BRANCH(isPlain, &isPlainObject, &exit);
+    Bind(&isPlainObject);
+    GateRef enumCache = GetEnumCacheFromHClass(glue, hclass);
+    BRANCH(TaggedIsEnumCache(glue, enumCache), &hasEnumCache, &createSnapshot);
+    Bind(&hasEnumCache);
+    GateRef enumCacheOwn = GetEnumCacheOwnFromEnumCache(glue, enumCache);
+    BRANCH(TaggedIsNull(enumCacheOwn), &createSnapshot, &hasEnumCacheOwn);
+    Bind(&hasEnumCacheOwn);
+    BRANCH(IsCOWArray(glue, enumCacheOwn), &isCOWArray, &createSnapshot);
+    Bind(&isCOWArray);
+    result = enumCacheOwn;
+    Jump(&exit);
+    Bind(&createSnapshot);
+    result = CallRuntime(glue, RTSTUB_ID(GetEnumKeysSnapshot), { obj });
+    Jump(&exit);
+    Bind(&exit);
+    auto ret = *result;
+    env->SubCfgExit();
+    return ret;
+}
+
 GateRef BuiltinsObjectStubBuilder::GetEnumElementKeys(GateRef glue, GateRef obj)
 {
     auto env = GetEnvironment();
@@ -1027,8 +1068,19 @@ void BuiltinsObjectStubBuilder::Keys(Variable *result, Label *exit, Label *slowP
     {
         Label hasKeyAndEle(env);
         Label nonKeyAndEle(env);
+        Label hasSnapshot(env);
+        Label noSnapshot(env);
         // need to caclulate elementKind
         GateRef elementKind = Int32(Elements::ToUint(ElementsKind::TAGGED));
+        // objects of one hclass share their keys, the result copies them only once it is written to
+        GateRef snapshot = GetEnumKeysSnapshot(glue_, obj);
+        BRANCH(TaggedIsUndefined(snapshot), &noSnapshot, &hasSnapshot);
+        Bind(&hasSnapshot);
+        {
+            *result = newBuilder.CreateArrayFromList(glue_, snapshot, elementKind);
+            Jump(exit);
+        }
+        Bind(&noSnapshot);
         GateRef elementArray = GetEnumElementKeys(glue_, obj);
         GateRef keyArray = GetAllEnumKeys(glue_, obj);
         GateRef lengthOfKeys = GetLengthOfTaggedArray(keyArray);
@@ -45,6 +45,7 @@ private:
     GateRef GetNumKeysFromDictionary(GateRef array);
     GateRef CopyFromKeyArray(GateRef glue, GateRef elements);
     GateRef GetAllEnumKeys(GateRef glue, GateRef obj);
+    GateRef GetEnumKeysSnapshot(GateRef glue, GateRef obj);
     GateRef GetEnumElementKeys(GateRef glue, GateRef obj);
     GateRef GetAllElementKeys(GateRef glue, GateRef obj, GateRef offset, GateRef array);
     GateRef GetAllPropertyKeys(GateRef glue, GateRef obj, GateRef offset, GateRef array);
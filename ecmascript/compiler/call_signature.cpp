@@ -1645,6 +1645,23 @@ DEF_CALL_SIGNATURE(SteedCallWithArgVAndPushArgv)
     callSign->SetCallConv(CallSignature::CallConv::CCallConv);
 }
 
+DEF_CALL_SIGNATURE(SteedOsrEntry)
+{
+    /* 4 : 4 input parameters */
+    CallSignature steedOsrEntry("SteedOsrEntry", 0, 4,
+        ArgumentsOrder::DEFAULT_ORDER, VariableType::JS_ANY());
+    *callSign = steedOsrEntry;
+    std::array<VariableType, 4> params = {      // 4 : 4 input parameters
+        VariableType::NATIVE_POINTER(),     // glue
+        VariableType::NATIVE_POINTER(),     // sp of the interpreted frame
+        VariableType::JS_ANY(),             // jsfunc
+        VariableType::NATIVE_POINTER(),     // osr code entry
+    };
+    callSign->SetParameters(params.data());
+    callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
+    callSign->SetCallConv(CallSignature::CallConv::CCallConv);
+}
+
 DEF_CALL_SIGNATURE(ResumeRspAndDispatch)
 {
     // 7 : 7 input parameters
@@ -1900,6 +1917,25 @@ DEF_CALL_SIGNATURE(StringToNumber)
     callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
 }
 
+DEF_CALL_SIGNATURE(CallFastNativeFunction)
+{
+    // 6 : 6 input parameters
+    CallSignature callFastNativeFunction("CallFastNativeFunction", 0, 6,
+        ArgumentsOrder::DEFAULT_ORDER, VariableType::JS_ANY());
+    *callSign = callFastNativeFunction;
+    std::array<VariableType, 6> params = { // 6 : 6 input parameters
+        VariableType::NATIVE_POINTER(),
+        VariableType::JS_POINTER(),
+        VariableType::INT32(),
+        VariableType::JS_ANY(),
+        VariableType::JS_ANY(),
+        VariableType::JS_ANY(),
+    };
+    callSign->SetParameters(params.data());
+    callSign->SetGCLeafFunction(true);
+    callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
+}
+
 DEF_CALL_SIGNATURE(GetExternalModuleVar)
 {
     // 3 : 3 input parameters
@@ -2456,6 +2492,23 @@ DEF_CALL_SIGNATURE(DebugOsrEntry)
     callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
 }
 
+DEF_CALL_SIGNATURE(FindOsrCodeEntry)
+{
+    // 3 : 3 input parameters
+    CallSignature findOsrCodeEntry("FindOsrCodeEntry", 0, 3,
+        ArgumentsOrder::DEFAULT_ORDER, VariableType::NATIVE_POINTER());
+    *callSign = findOsrCodeEntry;
+    // 3 : 3 input parameters
+    std::array<VariableType, 3> params = {
+        VariableType::NATIVE_POINTER(),
+        VariableType::JS_POINTER(),
+        VariableType::INT32(),
+    };
+    callSign->SetParameters(params.data());
+    callSign->SetGCLeafFunction(true);
+    callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
+}
+
 DEF_CALL_SIGNATURE(Comment)
 {
     // 1 : 1 input parameters
@@ -536,6 +536,7 @@ private:
     V(ArkSteedCallEntry)                        \
     V(SteedCallAndPushArgv)                     \
     V(SteedCallWithArgVAndPushArgv)             \
+    V(SteedOsrEntry)                            \
     V(GeneratorReEnterAsmInterp)                \
     V(CallRuntimeWithArgv)                      \
     V(OptimizedCallAndPushArgv)                 \
@@ -586,6 +587,7 @@ private:
     V(DebugPrintInstruction)                    \
     V(CollectingOpcodes)                        \
     V(DebugOsrEntry)                            \
+    V(FindOsrCodeEntry)                         \
     V(Comment)                                  \
     V(FatalPrint)                               \
     V(FatalPrintCustom)                         \
@@ -685,6 +687,7 @@ private:
     V(DoubleLexicographicCompare)               \
     V(FastArraySortString)                      \
     V(StringToNumber)                           \
+    V(CallFastNativeFunction)                   \
     V(StringGetStart)                           \
     V(StringGetEnd)                             \
     V(ArrayTrim)                                \
@@ -586,6 +586,11 @@ void CallStubBuilder::JSCallNativeInner(Label *exit, bool isJSFunction)
     std::vector<GateRef> argsForNative = PrepareArgsForNative();
     auto env0 = GetEnvironment();
     Label notFastBuiltins(env0);
+    Label notFastNative(env0);
+    if (isJSFunction && IsCallModeSupportFastNative()) {
+        CallFastNativeFunction(&notFastNative, exit);
+        Bind(&notFastNative);
+    }
     switch (callArgs_.mode) {
         case JSCallMode::CALL_THIS_ARG0:
         case JSCallMode::CALL_THIS_ARG1:
@@ -2021,6 +2026,76 @@ std::vector<GateRef> CallStubBuilder::PrepareAppendArgsForAsmInterpreter()
     }
 }
 
+bool CallStubBuilder::IsCallModeSupportFastNative() const
+{
+    switch (callArgs_.mode) {
+        case JSCallMode::CALL_ARG0:
+        case JSCallMode::CALL_ARG1:
+        case JSCallMode::CALL_ARG2:
+        case JSCallMode::CALL_ARG3:
+        case JSCallMode::DEPRECATED_CALL_ARG0:
+        case JSCallMode::DEPRECATED_CALL_ARG1:
+        case JSCallMode::DEPRECATED_CALL_ARG2:
+        case JSCallMode::DEPRECATED_CALL_ARG3:
+        case JSCallMode::CALL_THIS_ARG0:
+        case JSCallMode::CALL_THIS_ARG1:
+        case JSCallMode::CALL_THIS_ARG2:
+        case JSCallMode::CALL_THIS_ARG3:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Functions made by FunctionRef::NewFastCall get their unboxed arguments straight from the stub, without the frame
+// and the EcmaRuntimeCallInfo of the native entry. Hole means the arguments did not match the signature.
+void CallStubBuilder::CallFastNativeFunction(Label *notFastNative, Label *exit)
+{
+    auto env = GetEnvironment();
+    Label isFastNative(env);
+    Label matched(env);
+    GateRef bitField = LoadPrimitive(VariableType::INT32(), func_, IntPtr(JSFunctionBase::BIT_FIELD_OFFSET));
+    GateRef fastNativeMask = Int32(1U << JSFunctionBase::IsFastNativeCallBit::START_BIT);
+    BRANCH_UNLIKELY(Int32NotEqual(Int32And(bitField, fastNativeMask), Int32(0)), &isFastNative, notFastNative);
+    Bind(&isFastNative);
+    std::vector<GateRef> args = { glue_, func_, actualNumArgs_ };
+    switch (callArgs_.mode) {
+        case JSCallMode::CALL_ARG3:
+        case JSCallMode::DEPRECATED_CALL_ARG3:
+            args.insert(args.end(), { callArgs_.callArgs.arg0, callArgs_.callArgs.arg1, callArgs_.callArgs.arg2 });
+            break;
+        case JSCallMode::CALL_ARG2:
+        case JSCallMode::DEPRECATED_CALL_ARG2:
+            args.insert(args.end(), { callArgs_.callArgs.arg0, callArgs_.callArgs.arg1 });
+            break;
+        case JSCallMode::CALL_ARG1:
+        case JSCallMode::DEPRECATED_CALL_ARG1:
+            args.push_back(callArgs_.callArgs.arg0);
+            break;
+        case JSCallMode::CALL_THIS_ARG3:
+            args.insert(args.end(), { callArgs_.callArgsWithThis.arg0, callArgs_.callArgsWithThis.arg1,
+                                      callArgs_.callArgsWithThis.arg2 });
+            break;
+        case JSCallMode::CALL_THIS_ARG2:
+            args.insert(args.end(), { callArgs_.callArgsWithThis.arg0, callArgs_.callArgsWithThis.arg1 });
+            break;
+        case JSCallMode::CALL_THIS_ARG1:
+            args.push_back(callArgs_.callArgsWithThis.arg0);
+            break;
+        default:
+            break;
+    }
+    // 6: glue, func, argc and three arguments
+    while (args.size() < 6) {
+        args.push_back(Undefined());
+    }
+    GateRef ret = CallNGCRuntime(glue_, RTSTUB_ID(CallFastNativeFunction), args, hir_);
+    BRANCH(TaggedIsHole(ret), notFastNative, &matched);
+    Bind(&matched);
+    result_->WriteVariable(ret);
+    Jump(exit);
+}
+
 void CallStubBuilder::CallFastBuiltin(Label* notFastBuiltins, Label *exit, GateRef hir)
 {
     auto env = GetEnvironment();
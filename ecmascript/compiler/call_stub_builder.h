@@ -253,6 +253,8 @@ private:
 #endif
 
     void CallFastBuiltin(Label* notFastBuiltins, Label *exit, GateRef hir = Circuit::NullGate());
+    bool IsCallModeSupportFastNative() const;
+    void CallFastNativeFunction(Label *notFastNative, Label *exit);
     std::vector<GateRef> PrepareArgsForFastBuiltin();
     std::vector<GateRef> PrepareBasicArgsForFastBuiltin();
     std::vector<GateRef> PrepareAppendArgsForFastBuiltin();
@@ -61,6 +61,8 @@ struct CodeInfo {
 
         // record all memory blocks requested.
         std::vector<std::pair<uint8_t *, uintptr_t>> sections_;
+        // modules of one aot file may be compiled on several threads
+        Mutex mutex_ {};
     };
 
     struct FuncInfo {
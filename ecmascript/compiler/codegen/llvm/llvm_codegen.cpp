@@ -33,11 +33,13 @@
 
 #include "llvm-c/Analysis.h"
 #include "llvm-c/Disassembler.h"
+#include "llvm-c/TargetMachine.h"
 #include "llvm-c/Transforms/PassManagerBuilder.h"
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
 #include "llvm/ExecutionEngine/SectionMemoryManager.h"
 #include "llvm/ExecutionEngine/MCJIT.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/Transforms/IPO/PassManagerBuilder.h"
 #include "lib/llvm_interface.h"
 
 #include "ecmascript/compiler/aot_file/aot_file_info.h"
@@ -107,6 +109,8 @@ uint8_t *CodeInfo::CodeSpace::Alloca(uintptr_t size, bool isReq, size_t alignSiz
 {
     // Wait other threads arrived here, then allocate in same time.
     ConcurrentMonitor::monitor_.ArriveAndWait();
+    // the aot modules of one file may run codegen on several threads, which all allocate from the shared space
+    LockHolder lock(mutex_);
     uint8_t *addr = nullptr;
     auto bufBegin = isReq ? reqSecs_ : unreqSecs_;
     auto &curPos = isReq ? reqBufPos_ : unreqBufPos_;
@@ -138,6 +142,7 @@ uint8_t *CodeInfo::CodeSpaceOnDemand::Alloca(uintptr_t size, [[maybe_unused]] bo
         LOG_COMPILER(FATAL) << "malloc section failed.";
         return nullptr;
     }
+    LockHolder lock(mutex_);
     sections_.push_back({addr, alignedSize});
     return addr;
 }
@@ -449,11 +454,21 @@ void LLVMAssembler::BuildAndRunPasses()
     LLVMPassManagerBuilderSetOptLevel(pmBuilder, options_.OptLevel); // using O3 optimization level
     LLVMPassManagerBuilderSetSizeLevel(pmBuilder, 0);
     LLVMPassManagerBuilderSetDisableUnrollLoops(pmBuilder, 0);
+    if (enableVectorize_) {
+        llvm::unwrap(pmBuilder)->LoopVectorize = true;
+        llvm::unwrap(pmBuilder)->SLPVectorize = true;
+    }
 
     // pass manager creation:rs4gc pass is the only pass in modPass, other opt module-based pass are in modPass1
     LLVMPassManagerRef funcPass = LLVMCreateFunctionPassManagerForModule(module_);
     LLVMPassManagerRef modPass = LLVMCreatePassManager();
     LLVMPassManagerRef modPass1 = LLVMCreatePassManager();
+    if (enableVectorize_) {
+        // without the target analysis the cost model of the vectorizers assumes there are no vector registers
+        LLVMTargetMachineRef targetMachine = LLVMGetExecutionEngineTargetMachine(engine_);
+        LLVMAddAnalysisPasses(targetMachine, funcPass);
+        LLVMAddAnalysisPasses(targetMachine, modPass1);
+    }
 
     // add pass into pass managers
     LLVMPassManagerBuilderPopulateFunctionPassManager(pmBuilder, funcPass);
@@ -589,6 +604,7 @@ void LLVMAssembler::Initialize(LOptions option)
     options_.RelMode = static_cast<LLVMRelocMode>(option.relocMode);
     options_.NoFramePointerElim = static_cast<int32_t>(option.genFp);
     options_.CodeModel = LLVMCodeModelSmall;
+    enableVectorize_ = option.vectorize != 0;
 }
 
 static const char *SymbolLookupCallback([[maybe_unused]] void *disInfo, [[maybe_unused]] uint64_t referenceValue,
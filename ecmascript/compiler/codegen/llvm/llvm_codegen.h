@@ -55,10 +55,12 @@ struct LOptions {
     uint32_t optLevel : 2; // 2 bits for optimized level 0-4
     uint32_t genFp : 1; // 1 bit for whether to generated frame pointer or not
     uint32_t relocMode : 3; // 3 bits for relocation mode
+    uint32_t vectorize : 1; // 1 bit for whether to run the loop and slp vectorizers
     // 3: default optLevel, 1: generating fp, 2: PIC mode
-    LOptions() : optLevel(3), genFp(static_cast<uint32_t>(FPFlag::RESERVE_FP)), relocMode(2) {};
-    LOptions(size_t level, FPFlag flag, size_t relocMode)
-        : optLevel(level), genFp(static_cast<uint32_t>(flag)), relocMode(relocMode) {};
+    LOptions() : optLevel(3), genFp(static_cast<uint32_t>(FPFlag::RESERVE_FP)), relocMode(2), vectorize(0) {};
+    LOptions(size_t level, FPFlag flag, size_t relocMode, bool vectorize = false)
+        : optLevel(level), genFp(static_cast<uint32_t>(flag)), relocMode(relocMode),
+          vectorize(static_cast<uint32_t>(vectorize)) {};
 };
 
 class LLVMAssembler : public Assembler {
@@ -124,6 +126,7 @@ private:
     LLVMExecutionEngineRef engine_ {nullptr};
     AOTEventListener listener_;
     char *error_ {nullptr};
+    bool enableVectorize_ {false};
 };
 
 class LLVMIRGeneratorImpl : public CodeGeneratorImpl {
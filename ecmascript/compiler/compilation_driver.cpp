@@ -15,6 +15,7 @@
 
 #include "ecmascript/compiler/compilation_driver.h"
 
+#include "ecmascript/base/hash_combine.h"
 #include "ecmascript/compiler/file_generators.h"
 #include "ecmascript/compiler/pgo_type/pgo_type_manager.h"
 
@@ -56,7 +57,7 @@ void CompilationDriver::IncCompiledMethod()
 
 bool CompilationDriver::IsCurModuleFull() const
 {
-    return (compiledMethodCnt_ % maxMethodsInModule_ == 0);
+    return ((compiledMethodCnt_ - moduleStartMethodCnt_) % maxMethodsInModule_ == 0);
 }
 
 void CompilationDriver::CompileModuleThenDestroyIfNeeded(bool isJitAndCodeSign)
@@ -71,6 +72,46 @@ void CompilationDriver::CompileLastModuleThenDestroyIfNeeded()
     if (!IsCurModuleFull()) {
         fileGenerator_->CompileLatestModuleThenDestroy();
     }
+    fileGenerator_->FinishPendingModules();
+}
+
+size_t CompilationDriver::LayoutMethods(std::vector<uint32_t> &methods) const
+{
+    if (!compilationEnv_->GetJSOptions().IsEnableOptCodeLayout() || !pfDecoder_.IsLoaded()) {
+        return methods.size();
+    }
+    auto &methodList = bytecodeInfo_.GetMethodList();
+    std::vector<std::pair<uint32_t, uint32_t>> hotness;
+    hotness.reserve(methods.size());
+    for (uint32_t methodId : methods) {
+        auto methodLiteral = jsPandaFile_->FindMethodLiteral(methodId);
+        uint32_t count = pfDecoder_.GetMethodCount(jsPandaFile_, methodList.at(methodId).GetRecordName(),
+                                                   methodLiteral);
+        hotness.emplace_back(methodId, count);
+    }
+    // the profile records no call time, methods with the same count keep the order of the bytecode
+    std::sort(hotness.begin(), hotness.end(), [](const auto &a, const auto &b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    size_t hotMethodNum = 0;
+    for (size_t i = 0; i < hotness.size(); i++) {
+        methods[i] = hotness[i].first;
+        if (hotness[i].second > 0) {
+            hotMethodNum++;
+        }
+    }
+    LOG_COMPILER(INFO) << "Code layout of " << jsPandaFile_->GetJSPandaFileDesc() << ": " << hotMethodNum
+                       << " hot methods, " << (methods.size() - hotMethodNum) << " cold methods";
+    return hotMethodNum;
+}
+
+void CompilationDriver::StartColdModules()
+{
+    if (IsCurModuleFull()) {
+        return;
+    }
+    fileGenerator_->CompileLatestModuleThenDestroy();
+    moduleStartMethodCnt_ = compiledMethodCnt_;
 }
 
 std::vector<std::string> CompilationDriver::SplitString(const std::string &str, const char ch) const
@@ -102,6 +143,100 @@ void CompilationDriver::StoreConstantPoolInfo() const
     ptManager->GetAOTSnapshot().StoreConstantPoolInfo(collector_);
 }
 
+uint64_t CompilationDriver::ComputeProfileDigest(const CallMethodFlagMap &callMethodFlagMap) const
+{
+    // the method list is unordered, the digest must not depend on its order
+    std::vector<std::pair<uint32_t, const MethodInfo *>> methods;
+    for (auto &[methodId, methodInfo] : bytecodeInfo_.GetMethodList()) {
+        methods.emplace_back(methodId, &methodInfo);
+    }
+    std::sort(methods.begin(), methods.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    uint64_t digest = 0;
+    for (auto &[methodId, methodInfo] : methods) {
+        auto methodLiteral = jsPandaFile_->FindMethodLiteral(methodId);
+        if (methodLiteral == nullptr) {
+            continue;
+        }
+        bool isAotCompile = callMethodFlagMap.IsAotCompile(jsPandaFile_->GetNormalizedFileDesc(),
+                                                           methodLiteral->GetMethodId().GetOffset());
+        digest = base::HashCombiner::HashCombine(digest, methodId);
+        digest = base::HashCombiner::HashCombine(digest, isAotCompile);
+        // methods which are not compiled may still be inlined, so their profile counts as well
+        pfDecoder_.GetTypeInfo(jsPandaFile_, methodInfo->GetRecordName(), methodLiteral,
+            [&digest](uint32_t offset, const pgo::PGOType *type) {
+                pgo::TextFormatter fmt;
+                if (type->IsScalarOpType()) {
+                    fmt.Text(reinterpret_cast<const pgo::PGOSampleType *>(type)->GetTypeString());
+                } else if (type->IsRwOpType()) {
+                    auto rwType = reinterpret_cast<const pgo::PGORWOpType *>(type);
+                    for (uint32_t i = 0; i < rwType->GetCount(); i++) {
+                        rwType->GetObjectInfo(i).GetInfoString(fmt);
+                    }
+                } else if (type->IsDefineOpType()) {
+                    reinterpret_cast<const pgo::PGODefineOpType *>(type)->GetTypeString(fmt);
+                }
+                digest = base::HashCombiner::HashCombine(digest, offset);
+                digest = base::HashCombiner::HashCombine(digest, std::hash<std::string>{}(fmt.Str()));
+            });
+    }
+    return digest;
+}
+
+bool CompilationDriver::TryReuseCompiledFile(const CallMethodFlagMap &callMethodFlagMap)
+{
+    AOTIncrementalCache *cache = fileGenerator_->GetIncrementalCache();
+    if (cache == nullptr) {
+        return false;
+    }
+    profileDigest_ = ComputeProfileDigest(callMethodFlagMap);
+    firstModuleDes_ = fileGenerator_->GetModuleDesNum();
+    std::string name = jsPandaFile_->GetNormalizedFileDesc().c_str();
+    const AOTIncrementalManifest::FileRecord *record =
+        cache->FindReusableFile(name, jsPandaFile_->GetChecksum(), profileDigest_);
+    if (record == nullptr) {
+        return false;
+    }
+    ReusableAnFile &anFile = cache->GetReusableAnFile();
+    // the methods compiled last time are exactly the ones with an entry, the others were skipped or aborted
+    std::set<uint32_t> compiledMethods;
+    for (uint32_t i = record->firstModule; i < record->firstModule + record->moduleCount; ++i) {
+        const ReusableAnFile::ModuleRegion &region = anFile.GetModule(i);
+        for (uint32_t j = region.startIndex; j < region.startIndex + region.funcCount; ++j) {
+            compiledMethods.insert(anFile.GetEntries()[j].indexInKindOrMethodId_);
+        }
+    }
+    for (auto &[methodId, methodInfo] : bytecodeInfo_.GetMethodList()) {
+        bytecodeInfo_.AddMethodOffsetToRecordName(methodId, methodInfo.GetRecordName());
+        if (compiledMethods.find(methodId) == compiledMethods.end()) {
+            bytecodeInfo_.AddSkippedMethod(methodId);
+            continue;
+        }
+        methodInfo.SetIsCompiled(true);
+        IncCompiledMethod();
+    }
+    fileGenerator_->ReuseModules(anFile, record->firstModule, record->moduleCount);
+    AOTIncrementalManifest::FileRecord newRecord = *record;
+    newRecord.firstModule = firstModuleDes_;
+    cache->RecordFile(name, newRecord, true);
+    LOG_COMPILER(INFO) << "Reuse the code of " << compiledMethods.size() << " methods of " << name;
+    return true;
+}
+
+void CompilationDriver::RecordCompiledFile() const
+{
+    AOTIncrementalCache *cache = fileGenerator_->GetIncrementalCache();
+    if (cache == nullptr) {
+        return;
+    }
+    AOTIncrementalManifest::FileRecord record;
+    record.checksum = jsPandaFile_->GetChecksum();
+    record.profileDigest = profileDigest_;
+    record.firstModule = firstModuleDes_;
+    record.moduleCount = fileGenerator_->GetModuleDesNum() - firstModuleDes_;
+    record.methodCount = compiledMethodCnt_;
+    cache->RecordFile(jsPandaFile_->GetNormalizedFileDesc().c_str(), record, false);
+}
+
 bool JitCompilationDriver::RunCg()
 {
     IncCompiledMethod();
@@ -66,27 +66,42 @@ public:
     void Run(const CallMethodFlagMap &callMethonFlagMap, const Callback &cb)
     {
         SetCurrentCompilationFile();
-        const auto &methodPcInfos = bytecodeInfo_.GetMethodPcInfos();
+        if (TryReuseCompiledFile(callMethonFlagMap)) {
+            StoreConstantPoolInfo();
+            return;
+        }
+        std::vector<uint32_t> compileOrder;
         for (auto &[methodId, methodInfo] : bytecodeInfo_.GetMethodList()) {
             bytecodeInfo_.AddMethodOffsetToRecordName(methodId, methodInfo.GetRecordName());
-            auto &methodPcInfo = methodPcInfos[methodInfo.GetMethodPcInfoIndex()];
             auto methodLiteral = jsPandaFile_->FindMethodLiteral(methodId);
             if (methodLiteral == nullptr) {
                 continue;
             }
-            const std::string methodName(MethodLiteral::GetMethodName(jsPandaFile_, methodLiteral->GetMethodId()));
             if (!callMethonFlagMap.IsAotCompile(jsPandaFile_->GetNormalizedFileDesc(),
                                                 methodLiteral->GetMethodId().GetOffset())) {
                 bytecodeInfo_.AddSkippedMethod(methodId);
-            } else {
-                if (!methodInfo.IsCompiled()) {
-                    methodInfo.SetIsCompiled(true);
-                    CompileMethod(cb, methodInfo.GetRecordName(), methodName, methodLiteral,
-                        methodId, methodPcInfo, methodInfo);
-                }
+            } else if (!methodInfo.IsCompiled()) {
+                methodInfo.SetIsCompiled(true);
+                compileOrder.emplace_back(methodId);
+            }
+        }
+        size_t hotMethodNum = LayoutMethods(compileOrder);
+        const auto &methodPcInfos = bytecodeInfo_.GetMethodPcInfos();
+        auto &methodList = bytecodeInfo_.GetMethodList();
+        for (size_t i = 0; i < compileOrder.size(); i++) {
+            if (i == hotMethodNum) {
+                StartColdModules();
             }
+            uint32_t methodId = compileOrder[i];
+            auto &methodInfo = methodList.at(methodId);
+            auto &methodPcInfo = methodPcInfos[methodInfo.GetMethodPcInfoIndex()];
+            auto methodLiteral = jsPandaFile_->FindMethodLiteral(methodId);
+            const std::string methodName(MethodLiteral::GetMethodName(jsPandaFile_, methodLiteral->GetMethodId()));
+            CompileMethod(cb, methodInfo.GetRecordName(), methodName, methodLiteral,
+                methodId, methodPcInfo, methodInfo);
         }
         CompileLastModuleThenDestroyIfNeeded();
+        RecordCompiledFile();
         StoreConstantPoolInfo();
     }
 
@@ -116,12 +131,28 @@ protected:
 
     void StoreConstantPoolInfo() const;
 
+    // modules are laid out in the an file in the order they are created, and functions inside a module in the
+    // order they are compiled. Sorts the methods by their hit count in the profile, so the profiled methods of the
+    // file come first. Returns the number of methods with a non-zero count, the methods after them are cold.
+    size_t LayoutMethods(std::vector<uint32_t> &methods) const;
+
+    // closes the module of the hot methods, so that no cold method shares a module with them
+    void StartColdModules();
+
+    // incremental aot: the code of a file whose bytecode and profile did not change since the last compilation is
+    // taken over from the last an file, the modules of the other files are recorded for the next compilation
+    uint64_t ComputeProfileDigest(const CallMethodFlagMap &callMethodFlagMap) const;
+    bool TryReuseCompiledFile(const CallMethodFlagMap &callMethodFlagMap);
+    void RecordCompiledFile() const;
+
     CompilationEnv *compilationEnv_ {nullptr};
     const JSPandaFile *jsPandaFile_ {nullptr};
     PGOProfilerDecoder &pfDecoder_;
     BytecodeInfoCollector* collector_;
     BCInfo &bytecodeInfo_;
     uint32_t compiledMethodCnt_ {0};
+    // value of compiledMethodCnt_ when the current module was started early
+    uint32_t moduleStartMethodCnt_ {0};
     AOTFileGenerator *fileGenerator_ {nullptr};
     std::string fileName_ {};
     std::string triple_ {};
@@ -129,6 +160,8 @@ protected:
     CompilerLog *log_ {nullptr};
     bool outputAsm_ {false};
     size_t maxMethodsInModule_ {0};
+    uint64_t profileDigest_ {0};
+    uint32_t firstModuleDes_ {0};
 };
 
 class JitCompilationDriver : public CompilationDriver {
@@ -214,6 +214,22 @@ void CompilerLog::PrintTime() const
     PrintPassTime();
     LOG_COMPILER(INFO) << " ";
     PrintMethodTime();
+    if (!timeCodegenThreadMap_.empty()) {
+        LOG_COMPILER(INFO) << " ";
+        PrintCodegenThreadTime();
+    }
+}
+
+void CompilerLog::PrintCodegenThreadTime() const
+{
+    for (auto &[idx, info] : timeCodegenThreadMap_) {
+        double utilization = codegenWallTime_ > 0 ? info.first / codegenWallTime_ * HUNDRED_TIME : 0;
+        LOG_COMPILER(INFO) << "codegen thread:" << std::setw(OFFSET_LENS) << idx
+                           << " modules:" << std::setw(OFFSET_LENS) << info.second << " busy time is "
+                           << std::setw(TIME_LENS) << info.first << "ms " << "utilization:" << std::fixed
+                           << std::setprecision(PERCENT_LENS) << utilization << "% ";
+    }
+    LOG_COMPILER(INFO) << "codegen threads wall time is " << std::setw(TIME_LENS) << codegenWallTime_ << "ms ";
 }
 
 void CompilerLog::AddMethodTime(const std::string& name, uint32_t id, double time)
@@ -227,6 +243,27 @@ void CompilerLog::AddPassTime(const std::string& name, double time)
     timePassMap_[name] += time;
 }
 
+void CompilerLog::AddCodegenThreadTime(uint32_t threadIdx, double time, uint32_t moduleCount)
+{
+    auto &info = timeCodegenThreadMap_[threadIdx];
+    info.first += time;
+    info.second += moduleCount;
+}
+
+void CompilerLog::AddCodegenWallTime(double time)
+{
+    codegenWallTime_ += time;
+}
+
+uint32_t CompilerLog::GetCodegenModuleCount() const
+{
+    uint32_t count = 0;
+    for (auto &[idx, info] : timeCodegenThreadMap_) {
+        count += info.second;
+    }
+    return count;
+}
+
 double CompilerLog::GetPassTime(const std::string& name) const
 {
     auto it = timePassMap_.find(name);
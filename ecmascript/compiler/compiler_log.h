@@ -122,6 +122,9 @@ public:
     void AddPassTime(const std::string& name, double time);
     double GetPassTime(const std::string& name) const;
     double GetMethodTime(const std::string& name, uint32_t id) const;
+    void AddCodegenThreadTime(uint32_t threadIdx, double time, uint32_t moduleCount);
+    void AddCodegenWallTime(double time);
+    uint32_t GetCodegenModuleCount() const;
     int GetIndex();
 
     std::map<std::string, int> nameIndex_;
@@ -138,6 +141,7 @@ private:
 
     void PrintPassTime() const;
     void PrintMethodTime() const;
+    void PrintCodegenThreadTime() const;
     void PrintTime() const;
 
     int idx_ {0};
@@ -153,6 +157,9 @@ private:
     bool enableCompilerLogAllMethodsTime_ {false};
     std::map<std::string, double> timePassMap_ {};
     std::map<std::pair<uint32_t, std::string>, double> timeMethodMap_ {};
+    // busy time and number of compiled modules of each parallel codegen thread
+    std::map<uint32_t, std::pair<double, uint32_t>> timeCodegenThreadMap_ {};
+    double codegenWallTime_ {0};
 };
 
 class MethodLogList {
@@ -20,6 +20,7 @@
 #include "ecmascript/platform/directory.h"
 #include "ecmascript/platform/os.h"
 #include "ecmascript/snapshot/mem/snapshot.h"
+#include "ecmascript/stackmap/ark_stackmap_parser.h"
 #include "ecmascript/stackmap/llvm/llvm_stackmap_parser.h"
 #ifdef COMPILE_MAPLE
 #include "ecmascript/compiler/codegen/maple/litecg_codegen.h"
@@ -460,6 +461,66 @@ void AOTFileGenerator::CollectCodeInfo(Module *module, uint32_t moduleIdx)
     }
 }
 
+void AOTFileGenerator::ReuseModules(ReusableAnFile &anFile, uint32_t firstModule, uint32_t moduleCount)
+{
+    if (stackMapInfo_ == nullptr) {
+        stackMapInfo_ = new LLVMStackMapInfo();
+    }
+    pgo::ApEntityId abcId = INVALID_INDEX;
+    pgo::PGOProfilerManager::GetInstance()->GetPandaFileId(curCompileFileName_.c_str(), abcId);
+    const std::vector<FuncEntryDes> &entries = anFile.GetEntries();
+    uint8_t *textAddr = anFile.GetTextAddr();
+    uint8_t *stackMapAddr = anFile.GetStackMapAddr();
+    ArkStackMapParser parser;
+    for (uint32_t i = firstModule; i < firstModule + moduleCount; ++i) {
+        const ReusableAnFile::ModuleRegion &region = anFile.GetModule(i);
+        // rodata is addressed pc-relatively, so the region of the module is only moved as a whole
+        aotInfo_.AlignTextSec(AOTFileInfo::PAGE_ALIGN);
+        int64_t delta = static_cast<int64_t>(aotInfo_.GetCurTextSecOffset()) - region.regionOffset;
+        if (region.rodataSizeBeforeText != 0) {
+            aotInfo_.UpdateCurTextSecOffset(region.rodataSizeBeforeText);
+            aotInfo_.AlignTextSec(AOTFileInfo::TEXT_SEC_ALIGN);
+        }
+        uint32_t lastEntryIdx = aotInfo_.GetEntrySize();
+        for (uint32_t j = region.startIndex; j < region.startIndex + region.funcCount; ++j) {
+            FuncEntryDes entry = entries[j];
+            entry.codeAddr_ = static_cast<uint64_t>(static_cast<int64_t>(entry.codeAddr_) + delta);
+            entry.abcIndexInAi_ = abcId;
+            aotInfo_.AddEntry(entry);
+        }
+        aotInfo_.MappingEntryFuncsToAbcFiles(curCompileFileName_, lastEntryIdx, aotInfo_.GetEntrySize());
+        aotInfo_.UpdateCurTextSecOffset(region.textSize);
+        if (region.rodataSizeAfterText != 0) {
+            aotInfo_.AlignTextSec(AOTFileInfo::RODATA_SEC_ALIGN);
+            aotInfo_.UpdateCurTextSecOffset(region.rodataSizeAfterText);
+        }
+
+        ModuleSectionDes des;
+        if (region.rodataSizeBeforeText != 0) {
+            des.SetSecAddrAndSize(ElfSecName::RODATA, reinterpret_cast<uint64_t>(textAddr + region.regionOffset),
+                                  region.rodataSizeBeforeText);
+        }
+        des.SetSecAddrAndSize(ElfSecName::TEXT, reinterpret_cast<uint64_t>(textAddr + region.textOffset),
+                              region.textSize);
+        if (region.rodataSizeAfterText != 0) {
+            des.SetSecAddrAndSize(ElfSecName::RODATA_CST8,
+                                  reinterpret_cast<uint64_t>(textAddr + region.rodataOffsetAfterText),
+                                  region.rodataSizeAfterText);
+        }
+        des.SetSecAddrAndSize(ElfSecName::STRTAB, reinterpret_cast<uint64_t>(anFile.GetStrtabAddr() +
+                              region.strtabOffset), region.strtabSize);
+        des.SetSecAddrAndSize(ElfSecName::SYMTAB, reinterpret_cast<uint64_t>(anFile.GetSymtabAddr() +
+                              region.symtabOffset), region.symtabSize);
+        des.SetStartIndex(lastEntryIdx);
+        des.SetFuncCount(region.funcCount);
+        aotInfo_.AddModuleDes(des);
+        if (stackMapAddr != nullptr) {
+            parser.CollectCallSiteInfos(stackMapAddr, region.textOffset, region.textOffset + region.textSize, delta,
+                                        cfg_.GetTriple(), static_cast<LLVMStackMapInfo &>(*stackMapInfo_));
+        }
+    }
+}
+
 Module* AOTFileGenerator::GetLatestModule()
 {
     return &modulePackage_.back();
@@ -597,6 +658,10 @@ void StubFileGenerator::SaveStubFile(const std::string &filename)
 void AOTFileGenerator::CompileLatestModuleThenDestroy(bool isJit)
 {
     Module *latestModule = GetLatestModule();
+    if (IsParallelCodegen(latestModule, isJit)) {
+        PostLatestModule();
+        return;
+    }
 #ifdef COMPILE_MAPLE
     static uint32_t lastModulePC = 0;
     if (useLiteCG_ && compilationEnv_->IsJitCompiler()) {
@@ -631,6 +696,152 @@ void AOTFileGenerator::CompileLatestModuleThenDestroy(bool isJit)
     latestModule->DestroyModule();
 }
 
+bool AOTFileGenerator::IsParallelCodegen(Module *module, bool isJit) const
+{
+    // litecg places every module right after the code of the previous one, so its modules are compiled in order
+    return codegenThreadNum_ > 1 && !isJit && !compilationEnv_->IsJitCompiler() && module->IsLLVM();
+}
+
+void AOTFileGenerator::PostLatestModule()
+{
+    if (codegenWorkers_ == nullptr) {
+        codegenWorkers_ = std::make_unique<ModuleCodegenWorkers>(codegenThreadNum_);
+    }
+    ASSERT(GetModuleVecSize() > 0);
+    uint32_t latestModuleIdx = GetModuleVecSize() - 1;
+    // modulePackage_ grows while the module is compiled, so the task works on a copy of the module handle
+    Module module = modulePackage_[latestModuleIdx];
+    const CompilerLog &log = *(log_);
+    bool fastCompileMode = compilationEnv_->GetJSOptions().GetFastAOTCompileMode();
+    codegenWorkers_->Post(latestModuleIdx, [module, &log, fastCompileMode]() mutable {
+        module.RunAssembler(log, fastCompileMode);
+    });
+    pendingModules_.push_back(latestModuleIdx);
+    while (!pendingModules_.empty() && (pendingModules_.size() > codegenThreadNum_ * MAX_PENDING_MODULES_PER_THREAD ||
+                                        codegenWorkers_->IsFinished(pendingModules_.front()))) {
+        CollectOldestPendingModule();
+    }
+}
+
+void AOTFileGenerator::CollectOldestPendingModule()
+{
+    uint32_t moduleIdx = pendingModules_.front();
+    pendingModules_.pop_front();
+    codegenWorkers_->WaitFor(moduleIdx);
+    Module *module = &modulePackage_[moduleIdx];
+    {
+        TimeScope timescope("LLVMCodeGen", const_cast<CompilerLog *>(log_));
+        CollectCodeInfo(module, moduleIdx);
+    }
+    module->DestroyModule();
+}
+
+void AOTFileGenerator::FinishPendingModules()
+{
+    if (codegenWorkers_ == nullptr) {
+        return;
+    }
+    while (!pendingModules_.empty()) {
+        CollectOldestPendingModule();
+    }
+    codegenWorkers_->Stop();
+    codegenWorkers_->RecordTime(const_cast<CompilerLog *>(log_));
+    codegenWorkers_.reset();
+}
+
+ModuleCodegenWorkers::ModuleCodegenWorkers(uint32_t threadNum)
+    : busyTime_(threadNum, 0), taskCount_(threadNum, 0)
+{
+    for (uint32_t i = 0; i < threadNum; ++i) {
+        threads_.emplace_back([this, i] {
+            WorkerMain(i);
+        });
+    }
+}
+
+ModuleCodegenWorkers::~ModuleCodegenWorkers()
+{
+    Stop();
+}
+
+void ModuleCodegenWorkers::Post(uint32_t moduleIdx, Task task)
+{
+    LockHolder lock(mutex_);
+    ASSERT(!stopped_);
+    tasks_.emplace_back(moduleIdx, std::move(task));
+    taskCV_.Signal();
+}
+
+bool ModuleCodegenWorkers::IsFinished(uint32_t moduleIdx)
+{
+    LockHolder lock(mutex_);
+    return finished_.find(moduleIdx) != finished_.end();
+}
+
+void ModuleCodegenWorkers::WaitFor(uint32_t moduleIdx)
+{
+    LockHolder lock(mutex_);
+    while (finished_.find(moduleIdx) == finished_.end()) {
+        finishCV_.Wait(&mutex_);
+    }
+    finished_.erase(moduleIdx);
+}
+
+void ModuleCodegenWorkers::Stop()
+{
+    {
+        LockHolder lock(mutex_);
+        if (stopped_) {
+            return;
+        }
+        stopped_ = true;
+        taskCV_.SignalAll();
+    }
+    for (auto &t : threads_) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    wallTime_ = wallClock_.TotalSpentTime();
+}
+
+void ModuleCodegenWorkers::RecordTime(CompilerLog *log) const
+{
+    if (log == nullptr || !log->GetEnableCompilerLogTime()) {
+        return;
+    }
+    for (uint32_t i = 0; i < busyTime_.size(); ++i) {
+        log->AddCodegenThreadTime(i, busyTime_[i], taskCount_[i]);
+    }
+    log->AddCodegenWallTime(wallTime_);
+}
+
+void ModuleCodegenWorkers::WorkerMain(uint32_t workerIdx)
+{
+    while (true) {
+        std::pair<uint32_t, Task> task;
+        {
+            LockHolder lock(mutex_);
+            while (tasks_.empty() && !stopped_) {
+                taskCV_.Wait(&mutex_);
+            }
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        ClockScope clock;
+        task.second();
+        double time = clock.TotalSpentTime();
+        LockHolder lock(mutex_);
+        busyTime_[workerIdx] += time;
+        taskCount_[workerIdx]++;
+        finished_.insert(task.first);
+        finishCV_.SignalAll();
+    }
+}
+
 void AOTFileGenerator::DestroyCollectedStackMapInfo()
 {
     if (stackMapInfo_ != nullptr) {
@@ -16,9 +16,15 @@
 #ifndef ECMASCRIPT_COMPILER_FILE_GENERATORS_H
 #define ECMASCRIPT_COMPILER_FILE_GENERATORS_H
 
+#include <deque>
+#include <functional>
+#include <set>
+#include <thread>
+
 #include "ecmascript/base/number_helper.h"
 #include "ecmascript/common.h"
 #include "ecmascript/compiler/aot_file/aot_file_manager.h"
+#include "ecmascript/compiler/aot_incremental_cache.h"
 #include "ecmascript/compiler/assembler_module.h"
 #include "ecmascript/compiler/codegen/llvm/llvm_codegen.h"
 #include "ecmascript/compiler/codegen/llvm/llvm_ir_builder.h"
@@ -27,6 +33,7 @@
 #include "ecmascript/compiler/jit_compilation_env.h"
 #include "ecmascript/stackmap/cg_stackmap.h"
 #include "ecmascript/mem/machine_code.h"
+#include "ecmascript/platform/mutex.h"
 
 namespace panda::ecmascript::kungfu {
 class Module {
@@ -182,6 +189,44 @@ protected:
     void CollectStackMapDes(ModuleSectionDes& des);
 };
 
+// Runs the llvm optimization and code generation of full aot modules on worker threads, while the compiling thread
+// goes on lowering the methods of the next modules. The owner waits for the modules in the order it posted them.
+class ModuleCodegenWorkers {
+public:
+    using Task = std::function<void()>;
+
+    explicit ModuleCodegenWorkers(uint32_t threadNum);
+    ~ModuleCodegenWorkers();
+
+    NO_COPY_SEMANTIC(ModuleCodegenWorkers);
+    NO_MOVE_SEMANTIC(ModuleCodegenWorkers);
+
+    void Post(uint32_t moduleIdx, Task task);
+    bool IsFinished(uint32_t moduleIdx);
+    // blocks until the task of the module has run
+    void WaitFor(uint32_t moduleIdx);
+    // runs the tasks left and joins the threads
+    void Stop();
+    // adds busy time of every thread and wall time of the workers to log, if compiler-log-time is enabled
+    void RecordTime(CompilerLog *log) const;
+
+private:
+    void WorkerMain(uint32_t workerIdx);
+
+    Mutex mutex_ {};
+    ConditionVariable taskCV_ {};
+    ConditionVariable finishCV_ {};
+    std::deque<std::pair<uint32_t, Task>> tasks_ {};
+    std::set<uint32_t> finished_ {};
+    std::vector<std::thread> threads_ {};
+    // time spent running tasks, and number of tasks run, by every thread
+    std::vector<double> busyTime_ {};
+    std::vector<uint32_t> taskCount_ {};
+    ClockScope wallClock_ {};
+    double wallTime_ {0};
+    bool stopped_ {false};
+};
+
 class AOTFileGenerator : public FileGenerator {
 public:
     AOTFileGenerator(const CompilerLog *log, const MethodLogList *logList, CompilationEnv *env,
@@ -205,6 +250,33 @@ public:
 
     void CompileLatestModuleThenDestroy(bool isJit = false);
 
+    // collects the modules still compiled by codegen workers, in the order they were added
+    void FinishPendingModules();
+
+    void SetCodegenThreadNum(uint32_t threadNum)
+    {
+        codegenThreadNum_ = threadNum;
+    }
+
+    void SetIncrementalCache(AOTIncrementalCache *cache)
+    {
+        incrementalCache_ = cache;
+    }
+
+    AOTIncrementalCache *GetIncrementalCache() const
+    {
+        return incrementalCache_;
+    }
+
+    uint32_t GetModuleDesNum() const
+    {
+        return static_cast<uint32_t>(aotInfo_.GetCodeUnitsNum());
+    }
+
+    // takes the code of the modules [firstModule, firstModule + moduleCount) of the last an file over for the file
+    // being compiled, as if they had been compiled again
+    void ReuseModules(ReusableAnFile &anFile, uint32_t firstModule, uint32_t moduleCount);
+
     void DestroyCollectedStackMapInfo();
 
     bool GenerateMergedStackmapSection();
@@ -259,6 +331,13 @@ private:
 
     uint64_t RollbackTextSize(Module *module);
 
+    bool IsParallelCodegen(Module *module, bool isJit) const;
+    void PostLatestModule();
+    void CollectOldestPendingModule();
+
+    // lowered modules waiting for their codegen is bounded, so that memory does not grow with the size of the abc
+    static constexpr uint32_t MAX_PENDING_MODULES_PER_THREAD = 2;
+
     CGStackMapInfo *stackMapInfo_ = nullptr;
     CompilationEnv *compilationEnv_ {nullptr};
     std::string curCompileFileName_;
@@ -268,6 +347,11 @@ private:
     CodeInfo::CodeSpaceOnDemand jitCodeSpace_ {};
     std::string aotCodeCommentFile_ = "";
     size_t anFileMaxByteSize_ {0_MB};
+    uint32_t codegenThreadNum_ {1};
+    std::unique_ptr<ModuleCodegenWorkers> codegenWorkers_ {nullptr};
+    // index of the modules posted to codegenWorkers_, oldest first
+    std::deque<uint32_t> pendingModules_ {};
+    AOTIncrementalCache *incrementalCache_ {nullptr};
 };
 
 enum class StubFileKind {
@@ -2009,7 +2009,7 @@ bool GateAccessor::IsHeapObjectFromElementsKind(GateRef gate)
     return false;
 }
 
-bool GateAccessor::IsConstString(GateRef gate)
+bool GateAccessor::IsConstString(GateRef gate) const
 {
     OpCode op = GetOpCode(gate);
     if (op == OpCode::JS_BYTECODE) {
@@ -2049,7 +2049,7 @@ bool GateAccessor::UseForTypeOpProfilerGate(GateRef gate) const
     }
 }
 
-uint32_t GateAccessor::GetStringIdFromLdaStrGate(GateRef gate)
+uint32_t GateAccessor::GetStringIdFromLdaStrGate(GateRef gate) const
 {
     ASSERT(GetByteCodeOpcode(gate) == EcmaOpcode::LDA_STR_ID16);
     GateRef stringId = GetValueIn(gate, 0);
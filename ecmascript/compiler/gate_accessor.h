@@ -573,10 +573,10 @@ public:
     bool HasIfExceptionUse(GateRef gate) const;
     bool IsIn(GateRef g, GateRef in) const;
     bool IsHeapObjectFromElementsKind(GateRef gate);
-    bool IsConstString(GateRef gate);
+    bool IsConstString(GateRef gate) const;
     bool IsSingleCharGate(GateRef gate);
     bool UseForTypeOpProfilerGate(GateRef gate) const;
-    uint32_t GetStringIdFromLdaStrGate(GateRef gate);
+    uint32_t GetStringIdFromLdaStrGate(GateRef gate) const;
     bool IsIfOrSwitchRelated(GateRef gate) const;
     uint32_t GetConstpoolId(GateRef gate) const;
     GateRef GetFrameValue(GateRef gate);
@@ -17,6 +17,7 @@
 #include "ecmascript/compiler/builtins/builtins_typedarray_stub_builder.h"
 #include "ecmascript/compiler/rt_call_signature.h"
 #include "ecmascript/compiler/stub_builder-inl.h"
+#include "ecmascript/ic/ic_runtime.h"
 #include "ecmascript/ic/mega_ic_cache.h"
 
 namespace panda::ecmascript::kungfu {
@@ -542,4 +543,71 @@ void ICStubBuilder::TryStoreGlobalICByName(Variable* result, Label* tryFastPath,
         }
     }
 }
+
+// The slot of the `in` operator holds entries of IsInICRuntime, i.e. the receiver hclass and the key, and the proto
+// change marker guarding an answer which was taken from the prototype chain.
+void ICStubBuilder::IsInIC(Variable* result, Label* tryFastPath, Label *slowPath, Label *success)
+{
+    auto env = GetEnvironment();
+    Label receiverIsHeapObject(env);
+    Label tryIC(env);
+    Label isTaggedArray(env);
+    Label notTaggedArray(env);
+    Label loopHead(env);
+    Label loopEnd(env);
+    Label iLessLength(env);
+    Label entryMatched(env);
+    Label checkMarker(env);
+    Label markerNotChanged(env);
+    Label checkNotFound(env);
+    Label hit(env);
+
+    SetLabels(tryFastPath, slowPath, success);
+    BRANCH_LIKELY(TaggedIsHeapObject(receiver_), &receiverIsHeapObject, tryFastPath_);
+    Bind(&receiverIsHeapObject);
+    BRANCH_UNLIKELY(TaggedIsUndefined(profileTypeInfo_), tryFastPath_, &tryIC);
+    Bind(&tryIC);
+    GateRef cachedValue = GetICSlot(glue_, profileTypeInfo_, slotId_);
+    BRANCH(TaggedIsHeapObject(cachedValue), &isTaggedArray, &notTaggedArray);
+    Bind(&notTaggedArray);
+    {
+        // Undefined before the first miss, Hole once the site is megamorphic
+        BRANCH(TaggedIsUndefined(cachedValue), slowPath_, tryFastPath_);
+    }
+    Bind(&isTaggedArray);
+    GateRef hclass = LoadHClass(glue_, receiver_);
+    GateRef length = GetLengthOfTaggedArray(cachedValue);
+    DEFVARIABLE(i, VariableType::INT32(), Int32(0));
+    Jump(&loopHead);
+    LoopBegin(&loopHead);
+    {
+        BRANCH(Int32UnsignedLessThan(*i, length), &iLessLength, slowPath_);
+        Bind(&iLessLength);
+        GateRef cachedHClass = GetValueFromTaggedArray(glue_, cachedValue,
+                                                       Int32Add(*i, Int32(IsInICRuntime::HCLASS_INDEX)));
+        GateRef cachedKey = GetValueFromTaggedArray(glue_, cachedValue, Int32Add(*i, Int32(IsInICRuntime::KEY_INDEX)));
+        BRANCH(BitAnd(Equal(LoadObjectFromWeakRef(cachedHClass), hclass), Equal(cachedKey, propKey_)),
+               &entryMatched, &loopEnd);
+        Bind(&entryMatched);
+        {
+            GateRef marker = GetValueFromTaggedArray(glue_, cachedValue,
+                                                     Int32Add(*i, Int32(IsInICRuntime::MARKER_INDEX)));
+            result->WriteVariable(GetValueFromTaggedArray(glue_, cachedValue,
+                                                          Int32Add(*i, Int32(IsInICRuntime::RESULT_INDEX))));
+            // an own property, or a receiver without prototype, needs no check of the chain
+            BRANCH(TaggedIsHeapObject(marker), &checkMarker, &hit);
+            Bind(&checkMarker);
+            BRANCH(GetHasChanged(marker), slowPath_, &markerNotChanged);
+            Bind(&markerNotChanged);
+            BRANCH(TaggedIsFalse(result->ReadVariable()), &checkNotFound, &hit);
+            Bind(&checkNotFound);
+            BRANCH(GetNotFoundHasChanged(marker), slowPath_, &hit);
+        }
+        Bind(&loopEnd);
+        i = Int32Add(*i, Int32(IsInICRuntime::ENTRY_SIZE));
+        LoopEnd(&loopHead);
+    }
+    Bind(&hit);
+    Jump(success_);
+}
 }  // namespace panda::ecmascript::kungfu
@@ -82,6 +82,7 @@ public:
     void StoreICByValue(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
     void TryLoadGlobalICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
     void TryStoreGlobalICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
+    void IsInIC(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
 private:
     struct PrimitiveLoadICInfo {
         GateRef glue;
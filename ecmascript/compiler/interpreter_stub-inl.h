@@ -708,6 +708,53 @@ void InterpreterStubBuilder::DispatchWithId(GateRef glue, GateRef sp, GateRef pc
     Return();
 }
 
+// Superinstructions: a handler may also run the instruction after its own, when the pair is frequent and the
+// second instruction can neither throw, call the runtime nor be profiled. The runtime and the profiler take the pc
+// from the handler arguments, which still points to the first instruction. The bytecode is left untouched, so a
+// jump to the second instruction of a pair just runs its own handler.
+GateRef InterpreterStubBuilder::CanFuseNextInstruction(GateRef glue, bool skipsTypeProfile)
+{
+    auto env = GetEnvironment();
+    // the debugger has to stop at every instruction
+    GateRef isDebugMode = LoadPrimitive(VariableType::BOOL(), glue,
+        IntPtr(JSThread::GlueData::GetIsDebugModeOffset(env->Is32Bit())));
+    if (!skipsTypeProfile) {
+        return BoolNot(isDebugMode);
+    }
+    // the profiling handlers have to see the skipped instruction to record its operand types
+    GateRef interruptVector = LoadPrimitive(VariableType::INT64(), glue,
+        IntPtr(JSThread::GlueData::GetInterruptVectorOffset(env->IsArch32Bit())));
+    GateRef bcStubStatus = Int64And(Int64LSR(interruptVector, Int64(JSThread::BCStubStatusBits::START_BIT)),
+        Int64((1LU << JSThread::BCStubStatusBits::SIZE) - 1));
+    GateRef isNormalStub = Int64Equal(bcStubStatus, Int64(static_cast<int64_t>(BCStubStatus::NORMAL_BC_STUB)));
+    return BitAnd(BoolNot(isDebugMode), isNormalStub);
+}
+
+// Dispatches the boolean result of a compare. When a jeqz or jnez imm8 follows and does not jump with it, the branch
+// is stepped over at once, which is the common case for loop conditions. A taken branch still goes through the
+// handler of the branch, which updates the hotness counter.
+void InterpreterStubBuilder::DispatchWithFusedBranch(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                                     GateRef profileTypeInfo, GateRef acc, GateRef format)
+{
+    auto env = GetEnvironment();
+    Label checkFusion(env);
+    Label fused(env);
+    Label notFused(env);
+    GateRef branchPc = PtrAdd(pc, format);
+    GateRef branchOpcode = LoadZeroOffsetPrimitive(VariableType::INT8(), branchPc);
+    GateRef isJeqz = Int8Equal(branchOpcode, Int8(static_cast<int8_t>(BytecodeInstruction::Opcode::JEQZ_IMM8)));
+    GateRef isJnez = Int8Equal(branchOpcode, Int8(static_cast<int8_t>(BytecodeInstruction::Opcode::JNEZ_IMM8)));
+    BRANCH(BitOr(BitAnd(isJeqz, TaggedIsTrue(acc)), BitAnd(isJnez, TaggedIsFalse(acc))), &checkFusion, &notFused);
+    Bind(&checkFusion);
+    BRANCH(CanFuseNextInstruction(glue, false), &fused, &notFused);
+    Bind(&fused);
+    // jeqz imm8 and jnez imm8 are of the same size
+    Dispatch(glue, sp, branchPc, constpool, profileTypeInfo, acc,
+             IntPtr(BytecodeInstruction::Size(BytecodeInstruction::Opcode::JEQZ_IMM8)));
+    Bind(&notFused);
+    Dispatch(glue, sp, pc, constpool, profileTypeInfo, acc, format);
+}
+
 #define DISPATCH_LAST(acc)                                                                  \
     DispatchLast(glue, sp, pc, constpool, profileTypeInfo, acc)
 #define DISPATCH(acc)                                                                       \
@@ -750,6 +797,18 @@ void InterpreterStubBuilder::CheckExceptionWithVar(GateRef glue, GateRef sp, Gat
     }
 }
 
+void InterpreterStubBuilder::CheckExceptionWithFusedBranch(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                                           GateRef profileTypeInfo, GateRef acc,
+                                                           GateRef res, GateRef offset)
+{
+    auto env = GetEnvironment();
+    IR_IF (TaggedIsException(res)) {
+        DISPATCH_LAST(acc);
+    } IR_ELSE {
+        DispatchWithFusedBranch(glue, sp, pc, constpool, profileTypeInfo, res, offset);
+    }
+}
+
 void InterpreterStubBuilder::CheckExceptionWithJump(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
                                                     GateRef profileTypeInfo, GateRef acc,
                                                     GateRef res, Label *jump)
@@ -762,6 +821,42 @@ void InterpreterStubBuilder::CheckExceptionWithJump(GateRef glue, GateRef sp, Ga
     }
 }
 
+#if ECMASCRIPT_ENABLE_ARK_STEED
+// Enters the OSR code of the loop closed by the backward jump at pc, once ArkSteed has installed it. The OSR code
+// takes the vregs, env and acc from this frame and runs the function up to its return, so this frame returns its
+// result right away.
+void InterpreterStubBuilder::TryEnterOsrCode(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                             GateRef profileTypeInfo, GateRef acc, GateRef offset)
+{
+    auto env = GetEnvironment();
+    IR_IF_UNLIKELY (BitAnd(Int32LessThan(offset, Int32(0)), BoolNot(TaggedIsUndefined(profileTypeInfo)))) {
+        GateRef osrCodes = Load(VariableType::JS_ANY(), glue, profileTypeInfo,
+                                IntPtr(ProfileTypeInfo::JIT_OSR_OFFSET));
+        IR_IF_UNLIKELY (BoolNot(TaggedIsUndefined(osrCodes))) {
+            GateRef frame = GetFrame(sp);
+            GateRef func = GetFunctionFromFrame(glue, frame);
+            GateRef method = GetMethodFromFunction(glue, func);
+            GateRef firstPC = LoadPrimitive(VariableType::NATIVE_POINTER(), method,
+                IntPtr(Method::NATIVE_POINTER_OR_BYTECODE_ARRAY_OFFSET));
+            GateRef osrOffset = TruncPtrToInt32(PtrSub(pc, firstPC));
+            GateRef codeEntry = CallNGCRuntime(glue, RTSTUB_ID(FindOsrCodeEntry), {glue, profileTypeInfo, osrOffset});
+            IR_IF_UNLIKELY (IntPtrNotEqual(codeEntry, IntPtr(0))) {
+                // the acc is only kept in a register by the handlers
+                SetAccToFrame(glue, frame, acc);
+                SetPcToFrame(glue, frame, pc);
+                GateRef res = CallNGCRuntime(glue, RTSTUB_ID(SteedOsrEntry), {glue, sp, func, codeEntry});
+                IR_IF_UNLIKELY (HasPendingException(glue)) {
+                    DISPATCH_LAST(acc);
+                } IR_ELSE {
+                    DispatchWithId(glue, sp, pc, constpool, profileTypeInfo, res,
+                                   IntPtr(BytecodeStubCSigns::ID_HandleReturn));
+                }
+            }
+        }
+    }
+}
+#endif
+
 GateRef InterpreterStubBuilder::ResolvePropKey(GateRef glue, GateRef prop, const StringIdInfo &info)
 {
     if (!info.IsValid()) {
@@ -116,6 +116,9 @@ void name##StubBuilder::GenerateCircuitImpl(GateRef glue, GateRef sp, GateRef pc
 
 #define DISPATCH(opcode) DISPATCH_BAK(OFFSET, INT_PTR(opcode))
 
+#define DISPATCH_WITH_FUSED_BRANCH(opcode)                                                     \
+    DispatchWithFusedBranch(glue, sp, pc, constpool, profileTypeInfo, *varAcc, INT_PTR(opcode))
+
 #define DISPATCH_LAST()                                                                        \
     DispatchLast(glue, sp, pc, constpool, profileTypeInfo, acc)                                \
 
@@ -169,6 +172,9 @@ void name##StubBuilder::GenerateCircuitImpl(GateRef glue, GateRef sp, GateRef pc
 #define CHECK_EXCEPTION_WITH_VARACC(res, offset)                                          \
     CheckExceptionWithVar(glue, sp, pc, constpool, profileTypeInfo, *varAcc, res, offset)
 
+#define CHECK_EXCEPTION_WITH_FUSED_BRANCH(res, offset)                                    \
+    CheckExceptionWithFusedBranch(glue, sp, pc, constpool, profileTypeInfo, acc, res, offset)
+
 #define CHECK_PENDING_EXCEPTION(res, offset)                                              \
     CheckPendingException(glue, sp, pc, constpool, profileTypeInfo, acc, res, offset)
 
@@ -830,7 +836,7 @@ DECLARE_ASM_HANDLER(HandleEqImm8V8)
     OperationsStubBuilder builder(this, globalEnv);
 #endif
     GateRef result = builder.Equal(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(EQ_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(EQ_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleJequndefinedImm16)
@@ -856,7 +862,7 @@ DECLARE_ASM_HANDLER(HandleNoteqImm8V8)
     OperationsStubBuilder builder(this, globalEnv);
 #endif
     GateRef result = builder.NotEqual(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(NOTEQ_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(NOTEQ_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleLessImm8V8)
@@ -864,7 +870,7 @@ DECLARE_ASM_HANDLER(HandleLessImm8V8)
     GateRef left = GetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_1(pc)));
     OperationsStubBuilder builder(this);
     GateRef result = builder.Less(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(LESS_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(LESS_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleLesseqImm8V8)
@@ -872,7 +878,7 @@ DECLARE_ASM_HANDLER(HandleLesseqImm8V8)
     GateRef left = GetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_1(pc)));
     OperationsStubBuilder builder(this);
     GateRef result = builder.LessEq(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(LESSEQ_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(LESSEQ_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleGreaterImm8V8)
@@ -880,7 +886,7 @@ DECLARE_ASM_HANDLER(HandleGreaterImm8V8)
     GateRef left = GetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_1(pc)));
     OperationsStubBuilder builder(this);
     GateRef result = builder.Greater(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(GREATER_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(GREATER_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleGreatereqImm8V8)
@@ -888,7 +894,7 @@ DECLARE_ASM_HANDLER(HandleGreatereqImm8V8)
     GateRef left = GetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_1(pc)));
     OperationsStubBuilder builder(this);
     GateRef result = builder.GreaterEq(glue, left, acc, callback);
-    CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(GREATEREQ_IMM8_V8));
+    CHECK_EXCEPTION_WITH_FUSED_BRANCH(result, INT_PTR(GREATEREQ_IMM8_V8));
 }
 
 DECLARE_ASM_HANDLER(HandleNop)
@@ -918,6 +924,9 @@ DECLARE_ASM_HANDLER(HandleJmpImm8)
 
     GateRef offset = ReadInstSigned8_0(pc);
     UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+    TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
     DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
 }
 
@@ -928,6 +937,9 @@ DECLARE_ASM_HANDLER(HandleJmpImm16)
 
     GateRef offset = ReadInstSigned16_0(pc);
     UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+    TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
     DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
 }
 
@@ -938,6 +950,9 @@ DECLARE_ASM_HANDLER(HandleJmpImm32)
 
     GateRef offset = ReadInstSigned32_0(pc);
     UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+    TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
     DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
 }
 
@@ -1260,10 +1275,11 @@ DECLARE_ASM_HANDLER(HandleIsinImm8V8)
 {
     GateRef v0 = ReadInst8_1(pc);
     GateRef prop = GetVregValue(glue, sp, ZExtInt8ToPtr(v0));
+    GateRef slotId = ZExtInt8ToInt32(ReadInst8_0(pc));
     GateRef currentEnv = GetEnvFromFrame(glue, GetFrame(sp));
     GateRef globalEnv = GetCurrentGlobalEnv(glue, currentEnv);
-    SetCurrentGlobalEnv(globalEnv);
-    GateRef result = IsIn(glue, prop, acc); // acc is obj
+    AccessObjectStubBuilder builder(this, globalEnv);
+    GateRef result = builder.IsIn(glue, prop, acc, profileTypeInfo, slotId); // acc is obj
     CHECK_EXCEPTION_WITH_ACC(result, INT_PTR(ISIN_IMM8_V8));
 }
 
@@ -1296,7 +1312,7 @@ DECLARE_ASM_HANDLER(HandleStrictnoteqImm8V8)
     OperationsStubBuilder builder(this, globalEnv);
 #endif
     varAcc = builder.StrictNotEqual(glue, left, acc, callback);
-    DISPATCH_WITH_ACC(STRICTNOTEQ_IMM8_V8);
+    DISPATCH_WITH_FUSED_BRANCH(STRICTNOTEQ_IMM8_V8);
 }
 
 DECLARE_ASM_HANDLER(HandleStricteqImm8V8)
@@ -1315,7 +1331,7 @@ DECLARE_ASM_HANDLER(HandleStricteqImm8V8)
     OperationsStubBuilder builder(this, globalEnv);
 #endif
     varAcc = builder.StrictEqual(glue, left, acc, callback);
-    DISPATCH_WITH_ACC(STRICTEQ_IMM8_V8);
+    DISPATCH_WITH_FUSED_BRANCH(STRICTEQ_IMM8_V8);
 }
 
 DECLARE_ASM_HANDLER(HandleResumegenerator)
@@ -2676,12 +2692,44 @@ DECLARE_ASM_HANDLER(HandleLdaStrId16)
     DISPATCH_WITH_ACC(LDA_STR_ID16);
 }
 
+// ldai is mostly followed by a compare with a loop counter, e.g. "ldai 100; less v0; jeqz", so an int compare is
+// done here at once, together with the branch after it.
 DECLARE_ASM_HANDLER(HandleLdaiImm32)
 {
+    auto env = GetEnvironment();
     DEFVARIABLE(varAcc, VariableType::JS_ANY(), acc);
 
     GateRef imm = ReadInst32_0(pc);
     varAcc = IntToTaggedPtr(imm);
+
+    Label isCompare(env);
+    Label isIntCompare(env);
+    Label fused(env);
+    Label notFused(env);
+    GateRef comparePc = PtrAdd(pc, INT_PTR(LDAI_IMM32));
+    GateRef compareOpcode = LoadZeroOffsetPrimitive(VariableType::INT8(), comparePc);
+    GateRef isLess = Int8Equal(compareOpcode, Int8(static_cast<int8_t>(EcmaOpcode::LESS_IMM8_V8)));
+    GateRef isLessEq = Int8Equal(compareOpcode, Int8(static_cast<int8_t>(EcmaOpcode::LESSEQ_IMM8_V8)));
+    GateRef isGreater = Int8Equal(compareOpcode, Int8(static_cast<int8_t>(EcmaOpcode::GREATER_IMM8_V8)));
+    GateRef isGreaterEq = Int8Equal(compareOpcode, Int8(static_cast<int8_t>(EcmaOpcode::GREATEREQ_IMM8_V8)));
+    BRANCH(BitOr(BitOr(isLess, isLessEq), BitOr(isGreater, isGreaterEq)), &isCompare, &notFused);
+    Bind(&isCompare);
+    GateRef left = GetVregValue(glue, sp, ZExtInt8ToPtr(ReadInst8_1(comparePc)));
+    BRANCH(TaggedIsInt(left), &isIntCompare, &notFused);
+    Bind(&isIntCompare);
+    BRANCH(CanFuseNextInstruction(glue, true), &fused, &notFused);
+    Bind(&fused);
+    {
+        GateRef leftInt = TaggedGetInt(left);
+        GateRef result = BitOr(BitOr(BitAnd(isLess, Int32LessThan(leftInt, imm)),
+                                     BitAnd(isLessEq, Int32LessThanOrEqual(leftInt, imm))),
+                               BitOr(BitAnd(isGreater, Int32GreaterThan(leftInt, imm)),
+                                     BitAnd(isGreaterEq, Int32GreaterThanOrEqual(leftInt, imm))));
+        // all four compares are of the same size
+        DispatchWithFusedBranch(glue, sp, comparePc, constpool, profileTypeInfo, BooleanToTaggedBooleanPtr(result),
+                                INT_PTR(LESS_IMM8_V8));
+    }
+    Bind(&notFused);
     DISPATCH_WITH_ACC(LDAI_IMM32);
 }
 
@@ -2726,6 +2774,9 @@ DECLARE_ASM_HANDLER(HandleJeqzImm8)
     {
         GateRef offset = ReadInstSigned8_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
@@ -2764,6 +2815,9 @@ DECLARE_ASM_HANDLER(HandleJeqzImm16)
     {
         GateRef offset = ReadInstSigned16_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
@@ -2802,6 +2856,9 @@ DECLARE_ASM_HANDLER(HandleJeqzImm32)
     {
         GateRef offset = ReadInstSigned32_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
@@ -2840,6 +2897,9 @@ DECLARE_ASM_HANDLER(HandleJnezImm8)
     {
         GateRef offset = ReadInstSigned8_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
@@ -2878,6 +2938,9 @@ DECLARE_ASM_HANDLER(HandleJnezImm16)
     {
         GateRef offset = ReadInstSigned16_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
@@ -2916,6 +2979,9 @@ DECLARE_ASM_HANDLER(HandleJnezImm32)
     {
         GateRef offset = ReadInstSigned32_0(pc);
         UPDATE_HOTNESS(sp, callback);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+        TryEnterOsrCode(glue, sp, pc, constpool, *varProfileTypeInfo, acc, offset);
+#endif
         DISPATCH_BAK(JUMP, SExtInt32ToPtr(offset));
     }
     Bind(&last);
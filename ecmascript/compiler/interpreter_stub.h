@@ -188,6 +188,12 @@ public:
 		                       GateRef profileTypeInfo, GateRef acc, GateRef res, Label *jump);
     inline void CheckExceptionWithVar(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
 		                      GateRef profileTypeInfo, GateRef acc, GateRef res, GateRef offset);
+    inline void CheckExceptionWithFusedBranch(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                              GateRef profileTypeInfo, GateRef acc, GateRef res, GateRef offset);
+#if ECMASCRIPT_ENABLE_ARK_STEED
+    inline void TryEnterOsrCode(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                GateRef profileTypeInfo, GateRef acc, GateRef offset);
+#endif
 
     inline GateRef CheckStackOverflow(GateRef glue, GateRef sp);
     inline GateRef PushArg(GateRef glue, GateRef sp, GateRef value);
@@ -198,6 +204,9 @@ public:
                          GateRef profileTypeInfo, GateRef acc, GateRef format);
     inline void DispatchWithId(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
                                GateRef profileTypeInfo, GateRef acc, GateRef index);
+    inline GateRef CanFuseNextInstruction(GateRef glue, bool skipsTypeProfile);
+    inline void DispatchWithFusedBranch(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
+                                        GateRef profileTypeInfo, GateRef acc, GateRef format);
     inline void DispatchLast(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
                              GateRef profileTypeInfo, GateRef acc);
     inline void DispatchDebugger(GateRef glue, GateRef sp, GateRef pc, GateRef constpool,
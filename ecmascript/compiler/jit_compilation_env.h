@@ -268,6 +268,28 @@ public:
         return INVALID_HEAP_CONSTANT_INDEX;
     }
 
+    // functions loaded by the polymorphic ldobjbyname at bcOffset, one per profiled receiver hclass
+    void RecordPolyCallTarget(uint32_t methodOffset, uint32_t bcOffset, uint32_t callMethodId)
+    {
+        auto &targets = polyCallTargets_[methodOffset][bcOffset];
+        if (std::find(targets.begin(), targets.end(), callMethodId) == targets.end()) {
+            targets.emplace_back(callMethodId);
+        }
+    }
+
+    const std::vector<uint32_t> *GetPolyCallTargets(uint32_t methodOffset, uint32_t bcOffset) const
+    {
+        auto itMethodOffset = polyCallTargets_.find(methodOffset);
+        if (itMethodOffset != polyCallTargets_.end()) {
+            auto &bcOffsetMap = itMethodOffset->second;
+            auto itBcOffset = bcOffsetMap.find(bcOffset);
+            if (itBcOffset != bcOffsetMap.end()) {
+                return &itBcOffset->second;
+            }
+        }
+        return nullptr;
+    }
+
     void RecordHolderHClassIndex2HeapConstantIndex(int32_t holderHClassIndex, uint32_t heapConstantIndex)
     {
         heapConstantInfo_.holderHClassIndex2HeapConstantIndex[holderHClassIndex] = heapConstantIndex;
@@ -314,6 +336,7 @@ private:
         std::unordered_map<uint32_t, std::unordered_map<uint32_t, uint32_t>> ldGlobalByNameBcOffset2HeapConstantIndex;
         std::unordered_map<int32_t, uint32_t> holderHClassIndex2HeapConstantIndex;
     } heapConstantInfo_;
+    std::unordered_map<uint32_t, std::unordered_map<uint32_t, std::vector<uint32_t>>> polyCallTargets_;
     kungfu::LazyDeoptAllDependencies *dependencies_ {nullptr};
 };
 } // namespace panda::ecmascript
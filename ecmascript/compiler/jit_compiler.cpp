@@ -70,6 +70,8 @@ JitCompilationOptions::JitCompilationOptions(JSRuntimeOptions runtimeOptions)
     isEnableNativeInline_ = false;
     isEnableLoweringBuiltin_ = runtimeOptions.IsEnableLoweringBuiltin();
     isEnableLazyDeopt_ = runtimeOptions.IsEnableJitLazyDeopt();
+    isEnableAllocationFolding_ = runtimeOptions.IsEnableAllocationFolding();
+    isEnableOptLoopUnrolling_ = runtimeOptions.IsEnableOptLoopUnrolling();
 }
 
 void JitCompiler::Init(JSRuntimeOptions runtimeOptions)
@@ -102,6 +104,8 @@ void JitCompiler::Init(JSRuntimeOptions runtimeOptions)
             .EnableInlineNative(jitOptions_.isEnableNativeInline_)
             .EnableLoweringBuiltin(jitOptions_.isEnableLoweringBuiltin_)
             .EnableLazyDeopt(jitOptions_.isEnableLazyDeopt_)
+            .EnableAllocationFolding(jitOptions_.isEnableAllocationFolding_)
+            .EnableOptLoopUnrolling(jitOptions_.isEnableOptLoopUnrolling_)
             .Build();
 }
 
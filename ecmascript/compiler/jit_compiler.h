@@ -67,6 +67,8 @@ struct JitCompilationOptions {
     bool isEnableNativeInline_;
     bool isEnableLoweringBuiltin_;
     bool isEnableLazyDeopt_;
+    bool isEnableAllocationFolding_;
+    bool isEnableOptLoopUnrolling_;
 };
 
 class JitCompilerTask final {
@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/loop_unrolling.h"
+
+namespace panda::ecmascript::kungfu {
+bool LoopUnrolling::TryUnroll()
+{
+    if (!IsCandidate()) {
+        return false;
+    }
+    size_t factor = ComputeUnrollFactor();
+    if (factor < 2) {  // 2: at least one copy of the body
+        return false;
+    }
+    return Unroll(factor);
+}
+
+bool LoopUnrolling::IsCandidate()
+{
+    if (loopInfo_->maxDepth != 1) {
+        return false;
+    }
+    bodySet_.insert(loopInfo_->loopBodys.begin(), loopInfo_->loopBodys.end());
+    bool hasElementAccess = false;
+    for (auto gate : bodySet_) {
+        if (acc_.GetOpCode(gate) == OpCode::JS_BYTECODE && !IsAllowedBytecode(gate, hasElementAccess)) {
+            return false;
+        }
+        // values leaving the loop must go through the loop exit, otherwise they would miss the copies
+        if (HasUseOutsideLoop(gate)) {
+            return false;
+        }
+    }
+    return hasElementAccess;
+}
+
+bool LoopUnrolling::IsAllowedBytecode(GateRef gate, bool &hasElementAccess) const
+{
+    EcmaOpcode ecmaOpcode = acc_.GetByteCodeOpcode(gate);
+    switch (ecmaOpcode) {
+        case EcmaOpcode::LDOBJBYVALUE_IMM8_V8:
+        case EcmaOpcode::LDOBJBYVALUE_IMM16_V8:
+        case EcmaOpcode::STOBJBYVALUE_IMM8_V8_V8:
+        case EcmaOpcode::STOBJBYVALUE_IMM16_V8_V8:
+            hasElementAccess = true;
+            return IsTypedArrayAccess(gate);
+        case EcmaOpcode::LDOBJBYNAME_IMM8_ID16:
+        case EcmaOpcode::LDOBJBYNAME_IMM16_ID16:
+            // the length of the typed array
+            return IsTypedArrayAccess(gate);
+        case EcmaOpcode::ADD2_IMM8_V8:
+        case EcmaOpcode::SUB2_IMM8_V8:
+        case EcmaOpcode::MUL2_IMM8_V8:
+        case EcmaOpcode::DIV2_IMM8_V8:
+        case EcmaOpcode::MOD2_IMM8_V8:
+        case EcmaOpcode::AND2_IMM8_V8:
+        case EcmaOpcode::OR2_IMM8_V8:
+        case EcmaOpcode::XOR2_IMM8_V8:
+        case EcmaOpcode::SHL2_IMM8_V8:
+        case EcmaOpcode::SHR2_IMM8_V8:
+        case EcmaOpcode::ASHR2_IMM8_V8:
+        case EcmaOpcode::INC_IMM8:
+        case EcmaOpcode::DEC_IMM8:
+        case EcmaOpcode::NEG_IMM8:
+        case EcmaOpcode::TONUMERIC_IMM8:
+        case EcmaOpcode::TONUMBER_IMM8:
+        case EcmaOpcode::LESS_IMM8_V8:
+        case EcmaOpcode::LESSEQ_IMM8_V8:
+        case EcmaOpcode::GREATER_IMM8_V8:
+        case EcmaOpcode::GREATEREQ_IMM8_V8:
+        case EcmaOpcode::STRICTEQ_IMM8_V8:
+        case EcmaOpcode::STRICTNOTEQ_IMM8_V8:
+        case EcmaOpcode::JEQZ_IMM8:
+        case EcmaOpcode::JEQZ_IMM16:
+        case EcmaOpcode::JEQZ_IMM32:
+        case EcmaOpcode::JNEZ_IMM8:
+        case EcmaOpcode::JNEZ_IMM16:
+        case EcmaOpcode::JNEZ_IMM32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool LoopUnrolling::IsTypedArrayAccess(GateRef gate) const
+{
+    const PGORWOpType *pgoTypes = acc_.TryGetPGOType(gate).GetPGORWOpType();
+    if (pgoTypes->GetCount() == 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < pgoTypes->GetCount(); ++i) {
+        if (!pgoTypes->GetObjectInfo(i).GetReceiverType().IsBuiltinsTypedArray()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The exit test must be a compare of a monotonic induction variable with a loop invariant bound, and the loop must
+// go on while the compare is true. Then the compare being true for the induction variable advanced by
+// (factor - 1) steps means that it is true for all the steps before.
+bool LoopUnrolling::AnalyzeExit()
+{
+    if (loopInfo_->loopBacks.size() != 1 || loopInfo_->loopExits.size() != 1) {
+        return false;
+    }
+    exit_ = loopInfo_->loopExits.front();
+    GateRef exitBranch = acc_.GetState(exit_);
+    OpCode op = acc_.GetOpCode(exitBranch);
+    if (op != OpCode::IF_TRUE && op != OpCode::IF_FALSE) {
+        return false;
+    }
+    jump_ = acc_.GetState(exitBranch);
+    if (acc_.GetOpCode(jump_) != OpCode::JS_BYTECODE || acc_.GetNumValueIn(jump_) != 1) {
+        return false;
+    }
+    switch (acc_.GetByteCodeOpcode(jump_)) {
+        case EcmaOpcode::JEQZ_IMM8:
+        case EcmaOpcode::JEQZ_IMM16:
+        case EcmaOpcode::JEQZ_IMM32:
+            // the jump is taken when the compare is false
+            if (op != OpCode::IF_TRUE) {
+                return false;
+            }
+            break;
+        case EcmaOpcode::JNEZ_IMM8:
+        case EcmaOpcode::JNEZ_IMM16:
+        case EcmaOpcode::JNEZ_IMM32:
+            if (op != OpCode::IF_FALSE) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    if (!AnalyzeExitBranch(exitBranch) || !AnalyzeCompare()) {
+        return false;
+    }
+    return !HasStoreBeforeExit();
+}
+
+bool LoopUnrolling::AnalyzeExitBranch(GateRef exitBranch)
+{
+    exitTest_.insert(jump_);
+    auto uses = acc_.Uses(jump_);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        GateRef use = *it;
+        OpCode op = acc_.GetOpCode(use);
+        if (op != OpCode::IF_TRUE && op != OpCode::IF_FALSE && op != OpCode::DEPEND_RELAY) {
+            return false;
+        }
+        exitTest_.insert(use);
+        if (use == exitBranch || acc_.GetState(use) == exitBranch) {
+            continue;
+        }
+        if (op == OpCode::DEPEND_RELAY) {
+            continueDepend_ = use;
+        } else {
+            continueState_ = use;
+        }
+    }
+    if (continueState_ == Circuit::NullGate() || continueDepend_ == Circuit::NullGate() ||
+        acc_.GetState(continueDepend_) != continueState_) {
+        return false;
+    }
+    // the exit side must lead to the loop exit only, the remainder loop is entered from there
+    auto exitUses = acc_.Uses(exitBranch);
+    for (auto it = exitUses.begin(); it != exitUses.end(); ++it) {
+        GateRef use = *it;
+        if (use == exit_) {
+            continue;
+        }
+        if (acc_.GetOpCode(use) != OpCode::DEPEND_RELAY) {
+            return false;
+        }
+        auto relayUses = acc_.Uses(use);
+        for (auto relayIt = relayUses.begin(); relayIt != relayUses.end(); ++relayIt) {
+            if (acc_.GetOpCode(*relayIt) != OpCode::LOOP_EXIT_DEPEND) {
+                return false;
+            }
+        }
+    }
+    size_t numExitDepend = 0;
+    auto loopExitUses = acc_.Uses(exit_);
+    for (auto it = loopExitUses.begin(); it != loopExitUses.end(); ++it) {
+        if (acc_.GetOpCode(*it) == OpCode::LOOP_EXIT_DEPEND) {
+            numExitDepend++;
+        }
+    }
+    return numExitDepend == 1;
+}
+
+bool LoopUnrolling::AnalyzeCompare()
+{
+    cmp_ = acc_.GetValueIn(jump_, 0);
+    if (acc_.GetOpCode(cmp_) != OpCode::JS_BYTECODE || acc_.GetNumValueIn(cmp_) != 2) {  // 2: left and right
+        return false;
+    }
+    // +1 if the loop goes on while the left operand is below the right one, -1 if while it is above
+    int order = 0;
+    switch (acc_.GetByteCodeOpcode(cmp_)) {
+        case EcmaOpcode::LESS_IMM8_V8:
+        case EcmaOpcode::LESSEQ_IMM8_V8:
+            order = 1;
+            break;
+        case EcmaOpcode::GREATER_IMM8_V8:
+        case EcmaOpcode::GREATEREQ_IMM8_V8:
+            order = -1;
+            break;
+        default:
+            return false;
+    }
+    GateRef left = acc_.GetValueIn(cmp_, 0);
+    GateRef right = acc_.GetValueIn(cmp_, 1);
+    int direction = GetStepDirection(left);
+    if (direction != 0 && IsLoopInvariant(right)) {
+        induction_ = left;
+    } else {
+        // seen from the left operand, an induction variable on the right moves the other way
+        direction = -GetStepDirection(right);
+        if (direction == 0 || !IsLoopInvariant(left)) {
+            return false;
+        }
+        induction_ = right;
+    }
+    // the induction variable must move towards the bound
+    if (direction != order) {
+        return false;
+    }
+    step_ = acc_.GetIn(induction_, 2);  // 2: index of value back
+    // the guard repeats the step and the compare, which must have no side effects to be run in advance
+    return HasNumberType(step_) && HasNumberType(cmp_);
+}
+
+// returns +1 or -1 for an induction variable increased or decreased by every step, 0 for others
+int LoopUnrolling::GetStepDirection(GateRef gate) const
+{
+    if (!IsHeadSelector(gate) || !acc_.IsValueSelector(gate)) {
+        return 0;
+    }
+    GateRef step = acc_.GetIn(gate, 2);  // 2: index of value back
+    if (acc_.GetOpCode(step) != OpCode::JS_BYTECODE) {
+        return 0;
+    }
+    switch (acc_.GetByteCodeOpcode(step)) {
+        case EcmaOpcode::INC_IMM8:
+            return acc_.GetValueIn(step, 0) == gate ? 1 : 0;
+        case EcmaOpcode::DEC_IMM8:
+            return acc_.GetValueIn(step, 0) == gate ? -1 : 0;
+        case EcmaOpcode::ADD2_IMM8_V8: {
+            GateRef left = acc_.GetValueIn(step, 0);
+            GateRef right = acc_.GetValueIn(step, 1);
+            if (left == gate) {
+                return GetConstantSign(right);
+            }
+            return right == gate ? GetConstantSign(left) : 0;
+        }
+        case EcmaOpcode::SUB2_IMM8_V8:
+            // c - i is not monotonic
+            return acc_.GetValueIn(step, 0) == gate ? -GetConstantSign(acc_.GetValueIn(step, 1)) : 0;
+        default:
+            return 0;
+    }
+}
+
+int LoopUnrolling::GetConstantSign(GateRef gate) const
+{
+    if (!acc_.IsConstantNumber(gate)) {
+        return 0;
+    }
+    double value = JSTaggedValue(acc_.GetConstantValue(gate)).GetNumber();
+    if (value > 0) {
+        return 1;
+    }
+    return value < 0 ? -1 : 0;
+}
+
+bool LoopUnrolling::IsLoopInvariant(GateRef gate) const
+{
+    if (bodySet_.count(gate) == 0) {
+        return true;
+    }
+    // the length of a typed array which is not changed in the loop
+    if (acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return false;
+    }
+    switch (acc_.GetByteCodeOpcode(gate)) {
+        case EcmaOpcode::LDOBJBYNAME_IMM8_ID16:
+        case EcmaOpcode::LDOBJBYNAME_IMM16_ID16:
+            return IsTypedArrayAccess(gate) && bodySet_.count(acc_.GetValueIn(gate, 2)) == 0;  // 2: receiver
+        default:
+            return false;
+    }
+}
+
+bool LoopUnrolling::HasNumberType(GateRef gate) const
+{
+    PGOTypeRef type = acc_.TryGetPGOType(gate);
+    return type.IsPGOSampleType() && type.HasNumber();
+}
+
+// The remainder loop starts over the iteration in which the guard failed, so the gates before the exit test run
+// twice and must not write to memory.
+bool LoopUnrolling::HasStoreBeforeExit() const
+{
+    ChunkVector<GateRef> workList(chunk_);
+    ChunkSet<GateRef> visited(chunk_);
+    workList.emplace_back(acc_.GetDep(jump_));
+    while (!workList.empty()) {
+        GateRef gate = workList.back();
+        workList.pop_back();
+        if (bodySet_.count(gate) == 0 || IsHeadSelector(gate) || !visited.insert(gate).second) {
+            continue;
+        }
+        if (acc_.GetOpCode(gate) == OpCode::JS_BYTECODE) {
+            switch (acc_.GetByteCodeOpcode(gate)) {
+                case EcmaOpcode::STOBJBYVALUE_IMM8_V8_V8:
+                case EcmaOpcode::STOBJBYVALUE_IMM16_V8_V8:
+                    return true;
+                default:
+                    break;
+            }
+        }
+        size_t dependCount = acc_.GetDependCount(gate);
+        for (size_t i = 0; i < dependCount; ++i) {
+            workList.emplace_back(acc_.GetDep(gate, i));
+        }
+    }
+    return false;
+}
+
+bool LoopUnrolling::IsHeadSelector(GateRef gate) const
+{
+    return acc_.IsSelector(gate) && acc_.GetState(gate) == loopInfo_->loopHead;
+}
+
+bool LoopUnrolling::HasUseOutsideLoop(GateRef gate)
+{
+    auto uses = acc_.Uses(gate);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        GateRef use = *it;
+        if (bodySet_.count(use) > 0 || use == loopInfo_->loopHead) {
+            continue;
+        }
+        switch (acc_.GetOpCode(use)) {
+            case OpCode::LOOP_BACK:
+            case OpCode::LOOP_EXIT:
+            case OpCode::LOOP_EXIT_DEPEND:
+            case OpCode::LOOP_EXIT_VALUE:
+                continue;
+            default:
+                return true;
+        }
+    }
+    return false;
+}
+
+size_t LoopUnrolling::ComputeUnrollFactor() const
+{
+    size_t size = std::max<size_t>(loopInfo_->size, 1);
+    // the remainder loop is one more copy of the body
+    size_t numCopies = MAX_UNROLLED_LOOP_SIZE / size;
+    return std::min(MAX_UNROLL_FACTOR, numCopies > 0 ? numCopies - 1 : 0);
+}
+
+GateRef LoopUnrolling::CopyGate(GateRef gate)
+{
+    std::vector<GateRef> inList(acc_.GetNumIns(gate), Circuit::NullGate());
+    GateRef newGate = circuit_->NewGate(acc_.GetMetaData(gate), inList);
+    acc_.SetGateType(newGate, acc_.GetGateType(gate));
+    acc_.SetMachineType(newGate, acc_.GetMachineType(gate));
+    if (bcBuilder_ != nullptr && acc_.GetOpCode(gate) == OpCode::JS_BYTECODE) {
+        bcBuilder_->UpdateBcIndexGate(newGate, bcBuilder_->GetBcIndexByGate(gate));
+    }
+    return newGate;
+}
+
+GateRef LoopUnrolling::GetCopy(GateRef gate) const
+{
+    auto it = copies_.find(gate);
+    if (it != copies_.end()) {
+        return it->second;
+    }
+    return gate;
+}
+
+GateRef LoopUnrolling::GetPrevCopy(GateRef gate) const
+{
+    // the first copy continues from the original body
+    auto it = prevCopies_.find(gate);
+    if (it != prevCopies_.end()) {
+        return it->second;
+    }
+    return gate;
+}
+
+void LoopUnrolling::BuildRemainderLoop()
+{
+    GateRef loopHead = loopInfo_->loopHead;
+    GateRef loopBack = loopInfo_->loopBacks.front();
+    GateRef exitDepend = Circuit::NullGate();
+    copies_[loopHead] = CopyGate(loopHead);
+    copies_[loopBack] = CopyGate(loopBack);
+    for (auto gate : bodySet_) {
+        copies_[gate] = CopyGate(gate);
+    }
+    copies_[exit_] = CopyGate(exit_);
+    auto uses = acc_.Uses(exit_);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        OpCode op = acc_.GetOpCode(*it);
+        if (op == OpCode::LOOP_EXIT_DEPEND) {
+            exitDepend = *it;
+        }
+        if (op == OpCode::LOOP_EXIT_DEPEND || op == OpCode::LOOP_EXIT_VALUE) {
+            copies_[*it] = CopyGate(*it);
+        }
+    }
+    ASSERT(exitDepend != Circuit::NullGate());
+    for (auto [gate, copy] : copies_) {
+        if (gate == loopHead || IsHeadSelector(gate)) {
+            continue;
+        }
+        size_t numIns = acc_.GetNumIns(gate);
+        for (size_t i = 0; i < numIns; ++i) {
+            acc_.NewIn(copy, i, GetCopy(acc_.GetIn(gate, i)));
+        }
+    }
+    MoveExitUses();
+
+    // the remainder loop is entered from the exit of the unrolled loop, with the values of the head of the
+    // iteration in which the guard failed
+    GateRef head = copies_.at(loopHead);
+    acc_.NewIn(head, 0, exit_);
+    acc_.NewIn(head, 1, copies_.at(loopBack));
+    for (auto gate : bodySet_) {
+        if (!IsHeadSelector(gate)) {
+            continue;
+        }
+        GateRef entry = exitDepend;
+        if (acc_.IsValueSelector(gate)) {
+            entry = circuit_->NewGate(circuit_->LoopExitValue(), acc_.GetMachineType(gate), {exit_, gate},
+                                      acc_.GetGateType(gate));
+        }
+        GateRef copy = copies_.at(gate);
+        acc_.NewIn(copy, 0, head);
+        acc_.NewIn(copy, 1, entry);
+        acc_.NewIn(copy, 2, GetCopy(acc_.GetIn(gate, 2)));  // 2: index of depend or value back
+    }
+}
+
+// what used to follow the loop now follows the remainder loop
+void LoopUnrolling::MoveExitUses()
+{
+    auto uses = acc_.Uses(exit_);
+    for (auto it = uses.begin(); it != uses.end();) {
+        GateRef use = *it;
+        OpCode op = acc_.GetOpCode(use);
+        if (op == OpCode::LOOP_EXIT_DEPEND || op == OpCode::LOOP_EXIT_VALUE) {
+            ++it;
+            continue;
+        }
+        it = acc_.ReplaceIn(it, copies_.at(exit_));
+    }
+    // only the exit depend and values are left, the exit depend goes on into the remainder loop
+    ChunkVector<GateRef> exitValues(chunk_);
+    auto exitUses = acc_.ConstUses(exit_);
+    for (auto it = exitUses.begin(); it != exitUses.end(); ++it) {
+        acc_.UpdateAllUses(*it, copies_.at(*it));
+        if (acc_.GetOpCode(*it) == OpCode::LOOP_EXIT_VALUE) {
+            exitValues.emplace_back(*it);
+        }
+    }
+    for (auto value : exitValues) {
+        acc_.DeleteGate(value);
+    }
+}
+
+void LoopUnrolling::CopyLoopBody()
+{
+    GateRef loopBack = loopInfo_->loopBacks.front();
+    // the copy starts where the previous iteration goes back to the loop head
+    copies_[loopInfo_->loopHead] = GetPrevCopy(acc_.GetState(loopBack));
+    for (auto gate : bodySet_) {
+        if (IsHeadSelector(gate)) {
+            copies_[gate] = GetPrevCopy(acc_.GetIn(gate, 2));  // 2: index of depend or value back
+        } else if (exitTest_.count(gate) == 0) {
+            copies_[gate] = CopyGate(gate);
+        }
+    }
+    // the guard covers the exit test of the copy, which goes on as if the exit was not taken
+    copies_[continueState_] = copies_.at(acc_.GetState(jump_));
+    copies_[continueDepend_] = copies_.at(acc_.GetDep(jump_));
+    for (auto gate : bodySet_) {
+        if (IsHeadSelector(gate) || exitTest_.count(gate) > 0) {
+            continue;
+        }
+        GateRef copy = copies_.at(gate);
+        size_t numIns = acc_.GetNumIns(gate);
+        for (size_t i = 0; i < numIns; ++i) {
+            acc_.NewIn(copy, i, GetCopy(acc_.GetIn(gate, i)));
+        }
+    }
+}
+
+void LoopUnrolling::UpdateLoopBack()
+{
+    // the last copy is the one going back to the loop head
+    for (auto gate : bodySet_) {
+        if (IsHeadSelector(gate)) {
+            acc_.ReplaceIn(gate, 2, GetPrevCopy(acc_.GetIn(gate, 2)));  // 2: index of depend or value back
+        }
+    }
+    GateRef loopBack = loopInfo_->loopBacks.front();
+    acc_.ReplaceIn(loopBack, 0, GetPrevCopy(acc_.GetState(loopBack)));
+}
+
+GateRef LoopUnrolling::CloneGuardGate(GateRef gate, GateRef value, GateRef state, GateRef depend)
+{
+    GateRef newGate = CopyGate(gate);
+    size_t numIns = acc_.GetNumIns(gate);
+    for (size_t i = 0; i < numIns; ++i) {
+        GateRef in = acc_.GetIn(gate, i);
+        acc_.NewIn(newGate, i, in == induction_ ? value : in);
+    }
+    acc_.ReplaceStateIn(newGate, state);
+    acc_.ReplaceDependIn(newGate, depend);
+    // a deopt in the guard runs the exit test again in the interpreter
+    if (acc_.HasFrameState(gate)) {
+        acc_.ReplaceFrameStateIn(newGate, acc_.GetFrameState(cmp_));
+    }
+    return newGate;
+}
+
+// The original exit test is left in the unrolled loop, but compares the induction variable advanced by
+// (factor - 1) steps.
+void LoopUnrolling::InsertGuard(size_t factor)
+{
+    GateRef state = acc_.GetState(jump_);
+    GateRef depend = acc_.GetDep(jump_);
+    GateRef value = induction_;
+    for (size_t i = 1; i < factor; i++) {
+        value = CloneGuardGate(step_, value, state, depend);
+        state = value;
+        depend = value;
+    }
+    GateRef guard = CloneGuardGate(cmp_, value, state, depend);
+    acc_.ReplaceStateIn(jump_, guard);
+    acc_.ReplaceDependIn(jump_, guard);
+    acc_.ReplaceValueIn(jump_, guard, 0);
+}
+
+bool LoopUnrolling::Unroll(size_t factor)
+{
+    if (bodySet_.empty()) {
+        bodySet_.insert(loopInfo_->loopBodys.begin(), loopInfo_->loopBodys.end());
+    }
+    if (!AnalyzeExit()) {
+        return false;
+    }
+    BuildRemainderLoop();
+    copies_.clear();
+    for (size_t i = 1; i < factor; i++) {
+        CopyLoopBody();
+        prevCopies_.swap(copies_);
+        copies_.clear();
+    }
+    UpdateLoopBack();
+    InsertGuard(factor);
+    Print(factor);
+    return true;
+}
+
+void LoopUnrolling::Print(size_t factor) const
+{
+    if (enableLog_) {
+        LOG_COMPILER(INFO) << "";
+        LOG_COMPILER(INFO) << "\033[34m"
+                           << "===================="
+                           << " After loop unrolling by " << factor << " "
+                           << "[" << methodName_ << "]"
+                           << "===================="
+                           << "\033[0m";
+        circuit_->PrintAllGatesWithBytecode();
+        LOG_COMPILER(INFO) << "\033[34m" << "========================= End ==========================" << "\033[0m";
+    }
+}
+}  // namespace panda::ecmascript::kungfu
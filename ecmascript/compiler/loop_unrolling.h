@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_LOOP_UNROLLING_H
+#define ECMASCRIPT_COMPILER_LOOP_UNROLLING_H
+
+#include "ecmascript/compiler/bytecode_circuit_builder.h"
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/compiler/loop_analysis.h"
+#include "ecmascript/mem/chunk_containers.h"
+
+namespace panda::ecmascript::kungfu {
+// Unrolls small counted loops whose memory accesses only touch typed arrays, e.g.
+//     for (let i = 0; i < a.length; i++) { sum += a[i]; }
+// The loop is turned into an unrolled loop followed by a remainder loop:
+//     for (; i + (factor - 1) < a.length; i += factor) { factor copies of the body }
+//     for (; i < a.length; i++) { the original body }
+// The exit test of the unrolled loop compares the induction variable advanced by (factor - 1) steps, so the copies
+// of the body run without exit tests of their own, as straight-line code in which the later passes share the type
+// and bounds checks of the typed array. The remainder loop is a full copy of the original loop, it is entered from
+// the exit of the unrolled loop and runs the iterations that are left.
+class LoopUnrolling {
+public:
+    LoopUnrolling(BytecodeCircuitBuilder* bcBuilder, Circuit *circuit, bool enableLog,
+                  const std::string& name, Chunk* chunk, LoopInfo* loopInfo)
+        : bcBuilder_(bcBuilder), circuit_(circuit), acc_(circuit), enableLog_(enableLog),
+          methodName_(name), chunk_(chunk), loopInfo_(loopInfo), bodySet_(chunk), exitTest_(chunk),
+          copies_(chunk), prevCopies_(chunk) {}
+    ~LoopUnrolling() = default;
+
+    // unrolls the loop if it is a counted loop over typed arrays, returns whether it did
+    bool TryUnroll();
+    // unrolls the loop by factor and adds the remainder loop, returns false if the exit test can not be guarded
+    bool Unroll(size_t factor);
+
+private:
+    static constexpr size_t MAX_UNROLL_FACTOR = 4;
+    // counted in gates of the loop body, frame states included
+    static constexpr size_t MAX_UNROLLED_LOOP_SIZE = 256;
+
+    bool IsCandidate();
+    bool IsAllowedBytecode(GateRef gate, bool &hasElementAccess) const;
+    bool IsTypedArrayAccess(GateRef gate) const;
+    bool AnalyzeExit();
+    bool AnalyzeExitBranch(GateRef exitBranch);
+    bool AnalyzeCompare();
+    int GetStepDirection(GateRef gate) const;
+    int GetConstantSign(GateRef gate) const;
+    bool IsLoopInvariant(GateRef gate) const;
+    bool HasNumberType(GateRef gate) const;
+    bool HasStoreBeforeExit() const;
+    bool IsHeadSelector(GateRef gate) const;
+    bool HasUseOutsideLoop(GateRef gate);
+    size_t ComputeUnrollFactor() const;
+
+    GateRef CopyGate(GateRef gate);
+    GateRef GetCopy(GateRef gate) const;
+    GateRef GetPrevCopy(GateRef gate) const;
+    void BuildRemainderLoop();
+    void MoveExitUses();
+    void CopyLoopBody();
+    void UpdateLoopBack();
+    GateRef CloneGuardGate(GateRef gate, GateRef value, GateRef state, GateRef depend);
+    void InsertGuard(size_t factor);
+    void Print(size_t factor) const;
+
+    BytecodeCircuitBuilder* bcBuilder_ {nullptr};
+    Circuit* circuit_ {nullptr};
+    GateAccessor acc_;
+    bool enableLog_ {false};
+    std::string methodName_;
+    Chunk* chunk_ {nullptr};
+    LoopInfo* loopInfo_ {nullptr};
+    ChunkSet<GateRef> bodySet_;
+    // the exit test, see AnalyzeExit
+    GateRef exit_ {Circuit::NullGate()};
+    GateRef jump_ {Circuit::NullGate()};
+    GateRef cmp_ {Circuit::NullGate()};
+    GateRef induction_ {Circuit::NullGate()};
+    GateRef step_ {Circuit::NullGate()};
+    // the state and depend the loop goes on with when the exit is not taken
+    GateRef continueState_ {Circuit::NullGate()};
+    GateRef continueDepend_ {Circuit::NullGate()};
+    // the jump, its branches and their depend relays, none of them is copied into the unrolled loop
+    ChunkSet<GateRef> exitTest_;
+    // gates of the copy being built, and of the copy built before it
+    ChunkMap<GateRef, GateRef> copies_;
+    ChunkMap<GateRef, GateRef> prevCopies_;
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_LOOP_UNROLLING_H
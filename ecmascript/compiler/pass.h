@@ -18,6 +18,7 @@
 
 #include "ecmascript/compiler/aot_compilation_env.h"
 #include "ecmascript/compiler/jit_compilation_env.h"
+#include "ecmascript/compiler/allocation_folding.h"
 #include "ecmascript/compiler/async_function_lowering.h"
 #include "ecmascript/compiler/bytecode_circuit_builder.h"
 #include "ecmascript/compiler/codegen/llvm/llvm_codegen.h"
@@ -36,6 +37,7 @@
 #include "ecmascript/compiler/lexical_env_specialization_pass.h"
 #include "ecmascript/compiler/loop_analysis.h"
 #include "ecmascript/compiler/loop_peeling.h"
+#include "ecmascript/compiler/loop_unrolling.h"
 #include "ecmascript/compiler/native_inline_lowering.h"
 #include "ecmascript/compiler/ntype_bytecode_lowering.h"
 #include "ecmascript/compiler/ntype_hcr_lowering.h"
@@ -516,6 +518,28 @@ public:
     }
 };
 
+class AllocationFoldingPass {
+public:
+    bool Run(PassData* data)
+    {
+        PassOptions *passOptions = data->GetPassOptions();
+        if (!passOptions->EnableTypeLowering() || !passOptions->EnableAllocationFolding()) {
+            return false;
+        }
+        TimeScope timescope("AllocationFoldingPass",
+                            data->GetMethodName(),
+                            data->GetMethodOffset(),
+                            data->GetLog(),
+                            data->GetCircuit());
+        bool enableLog = data->GetLog()->EnableMethodCIRLog();
+        Chunk chunk(data->GetNativeAreaAllocator());
+        AllocationFolding allocationFolding(data->GetCircuit(), data->GetCompilerConfig(), enableLog,
+                                            data->GetMethodName(), &chunk);
+        allocationFolding.Run();
+        return true;
+    }
+};
+
 class TSInlineLoweringPass {
 public:
     bool Run(PassData* data)
@@ -693,6 +717,10 @@ public:
                 LoopPeeling(data->GetBuilder(), data->GetCircuit(), enableLog,
                             data->GetMethodName(), &chunk, loopInfo).Peel();
             }
+            if (data->GetPassOptions()->EnableOptLoopUnrolling()) {
+                LoopUnrolling(data->GetBuilder(), data->GetCircuit(), enableLog,
+                              data->GetMethodName(), &chunk, loopInfo).TryUnroll();
+            }
         }
         loopAnalysis.LoopExitElimination();
         return true;
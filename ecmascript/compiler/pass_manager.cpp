@@ -65,6 +65,7 @@ void JitPassManager::RunLitePasses(PassRunner<PassData>& pipeline)
     pipeline.RunPass<LaterEliminationPass>();
     pipeline.RunPass<LCRLoweringPass>();
     pipeline.RunPass<ConstantFoldingPass>();
+    pipeline.RunPass<AllocationFoldingPass>();
     pipeline.RunPass<SlowPathLoweringPass>();
     pipeline.RunPass<GraphLinearizerPass>(!g_isEnableCMCGC);
 }
@@ -110,6 +111,7 @@ void JitPassManager::RunFullPasses(PassRunner<PassData>& pipeline)
     pipeline.RunPass<LCRLoweringPass>();
     pipeline.RunPass<UselessGateEliminationPass>();
     pipeline.RunPass<ConstantFoldingPass>();
+    pipeline.RunPass<AllocationFoldingPass>();
     if (!compilationEnv_->GetJSOptions().IsEnableJitFastCompile()) {
         pipeline.RunPass<ValueNumberingPass>();
     }
@@ -155,7 +157,7 @@ bool JitPassManager::Compile(JSHandle<ProfileTypeInfo> &profileTypeInfo,
         profilerDecoder_);
 
     gen.SetCurrentCompileFileName(jsPandaFile->GetNormalizedFileDesc());
-    lOptions_ = new LOptions(optLevel_, FPFlag::RESERVE_FP, relocMode_);
+    lOptions_ = new LOptions(optLevel_, FPFlag::RESERVE_FP, relocMode_, passOptions_->EnableOptLoopUnrolling());
     cmpDriver_ = new JitCompilationDriver(profilerDecoder_,
                                           collector_,
                                           &gen,
@@ -311,7 +313,7 @@ bool PassManager::Compile(JSPandaFile *jsPandaFile, const std::string &fileName,
         LOG_COMPILER(ERROR) << "The input panda file [" << fileName
                             << "] of AOT Compiler is debuggable version, do not use for performance test!";
     }
-    LOptions lOptions(optLevel_, FPFlag::RESERVE_FP, relocMode_);
+    LOptions lOptions(optLevel_, FPFlag::RESERVE_FP, relocMode_, passOptions_->EnableOptLoopUnrolling());
     CompilationDriver cmpDriver(profilerDecoder_,
                                 &collector,
                                 &gen,
@@ -397,6 +399,7 @@ bool PassManager::Compile(JSPandaFile *jsPandaFile, const std::string &fileName,
         pipeline.RunPass<LCRLoweringPass>();
         pipeline.RunPass<UselessGateEliminationPass>();
         pipeline.RunPass<ConstantFoldingPass>();
+        pipeline.RunPass<AllocationFoldingPass>();
         pipeline.RunPass<ValueNumberingPass>();
         pipeline.RunPass<SlowPathLoweringPass>();
         pipeline.RunPass<ValueNumberingPass>();
@@ -15,6 +15,7 @@
 
 #include "ecmascript/compiler/pgo_type/pgo_type_manager.h"
 
+#include "ecmascript/base/hash_combine.h"
 #include "ecmascript/jspandafile/program_object.h"
 #include "ecmascript/layout_info-inl.h"
 namespace panda::ecmascript::kungfu {
@@ -63,6 +64,58 @@ void PGOTypeManager::InitAOTSnapshot(uint32_t compileFilesCount)
     GenProtoTransitionInfo();
 }
 
+uint64_t PGOTypeManager::ComputeSnapshotDigest() const
+{
+    uint64_t digest = 0;
+    for (auto &[type, index] : profileTyperToHClassIndex_) {
+        digest = base::HashCombiner::HashCombine(digest, type.first.GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, type.second.GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, index);
+    }
+    for (auto &[type, symbolId] : profileTypeToSymbolId_) {
+        digest = base::HashCombiner::HashCombine(digest, std::get<0>(type).GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, std::get<1>(type).GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, std::get<2>(type));
+        digest = base::HashCombiner::HashCombine(digest, symbolId);
+    }
+    // the layout of an hclass decides the field offsets compiled into the code
+    for (auto &root : hcData_) {
+        for (auto &child : root.second) {
+            if (!JSTaggedValue(child.second).IsJSHClass()) {
+                continue;
+            }
+            JSHClass *hclass = JSHClass::Cast(JSTaggedValue(child.second).GetTaggedObject());
+            digest = base::HashCombiner::HashCombine(digest, hclass->GetObjectSize());
+            digest = base::HashCombiner::HashCombine(digest, hclass->GetInlinedProperties());
+            uint32_t len = hclass->NumberOfProps();
+            if (len == 0) {
+                continue;
+            }
+            LayoutInfo *layoutInfo = LayoutInfo::GetLayoutInfoFromHClass(thread_, hclass);
+            for (uint32_t i = 0; i < len; i++) {
+                JSTaggedValue key = layoutInfo->GetKey(thread_, i);
+                uint64_t keyHash = 0;
+                if (key.IsString()) {
+                    keyHash = EcmaStringAccessor(key).GetHashcode(thread_);
+                } else if (key.IsSymbol() && JSSymbol::Cast(key)->HasId()) {
+                    keyHash = JSSymbol::Cast(key)->GetPrivateId();
+                }
+                digest = base::HashCombiner::HashCombine(digest, keyHash);
+                digest = base::HashCombiner::HashCombine(digest, layoutInfo->GetAttr(thread_, i).GetValue());
+            }
+        }
+    }
+    for (uint32_t data : constantIndexData_) {
+        digest = base::HashCombiner::HashCombine(digest, data);
+    }
+    for (auto &transType : protoTransTypes_) {
+        digest = base::HashCombiner::HashCombine(digest, transType.ihcType.GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, transType.transIhcType.GetRaw());
+        digest = base::HashCombiner::HashCombine(digest, transType.transPhcType.GetRaw());
+    }
+    return digest;
+}
+
 uint32_t PGOTypeManager::GetSymbolCountFromHClassData()
 {
     uint32_t count = 0;
@@ -53,6 +53,10 @@ public:
         return aotSnapshot_;
     }
 
+    // compiled code refers to hclasses, symbols and constant indexes by their position in the snapshot, so it may
+    // only be reused by a compilation whose snapshot tables have the same digest
+    uint64_t PUBLIC_API ComputeSnapshotDigest() const;
+
     // array
     void RecordConstantIndex(uint32_t bcAbsoluteOffset, uint32_t index);
 
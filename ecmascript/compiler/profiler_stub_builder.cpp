@@ -254,6 +254,15 @@ void ProfilerStubBuilder::ProfileCall(
                         SetICSlot(VariableType::JS_ANY(), glue, profileTypeInfo, slotId, target);
                         SetICSlot(VariableType::JS_ANY(), glue, profileTypeInfo, slotIdNext, IntToTaggedInt(Int32(1)));
                         TryPreDumpInner(glue, func, profileTypeInfo);
+                    } IR_ELSE {
+                        // Keep counting calls of a polymorphic site, the jit weighs polymorphic inlining with it.
+                        GateRef callCntValue = GetICSlot(glue, profileTypeInfo, slotIdNext);
+                        IR_IF (BitAnd(Int64Equal(slotValue, TaggedInt(PGO_BUILTINS_STUB_ID(NONE))),
+                                      TaggedIsInt(callCntValue))) {
+                            GateRef newCallCnt = Int32Add(TaggedGetInt(callCntValue), Int32(1));
+                            SetICSlot(VariableType::JS_ANY(), glue, profileTypeInfo, slotIdNext,
+                                      IntToTaggedInt(newCallCnt));
+                        }
                     }
                 }
             }
@@ -3310,17 +3310,27 @@ inline GateRef StubBuilder::IsTaggedRepInPropAttr(GateRef attr)
     return BitAnd(BoolNot(IsDoubleRepInPropAttr(rep)), BoolNot(IsIntRepInPropAttr(rep)));
 }
 
-inline GateRef StubBuilder::SetTaggedRepInPropAttr(GateRef attr)
+inline GateRef StubBuilder::SetRepInPropAttr(GateRef attr, Representation rep)
 {
     GateRef mask = Int64LSL(
         Int64((1LU << PropertyAttributes::RepresentationField::SIZE) - 1),
         Int64(PropertyAttributes::RepresentationField::START_BIT));
-    GateRef targetType = Int32(static_cast<uint32_t>(Representation::TAGGED));
+    GateRef targetType = Int32(static_cast<uint32_t>(rep));
     GateRef newVal = Int64Or(Int64And(attr, Int64Not(mask)),
         Int64LSL(ZExtInt32ToInt64(targetType), Int64(PropertyAttributes::RepresentationField::START_BIT)));
     return newVal;
 }
 
+inline GateRef StubBuilder::SetTaggedRepInPropAttr(GateRef attr)
+{
+    return SetRepInPropAttr(attr, Representation::TAGGED);
+}
+
+inline GateRef StubBuilder::SetDoubleRepInPropAttr(GateRef attr)
+{
+    return SetRepInPropAttr(attr, Representation::DOUBLE);
+}
+
 template<class T>
 void StubBuilder::SetHClassBit(GateRef glue, GateRef hClass, GateRef value)
 {
@@ -2030,10 +2030,24 @@ void StubBuilder::SetValueWithAttr(GateRef glue, GateRef obj, GateRef offset, Ga
     Jump(&exit);
     Bind(&repChange);
     {
-        attr = SetTaggedRepInPropAttr(attr);
-        TransitionForRepChange(glue, obj, key, attr);
-        Store(VariableType::JS_ANY(), glue, obj, offset, value);
-        Jump(&exit);
+        Label intToDouble(env);
+        Label toTagged(env);
+        // every int is exact as a double, so an int field which meets a double stays unboxed
+        BRANCH(BitAnd(IsIntRepInPropAttr(rep), TaggedIsDouble(value)), &intToDouble, &toTagged);
+        Bind(&intToDouble);
+        {
+            GateRef doubleAttr = SetDoubleRepInPropAttr(attr);
+            TransitionForRepChange(glue, obj, key, doubleAttr);
+            Store(VariableType::FLOAT64(), glue, obj, offset, GetDoubleOfTDouble(value));
+            Jump(&exit);
+        }
+        Bind(&toTagged);
+        {
+            GateRef taggedAttr = SetTaggedRepInPropAttr(attr);
+            TransitionForRepChange(glue, obj, key, taggedAttr);
+            Store(VariableType::JS_ANY(), glue, obj, offset, value);
+            Jump(&exit);
+        }
     }
     Bind(&exit);
     env->SubCfgExit();
@@ -873,7 +873,9 @@ public:
     GateRef IsIntRepInPropAttr(GateRef attr);
     GateRef IsDoubleRepInPropAttr(GateRef attr);
     GateRef IsTaggedRepInPropAttr(GateRef attr);
+    GateRef SetRepInPropAttr(GateRef attr, Representation rep);
     GateRef SetTaggedRepInPropAttr(GateRef attr);
+    GateRef SetDoubleRepInPropAttr(GateRef attr);
     GateRef SetEnumerableFiledInPropAttr(GateRef attr, GateRef value);
     GateRef SetWritableFieldInPropAttr(GateRef attr, GateRef value);
     GateRef SetConfigurableFieldInPropAttr(GateRef attr, GateRef value);
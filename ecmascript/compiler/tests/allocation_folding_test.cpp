@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ecmascript/compiler/allocation_folding.h"
+#include "ecmascript/compiler/circuit_builder.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/compiler/rt_call_signature.h"
+#include "ecmascript/mem/chunk.h"
+#include "ecmascript/mem/native_area_allocator.h"
+#include "ecmascript/tests/test_helper.h"
+#include "gtest/gtest.h"
+
+namespace panda::test {
+class AllocationFoldingTest : public testing::Test {
+};
+using ecmascript::kungfu::AllocationFolding;
+using ecmascript::kungfu::Circuit;
+using ecmascript::kungfu::CircuitBuilder;
+using ecmascript::kungfu::CompilationConfig;
+using ecmascript::kungfu::Environment;
+using ecmascript::kungfu::Gate;
+using ecmascript::kungfu::GateAccessor;
+using ecmascript::kungfu::GateRef;
+using ecmascript::kungfu::GateType;
+using ecmascript::kungfu::MemoryAttribute;
+using ecmascript::kungfu::OpCode;
+using ecmascript::kungfu::RuntimeStubCSigns;
+using ecmascript::kungfu::VariableType;
+using ecmascript::RegionSpaceFlag;
+
+namespace {
+GateRef NewObject(CircuitBuilder &builder, GateRef glue, size_t size)
+{
+    builder.StartAllocate();
+    GateRef object = builder.HeapAlloc(glue, builder.IntPtr(size), GateType::TaggedValue(),
+                                       RegionSpaceFlag::IN_YOUNG_SPACE);
+    for (size_t offset = 0; offset < size; offset += sizeof(uint64_t)) {
+        builder.Store(VariableType::INT64(), glue, object, builder.IntPtr(offset), builder.Undefined(),
+                      MemoryAttribute::NoBarrier());
+    }
+    return builder.FinishAllocate(object);
+}
+
+size_t CountGates(Circuit &circuit, OpCode op)
+{
+    GateAccessor acc(&circuit);
+    std::vector<GateRef> gates;
+    circuit.GetAllGates(gates);
+    size_t count = 0;
+    for (auto gate : gates) {
+        if (acc.GetOpCode(gate) == op) {
+            count++;
+        }
+    }
+    return count;
+}
+}  // namespace
+
+HWTEST_F_L0(AllocationFoldingTest, FoldAdjacentAllocations)
+{
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    ecmascript::Chunk chunk(&allocator);
+    GateAccessor acc(&circuit);
+    CompilationConfig cmpCfg("x86_64-unknown-linux-gnu");
+    CircuitBuilder builder(&circuit, &cmpCfg);
+    Environment env(0, &builder);
+    builder.SetEnvironment(&env);
+
+    GateRef glue = builder.Arguments(0);
+    constexpr size_t firstSize = 32;
+    constexpr size_t secondSize = 48;
+    GateRef first = NewObject(builder, glue, firstSize);
+    GateRef second = NewObject(builder, glue, secondSize);
+    builder.Store(VariableType::INT64(), glue, second, builder.IntPtr(sizeof(uint64_t)), first,
+                  MemoryAttribute::NoBarrier());
+    builder.Return(second);
+
+    AllocationFolding allocationFolding(&circuit, &cmpCfg, false, "FoldAdjacentAllocations", &chunk);
+    allocationFolding.Run();
+
+    EXPECT_EQ(CountGates(circuit, OpCode::HEAP_ALLOC), 1U);
+    GateRef alloc = acc.GetValueIn(first, 0);
+    EXPECT_EQ(acc.GetOpCode(alloc), OpCode::HEAP_ALLOC);
+    EXPECT_EQ(acc.GetConstantValue(acc.GetValueIn(alloc, 1)), firstSize + secondSize);
+    // the second object is a fresh base computed from the end of the first one
+    GateRef object = acc.GetValueIn(second, 0);
+    EXPECT_EQ(acc.GetOpCode(object), OpCode::INT64_TO_TAGGED);
+}
+
+HWTEST_F_L0(AllocationFoldingTest, KeepOldSpaceAllocations)
+{
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    ecmascript::Chunk chunk(&allocator);
+    CompilationConfig cmpCfg("x86_64-unknown-linux-gnu");
+    CircuitBuilder builder(&circuit, &cmpCfg);
+    Environment env(0, &builder);
+    builder.SetEnvironment(&env);
+
+    GateRef glue = builder.Arguments(0);
+    GateRef first = NewObject(builder, glue, 32);  // 32: object size
+    builder.StartAllocate();
+    GateRef object = builder.HeapAlloc(glue, builder.IntPtr(32), GateType::TaggedValue(),  // 32: object size
+                                       RegionSpaceFlag::IN_OLD_SPACE);
+    builder.Store(VariableType::INT64(), glue, object, builder.IntPtr(sizeof(uint64_t)), first,
+                  MemoryAttribute::NoBarrier());
+    builder.Return(builder.FinishAllocate(object));
+
+    AllocationFolding allocationFolding(&circuit, &cmpCfg, false, "KeepOldSpaceAllocations", &chunk);
+    allocationFolding.Run();
+
+    EXPECT_EQ(CountGates(circuit, OpCode::HEAP_ALLOC), 2U);
+}
+
+HWTEST_F_L0(AllocationFoldingTest, KeepAllocationsWithCallInside)
+{
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    ecmascript::Chunk chunk(&allocator);
+    CompilationConfig cmpCfg("x86_64-unknown-linux-gnu");
+    CircuitBuilder builder(&circuit, &cmpCfg);
+    Environment env(0, &builder);
+    builder.SetEnvironment(&env);
+    RuntimeStubCSigns::Initialize();
+
+    GateRef glue = builder.Arguments(0);
+    GateRef first = NewObject(builder, glue, 32);  // 32: object size
+    builder.StartAllocate();
+    GateRef object = builder.HeapAlloc(glue, builder.IntPtr(32), GateType::TaggedValue(),  // 32: object size
+                                       RegionSpaceFlag::IN_YOUNG_SPACE);
+    // the call may gc, which must not find the second object reserved along with the first one
+    GateRef array = builder.CallRuntime(glue, RuntimeStubCSigns::ID_NewTaggedArray, Gate::InvalidGateRef,
+                                        {builder.Int32ToTaggedInt(builder.Int32(1))}, Circuit::NullGate());
+    builder.Store(VariableType::INT64(), glue, object, builder.IntPtr(sizeof(uint64_t)), array,
+                  MemoryAttribute::NoBarrier());
+    builder.Store(VariableType::INT64(), glue, object, builder.IntPtr(sizeof(uint64_t) * 2), first,  // 2: slot
+                  MemoryAttribute::NoBarrier());
+    builder.Return(builder.FinishAllocate(object));
+
+    AllocationFolding allocationFolding(&circuit, &cmpCfg, false, "KeepAllocationsWithCallInside", &chunk);
+    allocationFolding.Run();
+
+    EXPECT_EQ(CountGates(circuit, OpCode::HEAP_ALLOC), 2U);
+}
+
+HWTEST_F_L0(AllocationFoldingTest, SinkStoreIntoAllocation)
+{
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    ecmascript::Chunk chunk(&allocator);
+    GateAccessor acc(&circuit);
+    CompilationConfig cmpCfg("x86_64-unknown-linux-gnu");
+    CircuitBuilder builder(&circuit, &cmpCfg);
+    Environment env(0, &builder);
+    builder.SetEnvironment(&env);
+
+    GateRef glue = builder.Arguments(0);
+    GateRef value = builder.Arguments(1);
+    constexpr size_t size = 32;
+    GateRef object = NewObject(builder, glue, size);
+    size_t storeCount = CountGates(circuit, OpCode::STORE);
+    builder.Store(VariableType::INT64(), glue, object, builder.IntPtr(sizeof(uint64_t)), value,
+                  MemoryAttribute::NoBarrier());
+    builder.Return(object);
+
+    AllocationFolding allocationFolding(&circuit, &cmpCfg, false, "SinkStoreIntoAllocation", &chunk);
+    allocationFolding.Run();
+
+    // the store now initializes the field, and the store of undefined it overwrites is gone
+    GateRef store = acc.GetDep(object);
+    EXPECT_EQ(acc.GetOpCode(store), OpCode::STORE);
+    EXPECT_EQ(acc.GetValueIn(store, 1), acc.GetValueIn(object, 0));
+    EXPECT_EQ(acc.GetValueIn(store, 3), value);
+    EXPECT_EQ(CountGates(circuit, OpCode::STORE), storeCount);
+}
+}  // namespace panda::test
@@ -13,15 +13,26 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+
 #include "ecmascript/compiler/file_generators.h"
 #include "ecmascript/tests/test_helper.h"
 
 namespace panda::test {
 class AOTFileGeneratorTests : public testing::Test {
 };
+class AOTIncrementalManifestTests : public testing::Test {
+};
 using ecmascript::kungfu::AOTFileGenerator;
+using ecmascript::kungfu::AOTIncrementalCache;
+using ecmascript::kungfu::AOTIncrementalManifest;
 using ecmascript::kungfu::AnFileInfo;
+using ecmascript::kungfu::CodeInfo;
 using ecmascript::kungfu::MachineCodeDesc;
+using ecmascript::kungfu::ModuleCodegenWorkers;
+using ecmascript::kungfu::CompilerLog;
 using ecmascript::CString;
 
 // Test CreateDirIfNotExist with empty path
@@ -121,4 +132,142 @@ HWTEST_F_L0(AOTFileGeneratorTests, GenerateMergedStackmapSection_FailsWhenStackM
     bool result = generator.TestGenerateMergedStackmapSectionWithNullptr();
     ASSERT_EQ(result, false);
 }
+
+// Modules can be waited for in posting order, whatever order the workers finish them in
+HWTEST_F_L0(AOTFileGeneratorTests, ModuleCodegenWorkers_WaitInPostingOrder)
+{
+    constexpr uint32_t moduleNum = 8;
+    std::vector<uint32_t> ran(moduleNum, 0);
+    ModuleCodegenWorkers workers(3);
+    for (uint32_t i = 0; i < moduleNum; ++i) {
+        workers.Post(i, [&ran, i] {
+            ran[i]++;
+        });
+    }
+    for (uint32_t i = 0; i < moduleNum; ++i) {
+        workers.WaitFor(i);
+        ASSERT_EQ(ran[i], 1U);
+    }
+    workers.Stop();
+    for (uint32_t i = 0; i < moduleNum; ++i) {
+        ASSERT_EQ(ran[i], 1U);
+    }
+}
+
+// Stop runs the tasks left before joining the threads, and the busy time of every thread is added to the log
+HWTEST_F_L0(AOTFileGeneratorTests, ModuleCodegenWorkers_StopRunsPendingTasks)
+{
+    std::atomic<uint32_t> count {0};
+    ModuleCodegenWorkers workers(2);
+    for (uint32_t i = 0; i < 4; ++i) {
+        workers.Post(i, [&count] {
+            count++;
+        });
+    }
+    workers.Stop();
+    ASSERT_EQ(count.load(), 4U);
+    ASSERT_TRUE(workers.IsFinished(3));
+
+    CompilerLog log("none");
+    log.SetEnableCompilerLogTime(true);
+    workers.RecordTime(&log);
+    ASSERT_EQ(log.GetCodegenModuleCount(), 4U);
+    workers.RecordTime(nullptr);
+    ASSERT_EQ(log.GetCodegenModuleCount(), 4U);
+
+    CompilerLog disabledLog("none");
+    workers.RecordTime(&disabledLog);
+    ASSERT_EQ(disabledLog.GetCodegenModuleCount(), 0U);
+}
+
+// Assemblers of modules compiled on different threads allocate their sections from the one shared code space of
+// aot, and none of the sections may overlap
+HWTEST_F_L0(AOTFileGeneratorTests, ModuleCodegenWorkers_SharedCodeSpaceSectionsDoNotOverlap)
+{
+    constexpr uint32_t moduleNum = 8;
+    constexpr uint32_t sectionNum = 64;
+    constexpr size_t alignSize = 16;
+    using Range = std::pair<uintptr_t, uintptr_t>;
+    std::vector<std::vector<Range>> ranges(moduleNum);
+    ModuleCodegenWorkers workers(4);
+    for (uint32_t i = 0; i < moduleNum; ++i) {
+        workers.Post(i, [&ranges, i] {
+            for (uint32_t j = 0; j < sectionNum; ++j) {
+                uintptr_t size = 8 * (j % 5 + 1);  // 8, 5: sections of different sizes
+                bool isReq = (j % 2) == 0;
+                uint8_t *addr = CodeInfo::CodeSpace::GetInstance()->Alloca(size, isReq, alignSize);
+                ranges[i].emplace_back(reinterpret_cast<uintptr_t>(addr), reinterpret_cast<uintptr_t>(addr) + size);
+            }
+        });
+    }
+    workers.Stop();
+
+    std::vector<Range> all;
+    for (auto &moduleRanges : ranges) {
+        ASSERT_EQ(moduleRanges.size(), sectionNum);
+        all.insert(all.end(), moduleRanges.begin(), moduleRanges.end());
+    }
+    std::sort(all.begin(), all.end());
+    for (size_t i = 1; i < all.size(); ++i) {
+        ASSERT_LE(all[i - 1].second, all[i].first);
+    }
+}
+
+// A manifest is read back as it was written, abc names with spaces included
+HWTEST_F_L0(AOTIncrementalManifestTests, Manifest_DumpAndParse)
+{
+    AOTIncrementalManifest manifest(0x1234567890abcdefULL);
+    manifest.SetAnDigest(42);
+    AOTIncrementalManifest::FileRecord record;
+    record.checksum = 7;
+    record.profileDigest = 0xffffffffffffffffULL;
+    record.firstModule = 3;
+    record.moduleCount = 2;
+    record.methodCount = 100;
+    manifest.AddFile("/data/app/entry module.abc", record);
+    manifest.AddFile("/data/app/lib.abc", AOTIncrementalManifest::FileRecord {});
+
+    std::stringstream stream;
+    manifest.Dump(stream);
+    AOTIncrementalManifest parsed;
+    ASSERT_TRUE(parsed.Parse(stream));
+    ASSERT_EQ(parsed.GetFingerprint(), 0x1234567890abcdefULL);
+    ASSERT_EQ(parsed.GetAnDigest(), 42U);
+    ASSERT_EQ(parsed.GetFileCount(), 2U);
+    const AOTIncrementalManifest::FileRecord *found = parsed.FindFile("/data/app/entry module.abc");
+    ASSERT_NE(found, nullptr);
+    ASSERT_EQ(found->checksum, 7U);
+    ASSERT_EQ(found->profileDigest, 0xffffffffffffffffULL);
+    ASSERT_EQ(found->firstModule, 3U);
+    ASSERT_EQ(found->moduleCount, 2U);
+    ASSERT_EQ(found->methodCount, 100U);
+    ASSERT_EQ(parsed.FindFile("/data/app/missing.abc"), nullptr);
+}
+
+// Manifests of another format or cut short are not used
+HWTEST_F_L0(AOTIncrementalManifestTests, Manifest_RejectBroken)
+{
+    std::stringstream otherVersion("ark-aot-incremental 2\nfingerprint 1\nan 2\n");
+    ASSERT_FALSE(AOTIncrementalManifest().Parse(otherVersion));
+    std::stringstream noDigest("ark-aot-incremental 1\nfingerprint 1\n");
+    ASSERT_FALSE(AOTIncrementalManifest().Parse(noDigest));
+    std::stringstream truncated("ark-aot-incremental 1\nfingerprint 1\nan 2\nfile 1 2 3\n");
+    ASSERT_FALSE(AOTIncrementalManifest().Parse(truncated));
+    std::stringstream noName("ark-aot-incremental 1\nfingerprint 1\nan 2\nfile 1 2 3 4 5\n");
+    ASSERT_FALSE(AOTIncrementalManifest().Parse(noName));
+    std::stringstream unknown("ark-aot-incremental 1\nfingerprint 1\nan 2\nmodule 1\n");
+    ASSERT_FALSE(AOTIncrementalManifest().Parse(unknown));
+}
+
+// Every compile option takes part in the fingerprint, the path of the compiler does not
+HWTEST_F_L0(AOTIncrementalManifestTests, Cache_Fingerprint)
+{
+    const char *argv1[] = {"/a/ark_aot_compiler", "--compiler-opt-level=2", "entry.abc"};
+    const char *argv2[] = {"/b/ark_aot_compiler", "--compiler-opt-level=2", "entry.abc"};
+    const char *argv3[] = {"/a/ark_aot_compiler", "--compiler-opt-level=3", "entry.abc"};
+    uint64_t fingerprint = AOTIncrementalCache::ComputeFingerprint(3, argv1, 5);
+    ASSERT_EQ(fingerprint, AOTIncrementalCache::ComputeFingerprint(3, argv2, 5));
+    ASSERT_NE(fingerprint, AOTIncrementalCache::ComputeFingerprint(3, argv3, 5));
+    ASSERT_NE(fingerprint, AOTIncrementalCache::ComputeFingerprint(3, argv1, 6));
+}
 }  // namespace panda::test
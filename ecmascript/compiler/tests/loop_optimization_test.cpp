@@ -19,6 +19,7 @@
 #include "ecmascript/compiler/graph_editor.h"
 #include "ecmascript/compiler/loop_analysis.h"
 #include "ecmascript/compiler/loop_peeling.h"
+#include "ecmascript/compiler/loop_unrolling.h"
 #include "ecmascript/compiler/pass.h"
 #include "ecmascript/compiler/stub_builder.h"
 #include "ecmascript/compiler/type.h"
@@ -50,6 +51,8 @@ using ecmascript::kungfu::Verifier;
 using ecmascript::kungfu::LoopAnalysis;
 using ecmascript::kungfu::Environment;
 using ecmascript::kungfu::LoopPeeling;
+using ecmascript::kungfu::LoopUnrolling;
+using ecmascript::kungfu::EcmaOpcode;
 using ecmascript::kungfu::EarlyElimination;
 using ecmascript::kungfu::CombinedPassVisitor;
 using ecmascript::kungfu::TypedBinOp;
@@ -226,4 +229,105 @@ HWTEST_F_L0(LoopOptimizationTest, LoopLoadConstOptimizationTest)
     EXPECT_EQ(linearizer2.GetStateOfSchedulableGate(invariant), loopEntry);
     EXPECT_EQ(acc.GetOpCode(linearizer2.GetStateOfSchedulableGate(variant)), OpCode::LOOP_BACK);
 }
+
+HWTEST_F_L0(LoopOptimizationTest, LoopBytecodeSumUnrollingTest)
+{
+    // for (let i = start; i < n; i++) { sum = sum + i; }, as built from the bytecodes
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    ecmascript::Chunk chunk(&allocator);
+    GateAccessor acc(&circuit);
+    CircuitBuilder builder(&circuit);
+    Environment env(0, &builder);
+    builder.SetEnvironment(&env);
+    auto start = builder.Arguments(1);
+    auto n = builder.Arguments(2);
+    PGOSampleType intType(PGOSampleType::Type::INT);
+    auto newBytecode = [&circuit, &acc, &intType](EcmaOpcode opcode, const std::vector<GateRef> &inList) {
+        size_t numValueIn = inList.size() - 2;  // 2: state and depend
+        auto meta = circuit.JSBytecode(numValueIn, 0, opcode, 0, 0, true, false, 0);
+        GateRef gate = circuit.NewGate(meta, MachineType::I64, inList, GateType::AnyType());
+        acc.TrySetPGOType(gate, PGOTypeRef(static_cast<const PGOSampleType *>(&intType)));
+        return gate;
+    };
+
+    auto loopBegin = circuit.NewGate(circuit.LoopBegin(2), {circuit.GetStateRoot(), Circuit::NullGate()});
+    auto dependSelector = circuit.NewGate(circuit.DependSelector(2),
+                                          {loopBegin, circuit.GetDependRoot(), Circuit::NullGate()});
+    auto index = circuit.NewGate(circuit.ValueSelector(2), MachineType::I64,
+                                 {loopBegin, start, Circuit::NullGate()}, GateType::AnyType());
+    auto sum = circuit.NewGate(circuit.ValueSelector(2), MachineType::I64,
+                               {loopBegin, start, Circuit::NullGate()}, GateType::AnyType());
+    auto less = newBytecode(EcmaOpcode::LESS_IMM8_V8, {loopBegin, dependSelector, index, n});
+    auto jump = circuit.NewGate(circuit.JSBytecode(1, 0, EcmaOpcode::JEQZ_IMM8, 0, 0, true, false, 0),
+                                MachineType::NOVALUE, {less, less, less}, GateType::Empty());
+    auto ifTrue = circuit.NewGate(circuit.IfTrue(), {jump});
+    auto ifFalse = circuit.NewGate(circuit.IfFalse(), {jump});
+    auto trueRelay = circuit.NewGate(circuit.DependRelay(), {ifTrue, jump});
+    auto falseRelay = circuit.NewGate(circuit.DependRelay(), {ifFalse, jump});
+    auto add = newBytecode(EcmaOpcode::ADD2_IMM8_V8, {ifFalse, falseRelay, sum, index});
+    auto inc = newBytecode(EcmaOpcode::INC_IMM8, {add, add, index});
+    auto loopBack = circuit.NewGate(circuit.LoopBack(), {inc});
+    acc.NewIn(loopBegin, 1, loopBack);
+    acc.NewIn(dependSelector, 2, inc);
+    acc.NewIn(index, 2, inc);
+    acc.NewIn(sum, 2, add);
+    auto loopExit = circuit.NewGate(circuit.LoopExit(), {ifTrue});
+    auto exitDepend = circuit.NewGate(circuit.LoopExitDepend(), {loopExit, trueRelay});
+    auto exitValue = circuit.NewGate(circuit.LoopExitValue(), MachineType::I64, {loopExit, sum},
+                                     GateType::AnyType());
+    auto ret = circuit.NewGate(circuit.Return(), {loopExit, exitDepend, exitValue, circuit.GetReturnRoot()});
+
+    LoopAnalysis analysis(nullptr, &circuit, &chunk);
+    ecmascript::kungfu::LoopInfo loopInfo(&chunk, loopBegin);
+    analysis.CollectLoopBody(&loopInfo);
+    constexpr size_t factor = 2;
+    EXPECT_TRUE(LoopUnrolling(nullptr, &circuit, false, "LoopBytecodeSumUnrollingTest", &chunk, &loopInfo)
+        .Unroll(factor));
+    EXPECT_TRUE(Verifier::Run(&circuit));
+
+    auto countBytecodes = [&acc](const ecmascript::kungfu::LoopInfo &info, EcmaOpcode opcode) {
+        size_t count = 0;
+        for (auto gate : info.loopBodys) {
+            if (acc.GetOpCode(gate) == OpCode::JS_BYTECODE && acc.GetByteCodeOpcode(gate) == opcode) {
+                count++;
+            }
+        }
+        return count;
+    };
+    // the unrolled loop runs the body twice behind a single exit test
+    ecmascript::kungfu::LoopInfo unrolled(&chunk, loopBegin);
+    analysis.CollectLoopBody(&unrolled);
+    EXPECT_EQ(unrolled.loopBacks.size(), 1U);
+    EXPECT_EQ(unrolled.loopExits.size(), 1U);
+    EXPECT_EQ(countBytecodes(unrolled, EcmaOpcode::ADD2_IMM8_V8), factor);
+    EXPECT_EQ(countBytecodes(unrolled, EcmaOpcode::JEQZ_IMM8), 1U);
+    // which tests i + 1 < n
+    GateRef guard = acc.GetValueIn(jump, 0);
+    EXPECT_NE(guard, less);
+    EXPECT_EQ(acc.GetByteCodeOpcode(guard), EcmaOpcode::LESS_IMM8_V8);
+    GateRef next = acc.GetValueIn(guard, 0);
+    EXPECT_EQ(acc.GetByteCodeOpcode(next), EcmaOpcode::INC_IMM8);
+    EXPECT_EQ(acc.GetValueIn(next, 0), index);
+    EXPECT_EQ(acc.GetValueIn(guard, 1), n);
+
+    // the remainder loop is entered from the exit of the unrolled loop, and the return follows it
+    GateRef remainderHead = Circuit::NullGate();
+    auto exitUses = acc.ConstUses(loopExit);
+    for (auto it = exitUses.begin(); it != exitUses.end(); ++it) {
+        if (acc.GetOpCode(*it) == OpCode::LOOP_BEGIN) {
+            remainderHead = *it;
+        }
+    }
+    ASSERT_NE(remainderHead, Circuit::NullGate());
+    ecmascript::kungfu::LoopInfo remainder(&chunk, remainderHead);
+    analysis.CollectLoopBody(&remainder);
+    EXPECT_EQ(remainder.loopExits.size(), 1U);
+    EXPECT_EQ(countBytecodes(remainder, EcmaOpcode::ADD2_IMM8_V8), 1U);
+    EXPECT_EQ(countBytecodes(remainder, EcmaOpcode::JEQZ_IMM8), 1U);
+    EXPECT_EQ(acc.GetState(ret), remainder.loopExits.front());
+    GateRef result = acc.GetValueIn(ret, 0);
+    EXPECT_EQ(acc.GetOpCode(result), OpCode::LOOP_EXIT_VALUE);
+    EXPECT_EQ(acc.GetState(result), remainder.loopExits.front());
+}
 } // namespace panda::test
@@ -163,5 +163,80 @@ void ArkSteedCall::SteedCallWithArgVAndPushArgv(ExtendedAssembler *assembler)
     OptimizedCall::GenJSCallWithArgV(assembler, RTSTUB_ID(SteedCallAndPushArgv));
 }
 
+// Entry state for SteedOsrEntry (CCallConv, called from the back edge of an interpreted loop):
+//   x0 = glue
+//   x1 = sp of the interpreted frame
+//   x2 = call-target
+//   x3 = OSR code entry
+//
+// The OSR code loads everything live at the loop header from the interpreted frame, so no user arguments are
+// passed. The caller layout of SteedCallAndPushArgv is still built, with the declared arguments set to undefined,
+// so that the SteedFunctionFrame stays walkable. The OSR code expects the interpreted sp in x0.
+// An asm interpreter bridge frame links the OSR code frames back to the interpreted frame for the stack walk.
+void ArkSteedCall::SteedOsrEntry(ExtendedAssembler *assembler)
+{
+    __ BindAssemblerStub(RTSTUB_ID(SteedOsrEntry));
+    Label target;
+
+    PushAsmInterpBridgeFrame(assembler);
+    __ Bl(&target);
+    PopAsmInterpBridgeFrame(assembler);
+    __ Ret();
+    __ Bind(&target);
+
+    Register glue = x0;
+    Register interpretedSp = x1;
+    Register jsfunc = x2;
+    Register codeAddr = x3;
+    Register currentSp = x5;
+    Register method = x6;
+    Register expectedNumArgs = x7;
+    Register reservedSlots = x22;
+    Label invokeOsrCode;
+
+    __ Ldr(method, MemoryOperand(jsfunc, JSFunction::METHOD_OFFSET));
+    __ Ldr(expectedNumArgs, MemoryOperand(method, Method::CALL_FIELD_OFFSET));
+    __ Lsr(expectedNumArgs, expectedNumArgs, Method::NumArgsBits::START_BIT);
+    __ And(expectedNumArgs, expectedNumArgs,
+        LogicalImmediate::Create(
+            Method::NumArgsBits::Mask() >> Method::NumArgsBits::START_BIT, X_REG_SIZE));
+
+    OptimizedCall::PushOptimizedArgsConfigFrame(assembler);
+    __ CalleeSave();
+    // [argc][call-target][new-target][this][undefined...]
+    __ Add(reservedSlots, expectedNumArgs, Immediate(NUM_MANDATORY_JSFUNC_ARGS + 1));
+    OptimizedCall::IncreaseStackForArguments(assembler, reservedSlots, currentSp);
+    __ Cbz(expectedNumArgs, &invokeOsrCode);
+    {
+        TempRegister1Scope scope1(assembler);
+        Register undefinedValue = __ TempRegister1();
+        PushUndefinedWithArgc(assembler, glue, expectedNumArgs, undefinedValue, currentSp, nullptr, nullptr);
+    }
+    __ Bind(&invokeOsrCode);
+    {
+        TempRegister1Scope scope1(assembler);
+        Register value = __ TempRegister1();
+        __ Mov(value, Immediate(JSTaggedValue::VALUE_UNDEFINED));
+        OptimizedCall::PushMandatoryJSArgs(assembler, jsfunc, value, value, currentSp);
+        __ Mov(value, Immediate(NUM_MANDATORY_JSFUNC_ARGS));
+        __ Str(value, MemoryOperand(currentSp, -FRAME_SLOT_SIZE, AddrMode::PREINDEX));
+        __ Mov(x20, jsfunc);
+        __ Ldr(x19, MemoryOperand(x20, JSFunction::LEXICAL_ENV_OFFSET));
+        __ Mov(x0, interpretedSp);
+        __ Blr(codeAddr);
+    }
+
+    __ Add(sp, sp, Operand(reservedSlots, UXTW, FRAME_SLOT_SIZE_LOG2));
+    __ Mov(x10, sp);
+    __ Tst(x10, LogicalImmediate::Create(0xf, X_REG_SIZE));
+    Label aligned;
+    __ B(Condition::EQ, &aligned);
+    __ Add(sp, sp, Immediate(FRAME_SLOT_SIZE));
+    __ Bind(&aligned);
+    __ CalleeRestore();
+    OptimizedCall::PopOptimizedArgsConfigFrame(assembler);
+    __ Ret();
+}
+
 #undef __
 }  // namespace panda::ecmascript::aarch64
@@ -333,6 +333,7 @@ public:
     static void ArkSteedCallEntry(ExtendedAssembler *assembler);
     static void SteedCallAndPushArgv(ExtendedAssembler *assembler);
     static void SteedCallWithArgVAndPushArgv(ExtendedAssembler *assembler);
+    static void SteedOsrEntry(ExtendedAssembler *assembler);
 };
 
 }  // namespace panda::ecmascript::aarch64
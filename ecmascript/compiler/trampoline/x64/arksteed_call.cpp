@@ -277,5 +277,93 @@ void ArkSteedCall::SteedCallWithArgVAndPushArgv(ExtendedAssembler *assembler)
     OptimizedCall::GenJSCallWithArgV(assembler, RTSTUB_ID(SteedCallAndPushArgv));
 }
 
+// Entry state for SteedOsrEntry (CCallConv, called from the back edge of an interpreted loop):
+//   rdi = glue
+//   rsi = sp of the interpreted frame
+//   rdx = call-target
+//   rcx = OSR code entry
+//
+// The OSR code loads everything live at the loop header from the interpreted frame, so no user arguments are
+// passed. The caller layout of SteedCallAndPushArgv is still built, with the declared arguments set to undefined,
+// so that the SteedFunctionFrame stays walkable. The OSR code expects the interpreted sp in rdi.
+// An asm interpreter bridge frame links the OSR code frames back to the interpreted frame for the stack walk.
+void ArkSteedCall::SteedOsrEntry(ExtendedAssembler *assembler)
+{
+    __ BindAssemblerStub(RTSTUB_ID(SteedOsrEntry));
+    Label target;
+
+    PushAsmInterpBridgeFrame(assembler);
+    __ Callq(&target);
+    PopAsmInterpBridgeFrame(assembler);
+    __ Ret();
+    __ Bind(&target);
+
+    Register interpretedSp = rsi;
+    Register jsFuncReg = rdx;
+    Register codeAddrReg = rcx;
+    Register method = r9;
+    Register expectedNumArgsReg = r8;
+
+    __ Mov(Operand(jsFuncReg, JSFunctionBase::METHOD_OFFSET), method);
+    __ Mov(Operand(method, Method::CALL_FIELD_OFFSET), expectedNumArgsReg);
+    __ Shr(Method::NumArgsBits::START_BIT, expectedNumArgsReg);
+    __ Andl(((1LU << Method::NumArgsBits::SIZE) - 1), expectedNumArgsReg);
+
+    __ Pushq(rbp);
+    __ Pushq(static_cast<int32_t>(FrameType::OPTIMIZED_JS_FUNCTION_ARGS_CONFIG_FRAME));
+    __ Leaq(Operand(rsp, FRAME_SLOT_SIZE), rbp);
+    __ Pushq(r12);
+    __ Pushq(r13);
+    __ Pushq(r14);
+    __ Pushq(rbx);
+    // Reserve one temp spill slot to keep the args-config-frame layout aligned with the optimized path.
+    __ Pushq(rax);
+
+    Label lPushUndefined;
+    Label commonCall;
+    Label lPopFrame;
+    __ Movl(expectedNumArgsReg, r14);
+    __ Testb(1, r14);
+    __ Je(&lPushUndefined);
+    __ Pushq(0);
+    __ Bind(&lPushUndefined);
+    __ Cmpq(0, expectedNumArgsReg);
+    __ Je(&commonCall);
+    __ Pushq(JSTaggedValue::VALUE_UNDEFINED);
+    __ Addq(-1, expectedNumArgsReg);
+    __ Jmp(&lPushUndefined);
+
+    __ Bind(&commonCall);
+    // SteedFunctionFrame caller layout: [argc][call-target][newTarget][this][undefined...]
+    __ Pushq(JSTaggedValue::VALUE_UNDEFINED);
+    __ Pushq(JSTaggedValue::VALUE_UNDEFINED);
+    __ Pushq(jsFuncReg);
+    __ Pushq(NUM_MANDATORY_JSFUNC_ARGS);
+
+    __ Movq(jsFuncReg, r12);
+    __ Movq(Operand(r12, JSFunction::LEXICAL_ENV_OFFSET), rbx);
+    __ Movq(0, r13);
+    __ Movq(interpretedSp, rdi);
+
+    __ Callq(codeAddrReg);
+
+    __ Addq(4 * FRAME_SLOT_SIZE, rsp);  // 4: slots for pushed registers
+    __ Leaq(Operand(r14, Scale::Times8, 0), rbx);
+    __ Addq(rbx, rsp);
+    __ Testb(1, r14);
+    __ Je(&lPopFrame);
+    __ Addq(FRAME_SLOT_SIZE, rsp);
+
+    __ Bind(&lPopFrame);
+    __ Addq(FRAME_SLOT_SIZE, rsp);
+    __ Popq(rbx);
+    __ Popq(r14);
+    __ Popq(r13);
+    __ Popq(r12);
+    __ Addq(FRAME_SLOT_SIZE, rsp);
+    __ Pop(rbp);
+    __ Ret();
+}
+
 #undef __
 }  // namespace panda::ecmascript::x64
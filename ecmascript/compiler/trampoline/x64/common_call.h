@@ -283,6 +283,7 @@ public:
     static void ArkSteedCallEntry(ExtendedAssembler *assembler);
     static void SteedCallAndPushArgv(ExtendedAssembler *assembler);
     static void SteedCallWithArgVAndPushArgv(ExtendedAssembler *assembler);
+    static void SteedOsrEntry(ExtendedAssembler *assembler);
 };
 
 class JsFunctionArgsConfigFrameScope {
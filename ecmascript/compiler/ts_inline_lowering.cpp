@@ -142,6 +142,10 @@ void TSInlineLowering::TryInline(InlineTypeInfoAccessor &info, ChunkQueue<Inline
     if (inTryCatch) {
         return;
     }
+    if (info.IsNormalCall() && !info.IsEnableNormalInline()) {
+        TryPolyInline(info, workList);
+        return;
+    }
 
     uint32_t methodOffset = info.GetCallMethodId();
     bool skipMethod = methodOffset == 0 || ctx_->IsSkippedMethod(methodOffset) || IsRecursiveFunc(info, methodOffset);
@@ -229,6 +233,192 @@ void TSInlineLowering::TryInline(InlineTypeInfoAccessor &info, ChunkQueue<Inline
     }
 }
 
+const std::vector<uint32_t> *TSInlineLowering::GetPolyCallTargets(const InlineTypeInfoAccessor &info) const
+{
+    // Only the jit sees the functions behind the receivers of a polymorphic method load, and compares the callee
+    // with them as heap constants.
+    if (!compilationEnv_->IsJitCompiler() || !compilationEnv_->SupportHeapConstant() ||
+        maxInlinePolyTargets_ < MIN_POLY_INLINE_TARGETS) {
+        return nullptr;
+    }
+    if (!info.IsCallThis() || info.IsCallInit() || !info.HasIcSlot()) {
+        return nullptr;
+    }
+    GateRef func = info.GetReceiver();
+    if (acc_.GetOpCode(func) != OpCode::JS_BYTECODE) {
+        return nullptr;
+    }
+    switch (acc_.GetByteCodeOpcode(func)) {
+        case EcmaOpcode::LDOBJBYNAME_IMM8_ID16:
+        case EcmaOpcode::LDOBJBYNAME_IMM16_ID16:
+        case EcmaOpcode::LDTHISBYNAME_IMM8_ID16:
+        case EcmaOpcode::LDTHISBYNAME_IMM16_ID16:
+            break;
+        default:
+            return nullptr;
+    }
+    auto jitCompilationEnv = static_cast<const JitCompilationEnv *>(compilationEnv_);
+    auto targets = jitCompilationEnv->GetPolyCallTargets(acc_.TryGetMethodOffset(func), acc_.TryGetPcOffset(func));
+    if (targets == nullptr || targets->size() < MIN_POLY_INLINE_TARGETS || targets->size() > maxInlinePolyTargets_) {
+        return nullptr;
+    }
+    return targets;
+}
+
+bool TSInlineLowering::CollectPolyTargets(InlineTypeInfoAccessor &info, const std::vector<uint32_t> &methodOffsets,
+                                          std::vector<PolyTarget> &targets)
+{
+    GateRef gate = info.GetCallGate();
+    auto &bytecodeInfo = ctx_->GetBytecodeInfo();
+    for (uint32_t methodOffset : methodOffsets) {
+        if (ctx_->IsSkippedMethod(methodOffset) || IsRecursiveFunc(info, methodOffset)) {
+            return false;
+        }
+        MethodLiteral *method = ctx_->GetJSPandaFile()->FindMethodLiteral(methodOffset);
+        if (!CheckParameter(gate, info, method)) {
+            return false;
+        }
+        ctx_->GetBytecodeInfoCollector()->ProcessMethod(method);
+        ASSERT(bytecodeInfo.GetMethodList().find(methodOffset) != bytecodeInfo.GetMethodList().end());
+        auto &methodInfo = bytecodeInfo.GetMethodList().at(methodOffset);
+        auto &methodPcInfo = bytecodeInfo.GetMethodPcInfos()[methodInfo.GetMethodPcInfoIndex()];
+        if (ctx_->FilterMethod(method, methodPcInfo) || !FilterInlinedMethod(method, methodPcInfo.pcOffsets)) {
+            return false;
+        }
+        uint32_t heapConstantIndex = info.TryGetInlineHeapConstantFunctionIndex(methodOffset);
+        if (heapConstantIndex == JitCompilationEnv::INVALID_HEAP_CONSTANT_INDEX) {
+            return false;
+        }
+        targets.push_back({methodOffset, method, &methodInfo, &methodPcInfo, heapConstantIndex});
+    }
+    return true;
+}
+
+void TSInlineLowering::TryPolyInline(InlineTypeInfoAccessor &info, ChunkQueue<InlineTypeInfoAccessor> &workList)
+{
+    const std::vector<uint32_t> *methodOffsets = GetPolyCallTargets(info);
+    if (methodOffsets == nullptr) {
+        return;
+    }
+    // The profile has no per target counts, the calls of the site are assumed to be spread evenly over the
+    // targets, and every one of them has to be frequent enough on its own.
+    CallerDetails callerDetails = info.GetCallerDetails();
+    double callFrequency = callerDetails.GetCallFrequency();
+    if (!JitCanInline(info, callerDetails, callFrequency)) {
+        return;
+    }
+    double targetFrequency = callFrequency / methodOffsets->size();
+    if (IsInlineCallFreqLow(targetFrequency)) {
+        return;
+    }
+    std::vector<PolyTarget> targets;
+    if (!CollectPolyTargets(info, *methodOffsets, targets)) {
+        return;
+    }
+    // all targets share the budget of the caller frame, the site is only split when every one of them fits
+    GateRef frameArgs = GetFrameArgs(info);
+    size_t inlineCallCounts = GetOrInitialInlineCounts(frameArgs);
+    size_t inlinedSize = largeInlinedSize_;
+    for (size_t i = 0; i < targets.size(); i++) {
+        size_t methodSize = targets[i].methodPcInfo->pcOffsets.size();
+        if (!ShouldInline(methodSize, inlineCallCounts + i, info.GetInlineDepth())) {
+            largeInlinedSize_ = inlinedSize;
+            return;
+        }
+        largeInlinedSize_ += methodSize;
+    }
+    for (const auto &target : targets) {
+        if (!CalleePFIProcess(target.methodOffset)) {
+            largeInlinedSize_ = inlinedSize;
+            return;
+        }
+    }
+
+    SetInitCallTargetAndConstPoolId(info);
+    std::vector<GateRef> calls = BuildPolyDispatch(info, targets);
+    // the split calls are inlined right here, they must not become candidates of their own
+    lastCallId_ = circuit_->GetGateCount() - 1;
+    auto jitCompilationEnv = static_cast<JitCompilationEnv *>(compilationEnv_);
+    for (size_t i = 0; i < targets.size(); i++) {
+        const PolyTarget &target = targets[i];
+        InlineTypeInfoAccessor targetInfo(compilationEnv_, circuit_, calls[i], info.GetReceiver(),
+                                          CallKind::CALL_THIS, callerDetails, info.GetInlineDepth());
+        targetInfo.SetPolyCallMethodId(target.methodOffset);
+        CircuitRootScope scope(circuit_);
+        // the callee of the last case is only checked, any other function deopts there
+        if (i == targets.size() - 1 && !noCheck_) {
+            InlineCheck(targetInfo);
+        }
+        UpdateCallMethodFlagMap(target.methodOffset, target.method);
+        InlineCall(*target.methodInfo, *target.methodPcInfo, target.method, targetInfo);
+        UpdateInlineCounts(frameArgs, inlineCallCounts + i);
+        UpdateWorkList(workList, {target.methodOffset, targetFrequency}, info.GetInlineDepth() + 1);
+        auto calleeFunc = jitCompilationEnv->GetJsFunctionByMethodOffset(target.methodOffset);
+        ASSERT(!calleeFunc.IsEmpty());
+        jitCompilationEnv->RecordInlinedFunctions(calleeFunc);
+    }
+
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "";
+        LOG_COMPILER(INFO) << "\033[34m"
+                           << "===================="
+                           << " After polymorphic inlining of " << targets.size() << " targets"
+                           << " Caller method "
+                           << "[" << methodName_ << "]"
+                           << "===================="
+                           << "\033[0m";
+        circuit_->PrintAllGatesWithBytecode();
+        LOG_COMPILER(INFO) << "\033[34m" << "========================= End ==========================" << "\033[0m";
+    }
+}
+
+std::vector<GateRef> TSInlineLowering::BuildPolyDispatch(InlineTypeInfoAccessor &info,
+                                                         const std::vector<PolyTarget> &targets)
+{
+    GateRef gate = info.GetCallGate();
+    GateRef func = info.GetReceiver();
+    std::vector<GateRef> calls;
+    Environment env(gate, circuit_, &builder_);
+    Label exit(&builder_);
+    DEFVALUE(result, (&builder_), VariableType::JS_ANY(), builder_.Undefined());
+    size_t lastIndex = targets.size() - 1;
+    for (size_t i = 0; i < lastIndex; i++) {
+        Label isTarget(&builder_);
+        Label notTarget(&builder_);
+        GateRef heapConstant = builder_.HeapConstant(targets[i].heapConstantIndex);
+        BRANCH_CIR(builder_.Equal(func, heapConstant), &isTarget, &notTarget);
+        builder_.Bind(&isTarget);
+        {
+            calls.emplace_back(CloneCallInCurrentLabel(gate));
+            result = calls.back();
+            builder_.Jump(&exit);
+        }
+        builder_.Bind(&notTarget);
+    }
+    calls.emplace_back(CloneCallInCurrentLabel(gate));
+    result = calls.back();
+    builder_.Jump(&exit);
+    builder_.Bind(&exit);
+    ReplaceHirAndDeleteState(gate, builder_.GetState(), builder_.GetDepend(), *result);
+    return calls;
+}
+
+GateRef TSInlineLowering::CloneCallInCurrentLabel(GateRef gate)
+{
+    size_t numIns = acc_.GetNumIns(gate);
+    std::vector<GateRef> inList(numIns, Circuit::NullGate());
+    for (size_t i = 0; i < numIns; i++) {
+        inList[i] = acc_.GetIn(gate, i);
+    }
+    inList[0] = builder_.GetState();  // 0: state in
+    inList[1] = builder_.GetDepend();  // 1: depend in
+    GateRef call = circuit_->NewGate(acc_.GetMetaData(gate), acc_.GetMachineType(gate), numIns, inList.data(),
+                                     acc_.GetGateType(gate));
+    builder_.SetState(call);
+    builder_.SetDepend(call);
+    return call;
+}
+
 bool TSInlineLowering::FilterInlinedMethod(MethodLiteral* method, std::vector<const uint8_t*> pcOffsets)
 {
     const JSPandaFile *jsPandaFile = ctx_->GetJSPandaFile();
@@ -763,7 +953,7 @@ void TSInlineLowering::CandidateNormalCall(GateRef gate, ChunkQueue<InlineTypeIn
     size_t funcIndex = acc_.GetNumValueIn(gate) - 1;
     auto func = acc_.GetValueIn(gate, funcIndex);
     InlineTypeInfoAccessor tacc(compilationEnv_, circuit_, gate, func, kind, callerDetails, inlineDepth);
-    if (tacc.IsEnableNormalInline()) {
+    if (tacc.IsEnableNormalInline() || GetPolyCallTargets(tacc) != nullptr) {
         workList.emplace(tacc);
         lastCallId_ = acc_.GetId(gate);
     }
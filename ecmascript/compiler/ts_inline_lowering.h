@@ -17,6 +17,7 @@
 #define ECMASCRIPT_COMPILER_TS_INLINE_LOWERING_H
 
 #include "ecmascript/compiler/argument_accessor.h"
+#include "ecmascript/compiler/builtins/builtins_call_signature.h"
 #include "ecmascript/compiler/bytecode_circuit_builder.h"
 #include "ecmascript/compiler/bytecode_info_collector.h"
 #include "ecmascript/compiler/pass_manager.h"
@@ -42,6 +43,15 @@ private:
 
 class TSInlineLowering {
 public:
+    // an inline candidate of a polymorphic call site
+    struct PolyTarget {
+        uint32_t methodOffset {0};
+        MethodLiteral *method {nullptr};
+        MethodInfo *methodInfo {nullptr};
+        MethodPcInfo *methodPcInfo {nullptr};
+        uint32_t heapConstantIndex {0};
+    };
+
     TSInlineLowering(Circuit *circuit, PassContext *ctx, bool enableLog, const std::string &name,
                      NativeAreaAllocator *nativeAreaAllocator, PassOptions *options, uint32_t methodOffset,
                      CallMethodFlagMap *callMethodFlagMap)
@@ -64,6 +74,7 @@ public:
           maxInlineDepthLarge_(ctx->GetCompilationEnv()->GetJSOptions().GetMaxInlineDepthLarge()),
           maxInlineCount_(ctx->GetCompilationEnv()->GetJSOptions().GetMaxInlineCount()),
           maxInlineSizeLarge_(ctx->GetCompilationEnv()->GetJSOptions().GetMaxInlineSizeLarge()),
+          maxInlinePolyTargets_(ctx->GetCompilationEnv()->GetJSOptions().GetMaxInlinePolyTargets()),
           nativeAreaAllocator_(nativeAreaAllocator),
           noCheck_(ctx->GetCompilationEnv()->GetJSOptions().IsCompilerNoCheck()),
           chunk_(circuit->chunk()),
@@ -77,6 +88,8 @@ public:
     void RunTSInlineLowering();
 
 private:
+    static constexpr size_t MIN_POLY_INLINE_TARGETS = 2;
+
     bool IsLogEnabled() const
     {
         return enableLog_;
@@ -141,10 +154,15 @@ private:
         if (slot.IsWeak()) {
             return 1.0;
         }
-        if (!slot.IsJSFunction()) {
+        // a polymorphic site keeps counting its calls after the profiler stub invalidated the target slot
+        bool isPolyCallSite = slot.IsInt() && slot.GetInt() == PGO_BUILTINS_STUB_ID(NONE);
+        if (!slot.IsJSFunction() && !isPolyCallSite) {
             return 0.0;
         }
         JSTaggedValue callCnt = profileTypeInfo->GetICSlot(thread, idx + 1);
+        if (!callCnt.IsInt()) {
+            return 0.0;
+        }
         double callSiteCallCnt = static_cast<double>(callCnt.GetInt());  // 32: skip methodId
         return callSiteCallCnt / callerCallCnt;
     }
@@ -155,6 +173,12 @@ private:
                              const CallerDetails &callerDetails, int inlineDepth);
     bool JitCanInline(InlineTypeInfoAccessor &info, const CallerDetails &callerDetails, double &callFrequency);
     void TryInline(InlineTypeInfoAccessor &info, ChunkQueue<InlineTypeInfoAccessor> &workList);
+    const std::vector<uint32_t> *GetPolyCallTargets(const InlineTypeInfoAccessor &info) const;
+    bool CollectPolyTargets(InlineTypeInfoAccessor &info, const std::vector<uint32_t> &methodOffsets,
+                            std::vector<PolyTarget> &targets);
+    void TryPolyInline(InlineTypeInfoAccessor &info, ChunkQueue<InlineTypeInfoAccessor> &workList);
+    std::vector<GateRef> BuildPolyDispatch(InlineTypeInfoAccessor &info, const std::vector<PolyTarget> &targets);
+    GateRef CloneCallInCurrentLabel(GateRef gate);
     bool FilterInlinedMethod(MethodLiteral* method, std::vector<const uint8_t*> pcOffsets);
     bool FilterCallInTryCatch(GateRef gate);
     void InlineCall(
@@ -218,6 +242,7 @@ private:
     size_t maxInlineCount_ {0};
     size_t largeInlinedSize_ {0};
     size_t maxInlineSizeLarge_ {0};
+    size_t maxInlinePolyTargets_ {0};
     NativeAreaAllocator *nativeAreaAllocator_ {nullptr};
     bool noCheck_ {false};
     Chunk* chunk_ {nullptr};
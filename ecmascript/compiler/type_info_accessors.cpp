@@ -531,6 +531,9 @@ PropertyLookupResult InlineTypeInfoAccessor::GetAccessorPlrInJIT() const
 
 uint32_t InlineTypeInfoAccessor::GetCallMethodId() const
 {
+    if (polyCallMethodId_ != 0) {
+        return polyCallMethodId_;
+    }
     uint32_t methodOffset = 0;
     if ((IsNormalCall() || IsSuperCall()) && IsValidCallMethodId()) {
         methodOffset = GetFuncMethodOffsetFromPGO();
@@ -1219,10 +1222,7 @@ bool InstanceOfTypeInfoAccessor::JitAccessorStrategy::ClassInstanceIsCallable(JS
 
 bool InstanceOfTypeInfoAccessor::AotAccessorStrategy::GenerateObjectAccessInfo()
 {
-    // Instanceof does not support Poly for now
-    if (!IsMono()) {
-        return false;
-    }
+    // a poly site is checked against all of its ctor hclasses at once, the lowering is the same for each of them
     if (parent_.types_.size() == 0) {
         return false;
     }
@@ -1247,10 +1247,6 @@ bool InstanceOfTypeInfoAccessor::AotAccessorStrategy::GenerateObjectAccessInfo()
 
 bool InstanceOfTypeInfoAccessor::JitAccessorStrategy::GenerateObjectAccessInfo()
 {
-    // Instanceof does not support Poly for now
-    if (!IsMono()) {
-        return false;
-    }
     JSTaggedValue key = parent_.GetKeyTaggedValue();
     if (key.IsUndefined()) {
         return false;
@@ -1279,6 +1275,105 @@ bool InstanceOfTypeInfoAccessor::JitAccessorStrategy::GenerateObjectAccessInfo()
     return true;
 }
 
+IsInTypeInfoAccessor::IsInTypeInfoAccessor(const CompilationEnv *env, Circuit *circuit, GateRef gate, Chunk *chunk)
+    : ObjAccByNameTypeInfoAccessor(env, circuit, gate, chunk, AccessMode::LOAD), types_(chunk_), jitTypes_(chunk)
+{
+    key_ = acc_.GetValueIn(gate, 0);      // 0: key
+    receiver_ = acc_.GetValueIn(gate, 1); // 1: receiver
+    if (IsAot()) {
+        strategy_ = chunk_->New<AotAccessorStrategy>(*this);
+    } else {
+        strategy_ = chunk_->New<JitAccessorStrategy>(*this);
+    }
+    strategy_->FetchPGORWTypesDual();
+    hasIllegalType_ = !strategy_->GenerateObjectAccessInfo();
+}
+
+JSTaggedValue IsInTypeInfoAccessor::GetKeyTaggedValue() const
+{
+    // the profile does not record keys, only a constant key can be looked up in the profiled hclasses
+    if (!acc_.IsConstString(key_)) {
+        return JSTaggedValue::Undefined();
+    }
+    uint32_t stringId = acc_.GetStringIdFromLdaStrGate(key_);
+    auto methodOffset = acc_.TryGetMethodOffset(key_);
+    return compilationEnv_->GetStringFromConstantPool(methodOffset, stringId);
+}
+
+void IsInTypeInfoAccessor::AotAccessorStrategy::FetchPGORWTypesDual()
+{
+    const PGORWOpType *pgoTypes = parent_.acc_.TryGetPGOType(parent_.gate_).GetPGORWOpType();
+    if (IsMegaType(pgoTypes)) {
+        return;
+    }
+    for (uint32_t i = 0; i < pgoTypes->GetCount(); ++i) {
+        auto temp = pgoTypes->GetObjectInfo(i);
+        if (temp.GetReceiverType().IsBuiltinsType()) {
+            continue;
+        }
+        parent_.types_.emplace_back(std::make_pair(temp.GetReceiverRootType(), temp.GetReceiverType()));
+    }
+}
+
+void IsInTypeInfoAccessor::JitAccessorStrategy::FetchPGORWTypesDual()
+{
+    const PGORWOpType *pgoTypes = parent_.acc_.TryGetPGOType(parent_.gate_).GetPGORWOpType();
+    if (IsMegaType(pgoTypes)) {
+        return;
+    }
+    for (uint32_t i = 0; i < pgoTypes->GetCount(); ++i) {
+        auto temp = pgoTypes->GetObjectInfo(i);
+        if (temp.GetReceiverType().IsJITClassType()) {
+            parent_.jitTypes_.emplace_back(temp);
+        }
+    }
+}
+
+bool IsInTypeInfoAccessor::AotAccessorStrategy::GenerateObjectAccessInfo()
+{
+    if (parent_.types_.size() == 0) {
+        return false;
+    }
+    JSTaggedValue key = parent_.GetKeyTaggedValue();
+    if (key.IsUndefined()) {
+        return false;
+    }
+    for (size_t i = 0; i < parent_.types_.size(); ++i) {
+        ObjectAccessInfo receiverInfo;
+        // only own properties are folded, they stay as long as the receiver hclass does
+        if (!parent_.GeneratePlr(parent_.types_[i], receiverInfo, key) || !receiverInfo.Plr().IsLocal()) {
+            return false;
+        }
+        parent_.accessInfos_.emplace_back(receiverInfo);
+        parent_.checkerInfos_.emplace_back(receiverInfo);
+    }
+    return true;
+}
+
+bool IsInTypeInfoAccessor::JitAccessorStrategy::GenerateObjectAccessInfo()
+{
+    if (parent_.jitTypes_.size() == 0) {
+        return false;
+    }
+    JSTaggedValue key = parent_.GetKeyTaggedValue();
+    if (key.IsUndefined()) {
+        return false;
+    }
+    for (size_t i = 0; i < parent_.jitTypes_.size(); ++i) {
+        JSHClass *receiver = parent_.jitTypes_[i].GetReceiverHclass();
+        if (receiver == nullptr || receiver->IsJsPrimitiveRef()) {
+            return false;
+        }
+        ObjectAccessInfo receiverInfo;
+        if (!parent_.GeneratePlrInJIT(receiver, receiverInfo, key) || !receiverInfo.Plr().IsLocal()) {
+            return false;
+        }
+        parent_.accessInfos_.emplace_back(receiverInfo);
+        parent_.checkerInfos_.emplace_back(receiverInfo);
+    }
+    return true;
+}
+
 void LoadBuiltinObjTypeInfoAccessor::AotAccessorStrategy::FetchPGORWTypesDual()
 {
 }
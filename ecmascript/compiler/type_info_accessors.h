@@ -971,9 +971,18 @@ public:
 
     uint32_t GetType() const
     {
+        if (polyCallMethodId_ != 0) {
+            return polyCallMethodId_;
+        }
         return GetFuncMethodOffsetFromPGO();
     }
 
+    // a call site split by target for polymorphic inlining is inlined with the target of its case
+    void SetPolyCallMethodId(uint32_t methodId)
+    {
+        polyCallMethodId_ = methodId;
+    }
+
     PropertyLookupResult GetPlr() const
     {
         return plr_;
@@ -1020,6 +1029,7 @@ private:
     PropertyLookupResult plr_ { PropertyLookupResult() };
     CallerDetails callerDetails_;
     size_t inlineDepth_ {0};
+    uint32_t polyCallMethodId_ {0};
 };
 
 class ObjectAccessTypeInfoAccessor : public TypeInfoAccessor {
@@ -2023,6 +2033,89 @@ private:
     friend class JitAccessorStrategy;
 };
 
+// `key in obj` with a constant key, which the profile of the bytecode shows to be an own property of every receiver
+class IsInTypeInfoAccessor final : public ObjAccByNameTypeInfoAccessor {
+public:
+    class AccessorStrategy {
+    public:
+        virtual ~AccessorStrategy() = default;
+        virtual size_t GetTypeCount() const = 0;
+        virtual bool TypesIsEmpty() const = 0;
+        virtual void FetchPGORWTypesDual() = 0;
+        virtual bool GenerateObjectAccessInfo() = 0;
+    };
+
+    class AotAccessorStrategy : public AccessorStrategy {
+    public:
+        explicit AotAccessorStrategy(IsInTypeInfoAccessor &parent) : parent_(parent)
+        {
+        }
+
+        size_t GetTypeCount() const override
+        {
+            return parent_.types_.size();
+        }
+
+        bool TypesIsEmpty() const override
+        {
+            return parent_.types_.empty();
+        }
+
+        void FetchPGORWTypesDual() override;
+        bool GenerateObjectAccessInfo() override;
+
+    private:
+        IsInTypeInfoAccessor &parent_;
+    };
+
+    class JitAccessorStrategy : public AccessorStrategy {
+    public:
+        explicit JitAccessorStrategy(IsInTypeInfoAccessor &parent) : parent_(parent)
+        {
+        }
+
+        size_t GetTypeCount() const override
+        {
+            return parent_.jitTypes_.size();
+        }
+
+        bool TypesIsEmpty() const override
+        {
+            return parent_.jitTypes_.empty();
+        }
+
+        void FetchPGORWTypesDual() override;
+        bool GenerateObjectAccessInfo() override;
+
+    private:
+        IsInTypeInfoAccessor &parent_;
+    };
+
+    IsInTypeInfoAccessor(const CompilationEnv *env, Circuit *circuit, GateRef gate, Chunk *chunk);
+    NO_COPY_SEMANTIC(IsInTypeInfoAccessor);
+    NO_MOVE_SEMANTIC(IsInTypeInfoAccessor);
+
+    size_t GetTypeCount()
+    {
+        return strategy_->GetTypeCount();
+    }
+
+    bool TypesIsEmpty()
+    {
+        return strategy_->TypesIsEmpty();
+    }
+
+    JSTaggedValue GetKeyTaggedValue() const;
+
+private:
+    ChunkVector<ProfileTyper> types_;
+    ChunkVector<pgo::PGOObjectInfo> jitTypes_;
+    AccessorStrategy* strategy_;
+
+    friend class AotAccessorStrategy;
+    friend class JitAccessorStrategy;
+};
+
 class AccBuiltinObjTypeInfoAccessor : public ObjectAccessTypeInfoAccessor {
 public:
     AccBuiltinObjTypeInfoAccessor(const CompilationEnv *env,
@@ -195,6 +195,9 @@ void TypedBytecodeLowering::Lower(GateRef gate)
         case EcmaOpcode::DEC_IMM8:
             LowerTypedUnOp<TypedUnOp::TYPED_DEC>(gate);
             break;
+        case EcmaOpcode::ISIN_IMM8_V8:
+            LowerIsIn(gate);
+            break;
         case EcmaOpcode::INSTANCEOF_IMM8_V8:
             LowerInstanceOf(gate);
             break;
@@ -2812,25 +2815,45 @@ void TypedBytecodeLowering::LowerInstanceOf(GateRef gate)
     }
     AddProfiling(gate);
     size_t typeCount = tacc.GetTypeCount();
-    std::vector<GateRef> expectedHCIndexes;
+    std::vector<int> expectedHCIndexes;
     for (size_t i = 0; i < typeCount; ++i) {
-        GateRef temp = builder_.Int32(tacc.GetExpectedHClassIndex(i));
-        expectedHCIndexes.emplace_back(temp);
+        expectedHCIndexes.emplace_back(tacc.GetExpectedHClassIndex(i));
     }
     DEFVALUE(result, (&builder_), VariableType::JS_ANY(), builder_.Hole());
     // RuntimeCheck -
-    // 1. pgo.hclass == ctor.hclass
+    // 1. ctor.hclass is one of the pgo.hclasses
     // 2. ctor.hclass has a prototype chain up to Function.prototype
     GateRef obj = tacc.GetReceiver();
     GateRef target = tacc.GetTarget();
 
-    builder_.ObjectTypeCheck(false, target, expectedHCIndexes[0]);
+    if (typeCount == 1) {
+        builder_.ObjectTypeCheck(false, target, builder_.Int32(expectedHCIndexes[0]));
+    } else {
+        builder_.ObjectTypeCheck(false, target, expectedHCIndexes);
+    }
     builder_.ProtoChangeMarkerCheck(target);
 
     result = builder_.OrdinaryHasInstance(obj, target);
     ReplaceGateWithPendingException(glue_, gate, builder_.GetState(), builder_.GetDepend(), *result);
 }
 
+void TypedBytecodeLowering::LowerIsIn(GateRef gate)
+{
+    IsInTypeInfoAccessor tacc(compilationEnv_, circuit_, gate, chunk_);
+    if (tacc.TypesIsEmpty() || tacc.HasIllegalType()) {
+        return;
+    }
+    AddProfiling(gate);
+    size_t typeCount = tacc.GetTypeCount();
+    std::vector<int> expectedHCIndexes;
+    for (size_t i = 0; i < typeCount; ++i) {
+        expectedHCIndexes.emplace_back(tacc.GetExpectedHClassIndex(i));
+    }
+    // the key is an own property of every expected hclass, nothing else is to be looked at once the receiver passes
+    builder_.ObjectTypeCheck(false, tacc.GetReceiver(), expectedHCIndexes);
+    acc_.ReplaceHirAndReplaceDeadIfException(gate, builder_.GetStateDepend(), builder_.TaggedTrue());
+}
+
 void TypedBytecodeLowering::LowerCreateEmptyObject(GateRef gate)
 {
     AddProfiling(gate);
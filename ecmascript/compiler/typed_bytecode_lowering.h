@@ -251,6 +251,7 @@ private:
     void LowerFastCall(GateRef gate, GateRef func, const std::vector<GateRef> &argsFastCall, bool isNoGC);
     void LowerCall(GateRef gate, GateRef func, const std::vector<GateRef> &args, bool isNoGC);
     void LowerTypedTypeOf(GateRef gate);
+    void LowerIsIn(GateRef gate);
     void LowerInstanceOf(GateRef gate);
     void LowerGetIterator(GateRef gate);
     GateRef LoadStringByIndex(const LoadBuiltinObjTypeInfoAccessor &tacc);
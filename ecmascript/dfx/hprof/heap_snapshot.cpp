@@ -19,6 +19,7 @@
 #include <unordered_map>
 
 #include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/mem/external_memory_tracker.h"
 #include "ecmascript/napi/include/jsnapi_expo.h"
 #include "ecmascript/runtime.h"
 
@@ -681,6 +682,7 @@ HprofNode *HeapSnapshot::HandleBaseClassNode(size_t size, bool idExist, NodeId &
     if (obj->GetClass()->IsJSNativePointer()) {
         nativeSize = JSNativePointer::Cast(obj)->GetBindingSize();
     }
+    nativeSize += vm_->GetHeap()->GetExternalMemoryTracker()->GetExternalSize(obj);
     HprofNode* node = HprofNode::NewNode(chunk_, sequenceId, nodeCount_, GenerateNodeName(obj, needProxySuffix),
                                          GenerateNodeType(obj), selfSize, nativeSize, addr);
     entryMap_.InsertEntry(node);
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/dfx/vmstat/ic_profiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/interpreter/frame_handler.h"
+#include "ecmascript/jspandafile/debug_info_extractor.h"
+#include "ecmascript/jspandafile/js_pandafile_manager.h"
+#include "ecmascript/method.h"
+
+namespace panda::ecmascript {
+ICProfiler::ICState ICProfiler::Function::WorstState() const
+{
+    ICState worst = ICState::UNINIT;
+    for (const auto &[slotId, site] : sites) {
+        worst = std::max(worst, site.state);
+    }
+    return worst;
+}
+
+ICProfiler::~ICProfiler()
+{
+    PrintAndReset();
+}
+
+void ICProfiler::RecordMiss(JSThread *thread, const Miss &miss)
+{
+    Method *method = nullptr;
+    uint32_t bcOffset = INVALID_OFFSET;
+    FrameHandler frameHandler(thread);
+    for (; frameHandler.HasFrame(); frameHandler.PrevJSFrame()) {
+        if (frameHandler.IsEntryFrame() || frameHandler.IsBuiltinFrame()) {
+            continue;
+        }
+        Method *current = frameHandler.CheckAndGetMethod();
+        if (current == nullptr || current->IsNativeWithCallField()) {
+            continue;
+        }
+        method = current;
+        // compiled frames have no bytecode pc, the position is taken from a later miss in the interpreter
+        if (frameHandler.IsInterpretedFrame() &&
+            reinterpret_cast<uintptr_t>(frameHandler.GetPc()) != std::numeric_limits<uintptr_t>::max()) {
+            bcOffset = frameHandler.GetBytecodeOffset();
+        }
+        break;
+    }
+
+    Function &function = method != nullptr ? GetOrCreateFunction(thread, method) : GetOrCreateNoFrameFunction();
+    auto result = function.sites.try_emplace(miss.slotId);
+    Site &site = result.first->second;
+    if (result.second) {
+        InitSite(thread, site, miss);
+    }
+    if (site.bcOffset == INVALID_OFFSET && bcOffset != INVALID_OFFSET) {
+        site.bcOffset = bcOffset;
+        ResolvePosition(thread, method, site);
+    }
+
+    function.missCount++;
+    site.missCount++;
+    site.state = miss.after;
+    if (miss.before != miss.after) {
+        site.transitions[static_cast<uint32_t>(miss.before)][static_cast<uint32_t>(miss.after)]++;
+    }
+    AddHClass(site, miss.hclass);
+}
+
+ICProfiler::Function &ICProfiler::GetOrCreateFunction(JSThread *thread, Method *method)
+{
+    const JSPandaFile *pf = method->GetJSPandaFile(thread);
+    ASSERT(pf != nullptr);
+    uint32_t abcIndex = GetAbcIndex(pf->GetJSPandaFileDesc());
+    uint32_t methodId = method->GetMethodId().GetOffset();
+    uint64_t key = (static_cast<uint64_t>(abcIndex) << 32) + methodId;  // 32: 32bit
+    auto result = functions_.try_emplace(key);
+    Function &function = result.first->second;
+    if (result.second) {
+        function.name = ConvertToStdString(method->GetRecordNameStr(thread)) + "." + method->GetMethodName(thread);
+        function.abcIndex = abcIndex;
+        function.methodId = methodId;
+    }
+    return function;
+}
+
+ICProfiler::Function &ICProfiler::GetOrCreateNoFrameFunction()
+{
+    uint32_t abcIndex = GetAbcIndex("");
+    uint64_t key = static_cast<uint64_t>(abcIndex) << 32;  // 32: 32bit
+    auto result = functions_.try_emplace(key);
+    Function &function = result.first->second;
+    if (result.second) {
+        function.name = NO_FRAME_NAME;
+        function.abcIndex = abcIndex;
+    }
+    return function;
+}
+
+uint32_t ICProfiler::GetAbcIndex(const CString &abcName)
+{
+    auto itr = std::find(abcNames_.begin(), abcNames_.end(), abcName);
+    if (itr != abcNames_.end()) {
+        return static_cast<uint32_t>(std::distance(abcNames_.begin(), itr));
+    }
+    abcNames_.emplace_back(abcName);
+    return static_cast<uint32_t>(abcNames_.size() - 1);
+}
+
+void ICProfiler::InitSite(JSThread *thread, Site &site, const Miss &miss)
+{
+    site.kind = miss.kind;
+    site.slotId = miss.slotId;
+    site.key = KeyToString(thread, miss.key);
+    site.state = miss.before;
+}
+
+void ICProfiler::ResolvePosition(JSThread *thread, Method *method, Site &site)
+{
+    const JSPandaFile *pf = method->GetJSPandaFile(thread);
+    DebugInfoExtractor *extractor = JSPandaFileManager::GetInstance()->GetJSPtExtractor(pf);
+    if (extractor == nullptr) {
+        return;
+    }
+    panda_file::File::EntityId methodId = method->GetMethodId();
+    // the tables count from 0
+    extractor->MatchLineWithOffset([&site](int32_t line) -> bool {
+        site.line = line + 1;
+        return true;
+    }, methodId, site.bcOffset);
+    extractor->MatchColumnWithOffset([&site](int32_t column) -> bool {
+        site.column = column + 1;
+        return true;
+    }, methodId, site.bcOffset);
+}
+
+void ICProfiler::AddHClass(Site &site, const JSHClass *hclass)
+{
+    if (hclass == nullptr) {
+        return;
+    }
+    // hclasses are in the non movable space, the address identifies one for as long as it lives
+    uintptr_t address = ToUintPtr(hclass);
+    auto it = std::find_if(site.hclasses.begin(), site.hclasses.end(),
+                           [address](const HClassInfo &info) { return info.address == address; });
+    if (it != site.hclasses.end()) {
+        return;
+    }
+    if (site.hclasses.size() < MAX_RECORDED_HCLASSES) {
+        site.hclasses.push_back({address, hclass->GetObjectType()});
+    } else {
+        site.moreHClasses++;
+    }
+}
+
+std::string ICProfiler::KeyToString(JSThread *thread, JSTaggedValue key)
+{
+    if (key.IsString()) {
+        return EcmaStringAccessor(key).ToStdString(thread);
+    }
+    if (key.IsInt()) {
+        return std::to_string(key.GetInt());
+    }
+    if (key.IsDouble()) {
+        return std::to_string(key.GetDouble());
+    }
+    if (key.IsSymbol()) {
+        return "(symbol)";
+    }
+    return "(other)";
+}
+
+const ICProfiler::Function *ICProfiler::FindFunction(const std::string &name) const
+{
+    for (const auto &[key, function] : functions_) {
+        if (function.name == name) {
+            return &function;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<const ICProfiler::Function *> ICProfiler::RankFunctions() const
+{
+    std::vector<const Function *> ranked;
+    for (const auto &[key, function] : functions_) {
+        ranked.push_back(&function);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const Function *x, const Function *y) {
+        ICState xState = x->WorstState();
+        ICState yState = y->WorstState();
+        if (xState != yState) {
+            return xState > yState;
+        }
+        return x->missCount > y->missCount;
+    });
+    return ranked;
+}
+
+std::vector<const ICProfiler::Site *> ICProfiler::RankSites(const Function &function)
+{
+    std::vector<const Site *> ranked;
+    for (const auto &[slotId, site] : function.sites) {
+        ranked.push_back(&site);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const Site *x, const Site *y) {
+        if (x->state != y->state) {
+            return x->state > y->state;
+        }
+        return x->missCount > y->missCount;
+    });
+    return ranked;
+}
+
+void ICProfiler::DumpSite(std::ostream &os, const Site &site)
+{
+    static constexpr int positionAdjustment = 20;
+    static constexpr int kindAdjustment = 22;
+    static constexpr int keyAdjustment = 20;
+    static constexpr int numberAdjustment = 10;
+    std::string position = "slot " + std::to_string(site.slotId);
+    if (site.bcOffset != INVALID_OFFSET) {
+        position = std::to_string(site.line) + ":" + std::to_string(site.column) +
+                   "(" + std::to_string(site.bcOffset) + ")";
+    }
+    os << std::right << std::setw(positionAdjustment) << position
+       << std::setw(kindAdjustment) << ICKindToString(site.kind)
+       << std::setw(keyAdjustment) << site.key
+       << std::setw(numberAdjustment) << ProfileTypeInfoNexus::ICStateToString(site.state)
+       << std::setw(numberAdjustment) << site.missCount << "   ";
+    for (uint32_t from = 0; from < STATE_NUM; from++) {
+        for (uint32_t to = 0; to < STATE_NUM; to++) {
+            uint32_t count = site.transitions[from][to];
+            if (count != 0) {
+                os << ProfileTypeInfoNexus::ICStateToString(static_cast<ICState>(from)) << "->"
+                   << ProfileTypeInfoNexus::ICStateToString(static_cast<ICState>(to)) << " x" << count << " ";
+            }
+        }
+    }
+    os << "  hclasses:";
+    for (const HClassInfo &info : site.hclasses) {
+        os << " " << JSHClass::DumpJSType(info.type) << "@0x" << std::hex << info.address << std::dec;
+    }
+    if (site.moreHClasses != 0) {
+        os << " and " << site.moreHClasses << " more";
+    }
+    os << "\n";
+}
+
+void ICProfiler::Dump(std::ostream &os) const
+{
+    static constexpr int nameAdjustment = 20;
+    static constexpr int numberAdjustment = 15;
+    std::array<std::array<uint64_t, STATE_NUM>, STATE_NUM> totals {};
+    for (const auto &[key, function] : functions_) {
+        for (const auto &[slotId, site] : function.sites) {
+            for (uint32_t from = 0; from < STATE_NUM; from++) {
+                for (uint32_t to = 0; to < STATE_NUM; to++) {
+                    totals[from][to] += site.transitions[from][to];
+                }
+            }
+        }
+    }
+    os << "==================== IC transitions ====================\n";
+    for (uint32_t from = 0; from < STATE_NUM; from++) {
+        for (uint32_t to = 0; to < STATE_NUM; to++) {
+            if (totals[from][to] == 0) {
+                continue;
+            }
+            std::string transition = ProfileTypeInfoNexus::ICStateToString(static_cast<ICState>(from)) + "->" +
+                                     ProfileTypeInfoNexus::ICStateToString(static_cast<ICState>(to));
+            os << std::left << std::setw(nameAdjustment) << transition
+               << std::right << std::setw(numberAdjustment) << totals[from][to] << "\n";
+        }
+    }
+
+    std::vector<const Function *> ranked = RankFunctions();
+    size_t count = std::min<size_t>(ranked.size(), MAX_PRINTED_FUNCTIONS);
+    for (size_t i = 0; i < count; i++) {
+        const Function *function = ranked[i];
+        os << "==== function: " << function->name << ", methodId: " << function->methodId
+           << ", abcName: " << abcNames_[function->abcIndex] << ", misses: " << function->missCount << " ====\n";
+        for (const Site *site : RankSites(*function)) {
+            DumpSite(os, *site);
+        }
+    }
+    if (ranked.size() > count) {
+        os << "(" << ranked.size() - count << " functions with fewer misses not printed)\n";
+    }
+}
+
+void ICProfiler::PrintAndReset()
+{
+    if (functions_.empty()) {
+        return;
+    }
+    std::ostringstream oss;
+    Dump(oss);
+    std::istringstream lines(oss.str());
+    std::string line;
+    LOG_ECMA(INFO) << "IC state transitions of the property access sites:";
+    while (std::getline(lines, line)) {
+        LOG_ECMA(INFO) << line;
+    }
+    Reset();
+}
+
+void ICProfiler::Reset()
+{
+    functions_.clear();
+    abcNames_.clear();
+}
+
+size_t ICProfiler::GetSiteCount() const
+{
+    size_t count = 0;
+    for (const auto &[key, function] : functions_) {
+        count += function.sites.size();
+    }
+    return count;
+}
+}  // namespace panda::ecmascript
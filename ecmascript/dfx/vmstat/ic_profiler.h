@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_DFX_VMSTAT_IC_PROFILER_H
+#define ECMASCRIPT_DFX_VMSTAT_IC_PROFILER_H
+
+#include <array>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ecmascript/ic/ic_info.h"
+#include "ecmascript/ic/profile_type_info.h"
+#include "ecmascript/mem/c_string.h"
+
+// ==================== IC transitions ====================
+// uninit->mono      count
+// .......
+// ==== function: name, methodId, abcName, misses ====
+// line:column(bcOffset)   kind   key   state   misses   transitions   hclasses
+// .......
+
+namespace panda::ecmascript {
+class JSHClass;
+class JSThread;
+class Method;
+
+// Collects the state transitions of the property access ICs per site with --enable-ic-profiler. A site is an IC
+// slot of a method; every miss handled by ICRuntime adds the transition it caused, the hclass of its receiver and one
+// to the miss count of the site. Only the miss path is instrumented, the ic stubs themselves run unchanged.
+//
+// The report ranks the functions by their least stable site, then by their misses, so that the hot sites which went
+// polymorphic or megamorphic come first.
+class ICProfiler {
+public:
+    using ICState = ProfileTypeInfoNexus::ICState;
+
+    static constexpr uint32_t STATE_NUM = static_cast<uint32_t>(ICState::MEGA) + 1;
+    static constexpr uint32_t MAX_RECORDED_HCLASSES = 8;
+    static constexpr uint32_t MAX_PRINTED_FUNCTIONS = 20;
+    static constexpr uint32_t INVALID_OFFSET = UINT32_MAX;
+    // misses without a js frame, e.g. from napi, are put together under this name
+    static constexpr const char *NO_FRAME_NAME = "(no js frame)";
+
+    struct Miss {
+        ICKind kind {ICKind::NamedLoadIC};
+        uint32_t slotId {0};
+        JSTaggedValue key {JSTaggedValue::Undefined()};
+        // the receiver hclass before the miss, nullptr for primitive receivers without one
+        const JSHClass *hclass {nullptr};
+        ICState before {ICState::UNINIT};
+        ICState after {ICState::UNINIT};
+    };
+
+    struct HClassInfo {
+        uintptr_t address {0};
+        JSType type {JSType::INVALID};
+    };
+
+    struct Site {
+        ICKind kind {ICKind::NamedLoadIC};
+        uint32_t slotId {0};
+        // the key of the first miss, keyed ics may see others
+        std::string key {};
+        uint32_t bcOffset {INVALID_OFFSET};
+        int32_t line {-1};
+        int32_t column {-1};
+        ICState state {ICState::UNINIT};
+        uint64_t missCount {0};
+        std::vector<HClassInfo> hclasses {};
+        // hclasses seen after MAX_RECORDED_HCLASSES were recorded
+        uint32_t moreHClasses {0};
+        std::array<std::array<uint32_t, STATE_NUM>, STATE_NUM> transitions {};
+
+        uint32_t TransitionCount(ICState from, ICState to) const
+        {
+            return transitions[static_cast<uint32_t>(from)][static_cast<uint32_t>(to)];
+        }
+    };
+
+    struct Function {
+        std::string name {};
+        uint32_t abcIndex {0};
+        uint32_t methodId {0};
+        uint64_t missCount {0};
+        std::map<uint32_t, Site> sites {};
+
+        ICState WorstState() const;
+    };
+
+    ICProfiler() = default;
+    ~ICProfiler();
+
+    NO_COPY_SEMANTIC(ICProfiler);
+    NO_MOVE_SEMANTIC(ICProfiler);
+
+    // Called on the miss path of ICRuntime, after the slot was updated. It must not allocate on the js heap.
+    void RecordMiss(JSThread *thread, const Miss &miss);
+
+    const Function *FindFunction(const std::string &name) const;
+    std::vector<const Function *> RankFunctions() const;
+    static std::vector<const Site *> RankSites(const Function &function);
+
+    void Dump(std::ostream &os) const;
+    void PrintAndReset();
+    void Reset();
+
+    size_t GetSiteCount() const;
+
+private:
+    Function &GetOrCreateFunction(JSThread *thread, Method *method);
+    Function &GetOrCreateNoFrameFunction();
+    uint32_t GetAbcIndex(const CString &abcName);
+    static void InitSite(JSThread *thread, Site &site, const Miss &miss);
+    static void ResolvePosition(JSThread *thread, Method *method, Site &site);
+    static void AddHClass(Site &site, const JSHClass *hclass);
+    static std::string KeyToString(JSThread *thread, JSTaggedValue key);
+    static void DumpSite(std::ostream &os, const Site &site);
+
+    // by abc index and method id, as in OptCodeProfiler
+    std::map<uint64_t, Function> functions_ {};
+    std::vector<CString> abcNames_ {};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_DFX_VMSTAT_IC_PROFILER_H
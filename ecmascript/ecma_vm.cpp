@@ -47,6 +47,7 @@
 #include "ecmascript/dfx/stackinfo/async_stack_trace.h"
 #include "ecmascript/dfx/tracing/tracing.h"
 #include "ecmascript/dfx/vmstat/function_call_timer.h"
+#include "ecmascript/dfx/vmstat/ic_profiler.h"
 #include "ecmascript/dfx/vmstat/opt_code_profiler.h"
 #include "ecmascript/jit/jit_task.h"
 #include "ecmascript/js_tagged_value_wrapper.h"
@@ -470,6 +471,9 @@ bool EcmaVM::Initialize()
 
 #endif // PANDA_JS_ETS_HYBRID_MODE
     gcStats_ = chunk_.New<GCStats>(heap_, options_.GetLongPauseTime());
+    if (options_.EnableHeapHugePage()) {
+        gcStats_->EnableMemoryCounters();
+    }
     gcKeyStats_ = chunk_.New<GCKeyStats>(heap_, gcStats_);
     factory_ = chunk_.New<ObjectFactory>(thread_, heap_, SharedHeap::GetInstance());
     if (UNLIKELY(factory_ == nullptr)) {
@@ -502,6 +506,9 @@ bool EcmaVM::Initialize()
     if (options_.GetTypedOpProfiler()) {
         typedOpProfiler_ = new TypedOpProfiler();
     }
+    if (options_.IsEnableICProfiler()) {
+        icProfiler_ = new ICProfiler();
+    }
     functionProtoTransitionTable_ = new FunctionProtoTransitionTable(thread_);
 
     unsharedConstpools_ = new(std::nothrow) JSTaggedValue[GetUnsharedConstpoolsArrayLen()];
@@ -747,6 +754,11 @@ EcmaVM::~EcmaVM()
         typedOpProfiler_ = nullptr;
     }
 
+    if (icProfiler_ != nullptr) {
+        delete icProfiler_;
+        icProfiler_ = nullptr;
+    }
+
     if (ptManager_ != nullptr) {
         delete ptManager_;
         ptManager_ = nullptr;
@@ -966,10 +978,15 @@ void EcmaVM::PrintCollectedByteCode()
               [](std::pair<std::string, int> &a, std::pair<std::string, int> &b) {
         return a.second > b.second;
     });
+    int64_t totalCount = 0;
     for (size_t i = 0; i < bytecodeStatsVector.size(); ++i) {
         LOG_ECMA(ERROR) << std::right << std::setw(nameRightAdjustment) << bytecodeStatsVector[i].first
                        << std::setw(numberRightAdjustment) << bytecodeStatsVector[i].second;
+        totalCount += bytecodeStatsVector[i].second;
     }
+    // instructions run by the handler of the one before them are not counted, so this is the number of dispatches
+    LOG_ECMA(ERROR) << std::right << std::setw(nameRightAdjustment) << "Total Handler Dispatches"
+                   << std::setw(numberRightAdjustment) << totalCount;
     LOG_ECMA(ERROR) << "============================================================"
                       << "=========================================================";
 }
@@ -1094,6 +1111,7 @@ void EcmaVM::IterateSTWRoots(RootVisitor &v)
     if (!microJobQueue_.IsHole()) {
         v.VisitRoot(Root::ROOT_VM, ObjectSlot(ToUintPtr(&microJobQueue_)));
     }
+    promiseJobRing_.Iterate(v);
     if (!registerSymbols_.IsHole()) {
         v.VisitRoot(Root::ROOT_VM, ObjectSlot(ToUintPtr(&registerSymbols_)));
     }
@@ -1378,7 +1396,7 @@ bool EcmaVM::LoadAOTFilesInternal(const std::string& aotFileName)
     }
 #endif
     std::string anFile = aotFileName + AOTFileManager::FILE_EXTENSION_AN;
-    if (!aotFileManager_->LoadAnFile(anFile)) {
+    if (!aotFileManager_->LoadAnFile(anFile, options_.IsEnableAotLazyLoad())) {
         LOG_ECMA(WARN) << "Load " << anFile << " failed. Destroy aot data and rollback to interpreter";
         ecmascript::AnFileDataManager::GetInstance()->SafeDestroyAnData(anFile);
         return false;
@@ -2153,12 +2171,11 @@ void EcmaVM::SetMicroJobQueue(job::MicroJobQueue *queue)
 
 bool EcmaVM::HasPendingJob() const
 {
-    // This interface only determines whether PromiseJobQueue is empty, rather than ScriptJobQueue.
+    // This interface only determines whether the promise jobs are empty, rather than ScriptJobQueue.
     if (UNLIKELY(thread_->HasTerminated())) {
         return false;
     }
-    TaggedQueue *promiseQueue = TaggedQueue::Cast(GetMicroJobQueue()->GetPromiseJobQueue(thread_).GetTaggedObject());
-    return !promiseQueue->Empty(thread_);
+    return !promiseJobRing_.Empty();
 }
 
 bool EcmaVM::ExecutePromisePendingJob()
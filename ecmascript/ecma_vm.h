@@ -36,6 +36,7 @@
 #include "ecmascript/global_env_constants.h"
 #include "ecmascript/global_handle_collection.h"
 #include "ecmascript/js_handle.h"
+#include "ecmascript/jobs/promise_job_ring.h"
 #include "ecmascript/js_runtime_options.h"
 #include "ecmascript/mem/c_containers.h"
 #include "ecmascript/mem/c_string.h"
@@ -91,6 +92,7 @@ namespace pgo {
 } // namespace pgo
 
 class OptCodeProfiler;
+class ICProfiler;
 class TypedOpProfiler;
 class FunctionProtoTransitionTable;
 struct CJSInfo;
@@ -1428,6 +1430,11 @@ public:
 
     JSHandle<job::MicroJobQueue> GetMicroJobQueue() const;
 
+    job::PromiseJobRing &GetPromiseJobRing()
+    {
+        return promiseJobRing_;
+    }
+
     bool HasPendingJob() const;
 
     bool ExecutePromisePendingJob();
@@ -1566,6 +1573,11 @@ public:
         return typedOpProfiler_;
     }
 
+    ICProfiler* GetICProfiler() const
+    {
+        return icProfiler_;
+    }
+
     FunctionProtoTransitionTable* GetFunctionProtoTransitionTable() const
     {
         return functionProtoTransitionTable_;
@@ -1996,6 +2008,7 @@ private:
     JSTaggedValue finRegLists_ {JSTaggedValue::Hole()};
     JSTaggedValue registerSymbols_ {JSTaggedValue::Hole()};
     JSTaggedValue microJobQueue_ {JSTaggedValue::Hole()};
+    job::PromiseJobRing promiseJobRing_ {};
     std::atomic<bool> isProcessingPendingJob_{false};
 
     std::vector<JSTaggedValue> typedArrayNameTable_;
@@ -2057,6 +2070,7 @@ private:
     OptCodeProfiler* optCodeProfiler_ {nullptr};
     // opt code loop hoist
     TypedOpProfiler* typedOpProfiler_ {nullptr};
+    ICProfiler* icProfiler_ {nullptr};
     // RegExpParserCache
     RegExpParserCache *regExpParserCache_ {nullptr};
     // WaiterListNode(atomics)
@@ -321,6 +321,8 @@ std::string ICKindToString(ICKind kind)
             return "GlobalLoadIC";
         case ICKind::GlobalStoreIC:
             return "GlobalStoreIC";
+        case ICKind::IsInIC:
+            return "IsInIC";
         default:
             LOG_ECMA(FATAL) << "this branch is unreachable";
             UNREACHABLE();
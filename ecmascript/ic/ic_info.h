@@ -186,6 +186,8 @@ enum class ICKind : uint32_t {
     NamedGlobalTryStoreIC,
     GlobalLoadIC,
     GlobalStoreIC,
+    // the cache of the `in` operator, see IsInICRuntime
+    IsInIC,
 };
 
 static inline bool IsNamedGlobalIC(ICKind kind)
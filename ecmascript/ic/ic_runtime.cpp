@@ -14,7 +14,9 @@
  */
 
 #include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/dfx/vmstat/ic_profiler.h"
 #include "ecmascript/ic/ic_handler.h"
+#include "ecmascript/ic/ic_info.h"
 #include "ecmascript/interpreter/interpreter.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/ic/mega_ic_cache.h"
@@ -26,8 +28,51 @@
 #include "ecmascript/js_primitive_ref.h"
 #include "ecmascript/js_tagged_value_wrapper.h"
 #include "ecmascript/shared_objects/js_shared_array.h"
+#include "ecmascript/tagged_array-inl.h"
 
 namespace panda::ecmascript {
+// Hands the state transition of one miss to the ICProfiler of the vm, once the miss has updated the slot.
+template<class Runtime>
+class ICMissRecorder {
+public:
+    ICMissRecorder(Runtime *icRuntime, JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key)
+        : icRuntime_(icRuntime), profiler_(icRuntime->GetThread()->GetEcmaVM()->GetICProfiler())
+    {
+        if (profiler_ == nullptr) {
+            return;
+        }
+        key_ = key;
+        before_ = icRuntime_->GetICState();
+        if (receiver->IsHeapObject()) {
+            hclass_ = receiver->GetTaggedObject()->GetClass();
+        }
+    }
+
+    ~ICMissRecorder()
+    {
+        if (profiler_ == nullptr) {
+            return;
+        }
+        ICProfiler::Miss miss;
+        miss.kind = icRuntime_->GetICKind();
+        miss.slotId = icRuntime_->GetSlotId();
+        miss.key = key_.GetTaggedValue();
+        miss.hclass = hclass_;
+        miss.before = before_;
+        miss.after = icRuntime_->GetICState();
+        profiler_->RecordMiss(icRuntime_->GetThread(), miss);
+    }
+
+    NO_COPY_SEMANTIC(ICMissRecorder);
+    NO_MOVE_SEMANTIC(ICMissRecorder);
+
+private:
+    Runtime *icRuntime_;
+    ICProfiler *profiler_;
+    JSHandle<JSTaggedValue> key_ {};
+    const JSHClass *hclass_ {nullptr};
+    ProfileTypeInfoNexus::ICState before_ {ProfileTypeInfoNexus::ICState::UNINIT};
+};
 
 bool ICRuntime::GetHandler(const ObjectOperator &op, const JSHandle<JSHClass> &hclass,
                            JSHandle<JSTaggedValue> &handlerValue)
@@ -218,6 +263,7 @@ void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedVa
 
 JSTaggedValue LoadICRuntime::LoadValueMiss(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key)
 {
+    ICMissRecorder recorder(this, receiver, key);
     JSTaggedValue::RequireObjectCoercible(thread_, receiver, "Cannot load property of null or undefined");
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread_);
 
@@ -276,6 +322,7 @@ static bool IsSupportedICPrimitiveType(JSHandle<JSTaggedValue> receiver)
 
 JSTaggedValue LoadICRuntime::LoadMiss(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key)
 {
+    ICMissRecorder recorder(this, receiver, key);
     if ((!receiver->IsJSObject() || receiver->HasOrdinaryGet()) &&
          !IsSupportedICPrimitiveType(receiver)) {
         return LoadOrdinaryGet(receiver, key);
@@ -394,6 +441,7 @@ JSTaggedValue LoadICRuntime::LoadTypedArrayValueMiss(JSHandle<JSTaggedValue> rec
 JSTaggedValue StoreICRuntime::StoreMiss(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key,
                                         JSHandle<JSTaggedValue> value, bool isOwn, bool isDefPropByName)
 {
+    ICMissRecorder recorder(this, receiver, key);
     ICKind kind = GetICKind();
     if (IsValueIC(kind)) {
         key = JSTaggedValue::ToPropertyKey(GetThread(), key);
@@ -611,4 +659,123 @@ void ICRuntime::TraceIC([[maybe_unused]] JSThread *thread,
     }
 #endif
 }
+
+JSTaggedValue IsInICRuntime::IsInMiss(JSHandle<JSTaggedValue> prop, JSHandle<JSTaggedValue> obj)
+{
+    ICMissRecorder recorder(this, obj, prop);
+    JSTaggedValue result = SlowRuntimeStub::IsIn(thread_, prop.GetTaggedValue(), obj.GetTaggedValue());
+    if (result.IsException() || profileTypeInfo_->GetICSlot(thread_, slotId_).IsHole()) {
+        return result;
+    }
+    JSHandle<JSHClass> hclass(thread_, obj->GetTaggedObject()->GetClass());
+    if (!IsCacheable(prop, *hclass)) {
+        SetAsMega();
+        return result;
+    }
+    ObjectOperator op(thread_, obj, prop);
+    if (op.IsElement()) {
+        SetAsMega();
+        return result;
+    }
+    // an own property stays as long as the hclass does, anything else is checked against the chain
+    JSHandle<JSTaggedValue> marker = thread_->GlobalConstants()->GetHandledUndefined();
+    if (!op.IsFound() || op.IsOnPrototype()) {
+        marker = JSHClass::EnableProtoChangeMarker(thread_, hclass);
+    }
+    AddEntry(hclass, prop, marker, result);
+    return result;
+}
+
+ProfileTypeInfoNexus::ICState IsInICRuntime::GetICState() const
+{
+    JSTaggedValue cache = profileTypeInfo_->GetICSlot(thread_, slotId_);
+    if (cache.IsHole()) {
+        return ProfileTypeInfoNexus::ICState::MEGA;
+    }
+    if (!cache.IsTaggedArray()) {
+        return ProfileTypeInfoNexus::ICState::UNINIT;
+    }
+    return TaggedArray::Cast(cache.GetTaggedObject())->GetLength() == ENTRY_SIZE ?
+        ProfileTypeInfoNexus::ICState::MONO : ProfileTypeInfoNexus::ICState::POLY;
+}
+
+bool IsInICRuntime::IsCacheable(JSHandle<JSTaggedValue> prop, JSHClass *hclass) const
+{
+    // the stub compares keys by identity, other strings would only fill the entries
+    if (prop->IsString()) {
+        if (!EcmaStringAccessor(prop->GetTaggedObject()).IsInternString()) {
+            return false;
+        }
+    } else if (!prop->IsSymbol()) {
+        return false;
+    }
+    // objects whose properties are not all described by their hclasses
+    JSHClass *current = hclass;
+    while (true) {
+        if (current->IsDictionaryMode() || current->IsJSShared() || current->IsJSProxy() || current->IsTypedArray() ||
+            current->IsModuleNamespace() || current->IsJSGlobalObject() || current->IsJsPrimitiveRef() ||
+            current->IsSpecialContainer()) {
+            return false;
+        }
+        JSTaggedValue proto = current->GetPrototype(thread_);
+        if (!proto.IsECMAObject()) {
+            return true;
+        }
+        current = proto.GetTaggedObject()->GetClass();
+    }
+}
+
+void IsInICRuntime::SetAsMega()
+{
+    // the generic path is taken from now on, which is cheaper than a miss on every execution
+    IcAccessorLockScope accessorLockScope(thread_);
+    profileTypeInfo_->SetICSlot(thread_, slotId_, JSTaggedValue::Hole());
+}
+
+void IsInICRuntime::AddEntry(JSHandle<JSHClass> hclass, JSHandle<JSTaggedValue> key,
+                             JSHandle<JSTaggedValue> marker, JSTaggedValue result)
+{
+    ALLOW_LOCAL_TO_SHARE_WEAK_REF_HANDLE;
+    JSHandle<JSTaggedValue> cache(thread_, profileTypeInfo_->GetICSlot(thread_, slotId_));
+    uint32_t length = cache->IsTaggedArray() ? TaggedArray::Cast(cache->GetTaggedObject())->GetLength() : 0;
+    // an entry of the same hclass and key was invalidated by a change of the chain, it is replaced
+    uint32_t keptLength = 0;
+    for (uint32_t i = 0; i < length; i += ENTRY_SIZE) {
+        TaggedArray *entries = TaggedArray::Cast(cache->GetTaggedObject());
+        JSTaggedValue cachedHClass = entries->Get(thread_, i + HCLASS_INDEX);
+        bool isSame = !cachedHClass.IsUndefined() && cachedHClass.GetWeakReferent() == *hclass &&
+                      entries->Get(thread_, i + KEY_INDEX) == key.GetTaggedValue();
+        if (!isSame && !cachedHClass.IsUndefined()) {
+            keptLength += ENTRY_SIZE;
+        }
+    }
+    if (keptLength >= MAX_ENTRY_NUM * ENTRY_SIZE) {
+        SetAsMega();
+        return;
+    }
+    JSHandle<TaggedArray> newCache = thread_->GetEcmaVM()->GetFactory()->NewTaggedArray(keptLength + ENTRY_SIZE);
+    uint32_t newPos = 0;
+    for (uint32_t i = 0; i < length; i += ENTRY_SIZE) {
+        TaggedArray *entries = TaggedArray::Cast(cache->GetTaggedObject());
+        JSTaggedValue cachedHClass = entries->Get(thread_, i + HCLASS_INDEX);
+        if (cachedHClass.IsUndefined() || (cachedHClass.GetWeakReferent() == *hclass &&
+                                           entries->Get(thread_, i + KEY_INDEX) == key.GetTaggedValue())) {
+            continue;
+        }
+        for (uint32_t j = 0; j < ENTRY_SIZE; j++) {
+            newCache->Set(thread_, newPos + j, entries->Get(thread_, i + j));
+        }
+        newPos += ENTRY_SIZE;
+    }
+    newCache->Set(thread_, newPos + HCLASS_INDEX, JSTaggedValue(hclass.GetTaggedValue().CreateAndGetWeakRef()));
+    newCache->Set(thread_, newPos + KEY_INDEX, key.GetTaggedValue());
+    newCache->Set(thread_, newPos + MARKER_INDEX, marker.GetTaggedValue());
+    newCache->Set(thread_, newPos + RESULT_INDEX, result);
+    if (newCache->GetLength() > newPos + ENTRY_SIZE) {
+        // hclasses may have died during the allocation
+        newCache->Trim(thread_, newPos + ENTRY_SIZE);
+    }
+    IcAccessorLockScope accessorLockScope(thread_);
+    profileTypeInfo_->SetICSlot(thread_, slotId_, newCache.GetTaggedValue());
+}
 }  // namespace panda::ecmascript
@@ -46,6 +46,7 @@ public:
     void UpdateReceiverHClass(JSHandle<JSTaggedValue> receiverHClass) { receiverHClass_ = receiverHClass; }
     ICKind GetICKind() const { return nexus_.GetKind(); }
     uint32_t GetSlotId() const { return nexus_.GetSlotId(); }
+    ProfileTypeInfoNexus::ICState GetICState() const { return nexus_.GetICState(); }
     ProfileTypeInfoNexus &GetNexus() { return nexus_; }
     void TraceIC(JSThread *thread, JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key) const;
 
@@ -81,6 +82,41 @@ private:
     JSTaggedValue HandleAccesor(ObjectOperator *op, const JSHandle<JSTaggedValue> &value);
 };
 
+// The `in` operator caches its answer per receiver hclass and key. The only slot of the bytecode holds a TaggedArray
+// of up to MAX_ENTRY_NUM entries, or Hole once the site is megamorphic. An answer which depends on the prototype
+// chain keeps the proto change marker of the receiver hclass, and is dropped when the chain changes.
+class IsInICRuntime {
+public:
+    static constexpr uint32_t HCLASS_INDEX = 0;
+    static constexpr uint32_t KEY_INDEX = 1;
+    static constexpr uint32_t MARKER_INDEX = 2;
+    static constexpr uint32_t RESULT_INDEX = 3;
+    static constexpr uint32_t ENTRY_SIZE = 4;
+    static constexpr uint32_t MAX_ENTRY_NUM = ProfileTypeInfoNexus::POLY_CASE_NUM;
+
+    IsInICRuntime(JSThread *thread, JSHandle<ProfileTypeInfo> profileTypeInfo, uint32_t slotId)
+        : thread_(thread), profileTypeInfo_(profileTypeInfo), slotId_(slotId) {}
+    ~IsInICRuntime() = default;
+
+    JSTaggedValue IsInMiss(JSHandle<JSTaggedValue> prop, JSHandle<JSTaggedValue> obj);
+
+    JSThread *GetThread() const { return thread_; }
+    ICKind GetICKind() const { return ICKind::IsInIC; }
+    uint32_t GetSlotId() const { return slotId_; }
+    // the state the entries of the slot amount to, in the terms of the other ics
+    ProfileTypeInfoNexus::ICState GetICState() const;
+
+private:
+    bool IsCacheable(JSHandle<JSTaggedValue> prop, JSHClass *hclass) const;
+    void SetAsMega();
+    void AddEntry(JSHandle<JSHClass> hclass, JSHandle<JSTaggedValue> key, JSHandle<JSTaggedValue> marker,
+                  JSTaggedValue result);
+
+    JSThread *thread_;
+    JSHandle<ProfileTypeInfo> profileTypeInfo_;
+    uint32_t slotId_;
+};
+
 }  // namespace panda::ecmascript
 
 #endif  // ECMASCRIPT_IC_IC_RUNTIME_H
@@ -89,6 +89,46 @@ JSTaggedValue ICRuntimeStub::CheckPolyHClass(const JSThread *thread, JSTaggedVal
     return JSTaggedValue::Hole();
 }
 
+ARK_INLINE JSTaggedValue ICRuntimeStub::TryIsIn(const JSThread *thread, JSTaggedValue cachedValue, JSTaggedValue prop,
+                                                JSTaggedValue obj)
+{
+    if (!cachedValue.IsTaggedArray() || !obj.IsHeapObject()) {
+        return JSTaggedValue::Hole();
+    }
+    TaggedArray *entries = TaggedArray::Cast(cachedValue.GetTaggedObject());
+    JSHClass *hclass = obj.GetTaggedObject()->GetClass();
+    uint32_t length = entries->GetLength();
+    for (uint32_t i = 0; i < length; i += IsInICRuntime::ENTRY_SIZE) {
+        JSTaggedValue cachedHClass = entries->Get(thread, i + IsInICRuntime::HCLASS_INDEX);
+        if (cachedHClass.IsUndefined() || cachedHClass.GetWeakReferent() != hclass ||
+            entries->Get(thread, i + IsInICRuntime::KEY_INDEX) != prop) {
+            continue;
+        }
+        JSTaggedValue result = entries->Get(thread, i + IsInICRuntime::RESULT_INDEX);
+        JSTaggedValue marker = entries->Get(thread, i + IsInICRuntime::MARKER_INDEX);
+        if (marker.IsProtoChangeMarker()) {
+            ProtoChangeMarker *protoChangeMarker = ProtoChangeMarker::Cast(marker.GetTaggedObject());
+            bool notFoundHasChanged = result.IsFalse() && protoChangeMarker->GetNotFoundHasChanged();
+            if (protoChangeMarker->GetHasChanged() || notFoundHasChanged) {
+                return JSTaggedValue::Hole();
+            }
+        }
+        return result;
+    }
+    return JSTaggedValue::Hole();
+}
+
+ARK_NOINLINE JSTaggedValue ICRuntimeStub::IsInIC(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                 JSTaggedValue prop, JSTaggedValue obj, uint32_t slotId)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    auto propHandle = JSHandle<JSTaggedValue>(thread, prop);
+    auto objHandle = JSHandle<JSTaggedValue>(thread, obj);
+    auto profileInfoHandle = JSHandle<JSTaggedValue>(thread, profileTypeInfo);
+    IsInICRuntime icRuntime(thread, JSHandle<ProfileTypeInfo>::Cast(profileInfoHandle), slotId);
+    return icRuntime.IsInMiss(propHandle, objHandle);
+}
+
 ARK_INLINE JSTaggedValue ICRuntimeStub::TryLoadICByName(JSThread *thread, JSTaggedValue receiver,
                                                         JSTaggedValue firstValue, JSTaggedValue secondValue)
 {
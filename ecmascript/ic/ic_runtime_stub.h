@@ -40,6 +40,10 @@ public:
                                               JSTaggedValue receiver, JSTaggedValue key,
                                               JSTaggedValue value, uint32_t slotId);
     static inline JSTaggedValue CheckPolyHClass(const JSThread *thread, JSTaggedValue cachedValue, JSHClass* hclass);
+    static inline JSTaggedValue TryIsIn(const JSThread *thread, JSTaggedValue cachedValue, JSTaggedValue prop,
+                                        JSTaggedValue obj);
+    static inline JSTaggedValue IsInIC(JSThread *thread, ProfileTypeInfo *profileTypeInfo, JSTaggedValue prop,
+                                       JSTaggedValue obj, uint32_t slotId);
     static inline JSTaggedValue LoadICWithHandler(JSThread *thread, JSTaggedValue receiver, JSTaggedValue holder,
                                                   JSTaggedValue handler);
     static inline JSTaggedValue LoadICWithElementHandler(JSThread *thread, JSTaggedValue receiver,
@@ -13,7 +13,11 @@
  * limitations under the License.
  */
 
+#include <sstream>
+
+#include "ecmascript/dfx/vmstat/ic_profiler.h"
 #include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/ic/ic_runtime_stub-inl.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/global_env.h"
@@ -208,4 +212,177 @@ HWTEST_F_L0(ICRunTimeTest, LoadMiss)
     EXPECT_TRUE(handleProfileTypeInfo->GetICSlot(thread, 0).IsHole());
     EXPECT_TRUE(handleProfileTypeInfo->GetICSlot(thread, 1).IsHole());
 }
+
+HWTEST_F_L0(ICRunTimeTest, IsInMiss)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objectProto = env->GetObjectFunctionPrototype();
+    JSHandle<JSTaggedValue> proto(factory->OrdinaryNewJSObjectCreate(objectProto));
+    JSHandle<JSTaggedValue> receiver(factory->OrdinaryNewJSObjectCreate(proto));
+    JSHandle<JSTaggedValue> ownKey(factory->NewFromASCII("own"));
+    JSHandle<JSTaggedValue> missingKey(factory->NewFromASCII("missing"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+    JSObject::SetProperty(thread, receiver, ownKey, value);
+
+    JSHandle<ProfileTypeInfo> profileTypeInfo = factory->NewProfileTypeInfo(1);
+    IsInICRuntime icRuntime(thread, profileTypeInfo, 0);
+    EXPECT_EQ(icRuntime.IsInMiss(ownKey, receiver), JSTaggedValue::True());
+    EXPECT_EQ(icRuntime.IsInMiss(missingKey, receiver), JSTaggedValue::False());
+    JSTaggedValue cache = profileTypeInfo->GetICSlot(thread, 0);
+    ASSERT_TRUE(cache.IsTaggedArray());
+    EXPECT_EQ(TaggedArray::Cast(cache.GetTaggedObject())->GetLength(), 2 * IsInICRuntime::ENTRY_SIZE);
+    EXPECT_EQ(ICRuntimeStub::TryIsIn(thread, cache, ownKey.GetTaggedValue(), receiver.GetTaggedValue()),
+              JSTaggedValue::True());
+    EXPECT_EQ(ICRuntimeStub::TryIsIn(thread, cache, missingKey.GetTaggedValue(), receiver.GetTaggedValue()),
+              JSTaggedValue::False());
+
+    // the missing key turns up on the prototype, only the answer depending on the chain is dropped
+    JSObject::SetProperty(thread, proto, missingKey, value);
+    cache = profileTypeInfo->GetICSlot(thread, 0);
+    EXPECT_EQ(ICRuntimeStub::TryIsIn(thread, cache, ownKey.GetTaggedValue(), receiver.GetTaggedValue()),
+              JSTaggedValue::True());
+    EXPECT_TRUE(ICRuntimeStub::TryIsIn(thread, cache, missingKey.GetTaggedValue(),
+                                       receiver.GetTaggedValue()).IsHole());
+    EXPECT_EQ(icRuntime.IsInMiss(missingKey, receiver), JSTaggedValue::True());
+    cache = profileTypeInfo->GetICSlot(thread, 0);
+    EXPECT_EQ(TaggedArray::Cast(cache.GetTaggedObject())->GetLength(), 2 * IsInICRuntime::ENTRY_SIZE);
+    EXPECT_EQ(ICRuntimeStub::TryIsIn(thread, cache, missingKey.GetTaggedValue(), receiver.GetTaggedValue()),
+              JSTaggedValue::True());
+}
+
+HWTEST_F_L0(ICRunTimeTest, IsInMissMega)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> receiver(factory->OrdinaryNewJSObjectCreate(env->GetObjectFunctionPrototype()));
+    JSHandle<JSTaggedValue> ownKey(factory->NewFromASCII("own"));
+    JSHandle<JSTaggedValue> elementKey(factory->NewFromASCII("0"));
+    JSObject::SetProperty(thread, receiver, ownKey, JSHandle<JSTaggedValue>(thread, JSTaggedValue(1)));
+
+    JSHandle<ProfileTypeInfo> profileTypeInfo = factory->NewProfileTypeInfo(1);
+    IsInICRuntime icRuntime(thread, profileTypeInfo, 0);
+    EXPECT_EQ(icRuntime.IsInMiss(ownKey, receiver), JSTaggedValue::True());
+    EXPECT_TRUE(profileTypeInfo->GetICSlot(thread, 0).IsTaggedArray());
+    // element keys are not cached, the site goes megamorphic and stays so
+    EXPECT_EQ(icRuntime.IsInMiss(elementKey, receiver), JSTaggedValue::False());
+    EXPECT_TRUE(profileTypeInfo->GetICSlot(thread, 0).IsHole());
+    EXPECT_EQ(icRuntime.IsInMiss(ownKey, receiver), JSTaggedValue::True());
+    EXPECT_TRUE(profileTypeInfo->GetICSlot(thread, 0).IsHole());
+}
+
+HWTEST_F_L0(ICRunTimeTest, ICProfilerRecordsTransitions)
+{
+    using ICState = ICProfiler::ICState;
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> key(factory->NewFromASCII("x"));
+    JSHandle<JSObject> object = factory->OrdinaryNewJSObjectCreate(env->GetObjectFunctionPrototype());
+    JSHandle<JSArray> array = factory->NewJSArray();
+
+    ICProfiler profiler;
+    ICProfiler::Miss miss;
+    miss.kind = ICKind::NamedLoadIC;
+    miss.slotId = 0;
+    miss.key = key.GetTaggedValue();
+    miss.hclass = object->GetClass();
+    miss.before = ICState::UNINIT;
+    miss.after = ICState::MONO;
+    profiler.RecordMiss(thread, miss);
+    miss.hclass = array->GetClass();
+    miss.before = ICState::MONO;
+    miss.after = ICState::POLY;
+    profiler.RecordMiss(thread, miss);
+    // a miss which leaves the state as it is still counts, the hclass is not added twice
+    miss.before = ICState::POLY;
+    profiler.RecordMiss(thread, miss);
+
+    ICProfiler::Miss monoMiss;
+    monoMiss.kind = ICKind::NamedStoreIC;
+    monoMiss.slotId = 2;  // 2: the slot after the load
+    monoMiss.key = key.GetTaggedValue();
+    monoMiss.hclass = object->GetClass();
+    monoMiss.before = ICState::UNINIT;
+    monoMiss.after = ICState::MONO;
+    profiler.RecordMiss(thread, monoMiss);
+
+    // there is no js frame here, the misses go to the function for those
+    const ICProfiler::Function *function = profiler.FindFunction(ICProfiler::NO_FRAME_NAME);
+    ASSERT_TRUE(function != nullptr);
+    EXPECT_EQ(function->missCount, 4U);
+    EXPECT_EQ(function->WorstState(), ICState::POLY);
+    std::vector<const ICProfiler::Site *> sites = ICProfiler::RankSites(*function);
+    ASSERT_EQ(sites.size(), 2U);
+    EXPECT_EQ(sites[0]->slotId, 0U);
+    EXPECT_EQ(sites[0]->key, "x");
+    EXPECT_EQ(sites[0]->state, ICState::POLY);
+    EXPECT_EQ(sites[0]->missCount, 3U);
+    EXPECT_EQ(sites[0]->hclasses.size(), 2U);
+    EXPECT_EQ(sites[0]->TransitionCount(ICState::UNINIT, ICState::MONO), 1U);
+    EXPECT_EQ(sites[0]->TransitionCount(ICState::MONO, ICState::POLY), 1U);
+    EXPECT_EQ(sites[0]->TransitionCount(ICState::POLY, ICState::POLY), 0U);
+    EXPECT_EQ(sites[1]->state, ICState::MONO);
+
+    std::ostringstream report;
+    profiler.Dump(report);
+    EXPECT_NE(report.str().find("mono->poly"), std::string::npos);
+    EXPECT_NE(report.str().find(ICProfiler::NO_FRAME_NAME), std::string::npos);
+    profiler.Reset();
+    EXPECT_EQ(profiler.GetSiteCount(), 0U);
+}
+
+HWTEST_F_L0(ICRunTimeTest, ICProfilerRecordsRealMisses)
+{
+    using ICState = ICProfiler::ICState;
+    // the profiler of the vm is only there with the option, the fixture vm is replaced by one which has it
+    TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    JSRuntimeOptions options;
+    options.SetEnableICProfiler(true);
+    instance = JSNApi::CreateEcmaVM(options);
+    ASSERT_TRUE(instance != nullptr);
+    thread = instance->GetJSThread();
+    thread->ManagedCodeBegin();
+    scope = new EcmaHandleScope(thread);
+    ICProfiler *profiler = instance->GetICProfiler();
+    ASSERT_TRUE(profiler != nullptr);
+
+    ObjectFactory *factory = instance->GetFactory();
+    JSHandle<GlobalEnv> env = instance->GetGlobalEnv();
+    JSHandle<JSTaggedValue> key(factory->NewFromASCII("x"));
+    JSHandle<JSTaggedValue> otherKey(factory->NewFromASCII("y"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+    JSHandle<JSTaggedValue> first(factory->OrdinaryNewJSObjectCreate(env->GetObjectFunctionPrototype()));
+    JSObject::SetProperty(thread, first, key, value);
+    // another layout, so that the second receiver brings a second hclass
+    JSHandle<JSTaggedValue> second(factory->OrdinaryNewJSObjectCreate(env->GetObjectFunctionPrototype()));
+    JSObject::SetProperty(thread, second, otherKey, value);
+    JSObject::SetProperty(thread, second, key, value);
+
+    JSHandle<ProfileTypeInfo> profileTypeInfo = factory->NewProfileTypeInfo(3);  // 3: the load ic and the in ic
+    LoadICRuntime loadICRuntime(thread, profileTypeInfo, 0, ICKind::NamedLoadIC);
+    EXPECT_EQ(loadICRuntime.LoadMiss(first, key), value.GetTaggedValue());
+    EXPECT_EQ(loadICRuntime.GetICState(), ICState::MONO);
+    EXPECT_EQ(loadICRuntime.LoadMiss(second, key), value.GetTaggedValue());
+    EXPECT_EQ(loadICRuntime.GetICState(), ICState::POLY);
+    IsInICRuntime isInICRuntime(thread, profileTypeInfo, 2);  // 2: the slot after the load ic
+    EXPECT_EQ(isInICRuntime.IsInMiss(key, first), JSTaggedValue::True());
+    EXPECT_EQ(isInICRuntime.GetICState(), ICState::MONO);
+
+    const ICProfiler::Function *function = profiler->FindFunction(ICProfiler::NO_FRAME_NAME);
+    ASSERT_TRUE(function != nullptr);
+    EXPECT_EQ(function->missCount, 3U);
+    auto load = function->sites.find(0);
+    ASSERT_TRUE(load != function->sites.end());
+    EXPECT_EQ(load->second.kind, ICKind::NamedLoadIC);
+    EXPECT_EQ(load->second.state, ICState::POLY);
+    EXPECT_EQ(load->second.TransitionCount(ICState::UNINIT, ICState::MONO), 1U);
+    EXPECT_EQ(load->second.TransitionCount(ICState::MONO, ICState::POLY), 1U);
+    EXPECT_EQ(load->second.hclasses.size(), 2U);
+    auto isIn = function->sites.find(2);  // 2: the slot of the in ic
+    ASSERT_TRUE(isIn != function->sites.end());
+    EXPECT_EQ(isIn->second.kind, ICKind::IsInIC);
+    EXPECT_EQ(isIn->second.key, "x");
+    EXPECT_EQ(isIn->second.TransitionCount(ICState::UNINIT, ICState::MONO), 1U);
+    profiler->Reset();
+}
 }  // namespace panda::test
@@ -2315,6 +2315,26 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                    << " v" << v0;
         JSTaggedValue prop = GET_VREG_VALUE(v0);
         JSTaggedValue obj = GET_ACC();
+#if ECMASCRIPT_ENABLE_IC
+        auto profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+        if (!profileTypeInfo.IsUndefined()) {
+            uint16_t slotId = READ_INST_8_0();
+            auto profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+            JSTaggedValue cachedValue = profileTypeArray->GetICSlot(thread, slotId);
+            JSTaggedValue res = ICRuntimeStub::TryIsIn(thread, cachedValue, prop, obj);
+            if (LIKELY(!res.IsHole())) {
+                SET_ACC(res);
+                DISPATCH(ISIN_IMM8_V8);
+            }
+            if (!cachedValue.IsHole()) {
+                SAVE_PC();
+                res = ICRuntimeStub::IsInIC(thread, profileTypeArray, prop, obj, slotId);
+                INTERPRETER_RETURN_IF_ABRUPT(res);
+                SET_ACC(res);
+                DISPATCH(ISIN_IMM8_V8);
+            }
+        }
+#endif
         SAVE_PC();
         JSTaggedValue res = SlowRuntimeStub::IsIn(thread, prop, obj);
         INTERPRETER_RETURN_IF_ABRUPT(res);
@@ -14,6 +14,7 @@
  */
 
 #include "ecmascript/jit/compile_decision.h"
+#include "ecmascript/jit/jit_compile_queue.h"
 #include "ecmascript/jspandafile/js_pandafile.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/platform/aot_crash_info.h"
@@ -157,6 +158,25 @@ uint32_t CompileDecision::GetCodeSize() const
     return method->GetCodeSize(thread);
 }
 
+uint32_t CompileDecision::GetHotness() const
+{
+    JSTaggedValue profileTypeInfoVal = jsFunction_->GetProfileTypeInfo(vm_->GetJSThread());
+    if (!profileTypeInfoVal.IsHeapObject()) {
+        return 0;
+    }
+    ProfileTypeInfo *profileTypeInfo = ProfileTypeInfo::Cast(profileTypeInfoVal.GetTaggedObject());
+    uint32_t hotness = static_cast<uint32_t>(profileTypeInfo->GetJitHotnessCnt()) + profileTypeInfo->GetJitCallCnt();
+    if (osrOffset_ != MachineCode::INVALID_OSR_OFFSET) {
+        hotness += profileTypeInfo->GetOsrHotnessCnt();
+    }
+    return hotness;
+}
+
+uint64_t CompileDecision::GetBenefit() const
+{
+    return JitCompileQueue::ComputeBenefit(GetHotness(), GetCodeSize());
+}
+
 bool CompileDecision::Decision()
 {
     return IsGoodCompilationRequest();
@@ -248,7 +268,7 @@ bool CompileDecision::IsSupportFunctionKind() const
 
 bool CompileDecision::CheckJsFunctionStatus() const
 {
-    if (tier_.IsFastJit() && jsFunction_->IsJitCompiling()) {
+    if ((tier_.IsFastJit() || tier_.IsArkSteed()) && jsFunction_->IsJitCompiling()) {
         return false;
     }
 
@@ -256,7 +276,7 @@ bool CompileDecision::CheckJsFunctionStatus() const
         return false;
     }
 
-    if (tier_.IsFastJit() && jsFunction_->IsCompiledCode()) {
+    if ((tier_.IsFastJit() || tier_.IsArkSteed()) && jsFunction_->IsCompiledCode()) {
         JSTaggedValue machineCode = jsFunction_->GetMachineCode(vm_->GetJSThread());
         if (machineCode.IsMachineCodeObject() &&
             MachineCode::Cast(machineCode.GetTaggedObject())->GetOSROffset() == MachineCode::INVALID_OSR_OFFSET) {
@@ -74,6 +74,11 @@ public:
         return tier_ == Tier::ARKSTEED;
     }
 
+    Tier GetTier() const
+    {
+        return tier_;
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const CompilerTier &tier)
     {
         if (tier.IsFast()) {
@@ -131,6 +136,10 @@ public:
     CString GetMethodInfo() const;
     CString GetMethodName() const;
     uint32_t GetCodeSize() const;
+    // hotness counted by the interpreter profiler when the compilation was requested
+    uint32_t GetHotness() const;
+    // what the compilation is expected to gain, used to order the tasks of the jit thread
+    uint64_t GetBenefit() const;
     int32_t GetOsrOffset() const
     {
         return osrOffset_;
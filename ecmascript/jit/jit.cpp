@@ -193,7 +193,24 @@ void Jit::SetEnableOrDisable(const JSRuntimeOptions &options, bool isEnableFastJ
         fastJitEnable_ = isEnableFastJit;
         baselineJitEnable_ = isEnableBaselineJit;
         hotnessThreshold_ = options.GetJitHotnessThreshold();
+        if (baselineJitEnable_) {
+            CreateCodeCache(options);
+        }
+    }
+}
+
+void Jit::CreateCodeCache(const JSRuntimeOptions &options)
+{
+    if (codeCache_ != nullptr || !options.IsEnableJitCodeCache()) {
+        return;
     }
+#ifdef JIT_ENABLE_CODE_SIGN
+    // code loaded from the cache has no signature to install into the fort
+    if (!options.GetDisableCodeSign()) {
+        return;
+    }
+#endif
+    codeCache_ = std::make_unique<JitCodeCache>(options.GetJitCodeCachePath());
 }
 
 void Jit::Destroy()
@@ -206,6 +223,10 @@ void Jit::Destroy()
     initialized_ = false;
     fastJitEnable_ = false;
     baselineJitEnable_ = false;
+    if (codeCache_ != nullptr) {
+        codeCache_->Flush();
+        codeCache_ = nullptr;
+    }
     ASSERT(jitResources_ != nullptr);
     jitResources_->Destroy();
     jitResources_ = nullptr;
@@ -318,14 +339,22 @@ void Jit::Compile(EcmaVM *vm, const CompileDecision &decision)
             ThreadNativeScope scope(vm->GetJSThread());
             JitTaskpool::GetCurrentTaskpool()->WaitForJitTaskPoolReady();
         }
+        if (TryInstallCachedCode(vm, decision)) {
+            return;
+        }
         EcmaVM *compilerVm = JitTaskpool::GetCurrentTaskpool()->GetCompilerVm();
         std::shared_ptr<JitTask> jitTask = std::make_shared<JitTask>(vm->GetJSThread(),
             // avoid check fail when enable multi-thread check
             compilerVm->GetJSThreadNoCheck(), this, jsFunction, tier, methodName, osrOffset, mode);
 
         jitTask->PrepareCompile();
-        JitTaskpool::GetCurrentTaskpool()->PostTask(
-            std::make_unique<JitTask::AsyncTask>(jitTask, vm->GetJSThread()->GetThreadId()));
+        JitCompileQueue::TaskInfo taskInfo {decision.GetBenefit(), mode.IsSync(), jitTask->IsOsrTask()};
+        taskInfo.onExpired = [this, jitTask]() {
+            jitTask->SetExpired();
+            RequestInstallCode(jitTask);
+        };
+        JitTaskpool::GetCurrentTaskpool()->PostCompileTask(
+            std::make_unique<JitTask::AsyncTask>(jitTask, vm->GetJSThread()->GetThreadId()), taskInfo);
         if (mode.IsSync()) {
             // sync mode, also compile in taskpool as litecg unsupport parallel compile,
             // wait task compile finish then install code
@@ -338,6 +367,30 @@ void Jit::Compile(EcmaVM *vm, const CompileDecision &decision)
     }
 }
 
+bool Jit::TryInstallCachedCode(EcmaVM *vm, const CompileDecision &decision)
+{
+    if (codeCache_ == nullptr || !decision.GetTier().IsBaseLine() ||
+        decision.GetOsrOffset() != MachineCode::INVALID_OSR_OFFSET) {
+        return false;
+    }
+    JSThread *thread = vm->GetJSThread();
+    auto jsFunction = decision.GetJsFunction();
+    Method *method = Method::Cast(jsFunction->GetMethod(thread).GetTaggedObject());
+    JitCodeCache::CachedCode cachedCode;
+    if (!codeCache_->Lookup(thread, method, decision.GetTier(), cachedCode)) {
+        return false;
+    }
+    auto methodName = decision.GetMethodName();
+    EcmaVM *compilerVm = JitTaskpool::GetCurrentTaskpool()->GetCompilerVm();
+    std::shared_ptr<JitTask> jitTask = std::make_shared<JitTask>(thread, compilerVm->GetJSThreadNoCheck(), this,
+        jsFunction, decision.GetTier(), methodName, decision.GetOsrOffset(), decision.GetCompileMode());
+    if (!jitTask->InstallCachedCode(cachedCode)) {
+        return false;
+    }
+    LOG_BASELINEJIT(DEBUG) << "Install baseline jit code from cache: " << decision.GetMethodInfo();
+    return true;
+}
+
 void Jit::RequestInstallCode(std::shared_ptr<JitTask> jitTask)
 {
     LockHolder holder(threadTaskInfoLock_);
@@ -376,6 +429,10 @@ void Jit::InstallTasks(JSThread *jsThread)
     for (auto it = taskQueue.begin(); it != taskQueue.end(); it++) {
         std::shared_ptr<JitTask> task = *it;
         // check task state
+        if (task->IsExpired()) {
+            task->ResetCompilingState();
+            continue;
+        }
         task->InstallCode();
     }
 }
@@ -402,7 +459,7 @@ void Jit::DeleteJitCompilerTask(void *compiler)
 
 void Jit::ClearTask(const std::function<bool(common::Task *task)> &checkClear)
 {
-    JitTaskpool::GetCurrentTaskpool()->ForEachTask([&checkClear](common::Task *task) {
+    JitTaskpool::GetCurrentTaskpool()->ForEachCompileTask([&checkClear](common::Task *task) {
         JitTask::AsyncTask *asyncTask = static_cast<JitTask::AsyncTask*>(task);
         if (checkClear(asyncTask)) {
             asyncTask->Terminated();
@@ -429,6 +486,11 @@ void Jit::ClearTaskWithVm(EcmaVM *vm)
             info.jitTaskCntCv_.Wait(&threadTaskInfoLock_);
         }
     }
+
+    if (codeCache_ != nullptr) {
+        // written in the background, and only if this vm added code since the last flush
+        codeCache_->RequestFlush(static_cast<int32_t>(vm->GetJSThread()->GetThreadId()));
+    }
 }
 
 void Jit::IncJitTaskCnt(JSThread *thread)
@@ -463,8 +525,10 @@ void Jit::ChangeTaskPoolState(bool inBackground)
     if (fastJitEnable_ || baselineJitEnable_) {
         if (inBackground) {
             JitTaskpool::GetCurrentTaskpool()->SetThreadPriority(common::PriorityMode::BACKGROUND);
+            JitTaskpool::GetCurrentTaskpool()->SetCompileBudget(JitCompileQueue::BACKGROUND_BUDGET_US);
         } else {
             JitTaskpool::GetCurrentTaskpool()->SetThreadPriority(common::PriorityMode::FOREGROUND);
+            JitTaskpool::GetCurrentTaskpool()->SetCompileBudget(JitCompileQueue::FOREGROUND_BUDGET_US);
         }
     }
 }
@@ -576,9 +640,15 @@ void Jit::CompileArkSteed(EcmaVM *vm, JSHandle<JSFunction> &jsFunction,
 
         arkSteedTask->PrepareCompile();
 
-        JitTaskpool::GetCurrentTaskpool()->PostTask(
+        JitCompileQueue::TaskInfo taskInfo {compileDecision.GetBenefit(), mode.IsSync(),
+                                            osrOffset != MachineCode::INVALID_OSR_OFFSET};
+        taskInfo.onExpired = [jit, arkSteedTask]() {
+            arkSteedTask->SetExpired();
+            jit->RequestInstallCode(arkSteedTask);
+        };
+        JitTaskpool::GetCurrentTaskpool()->PostCompileTask(
             std::make_unique<arksteed::ArkSteedTask::AsyncTask>(
-                arkSteedTask, vm->GetJSThread()->GetThreadId()));
+                arkSteedTask, vm->GetJSThread()->GetThreadId()), taskInfo);
 
         if (mode.IsSync()) {
             arkSteedTask->WaitFinish();
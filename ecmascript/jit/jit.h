@@ -27,6 +27,7 @@
 #include "ecmascript/jit/jit_thread.h"
 #include "ecmascript/jit/jit_dfx.h"
 #include "ecmascript/jit/compile_decision.h"
+#include "ecmascript/jit/jit_code_cache.h"
 #include "ecmascript/jit/jit_resources.h"
 
 namespace panda::ecmascript {
@@ -116,6 +117,12 @@ public:
         return jitDfx_;
     }
 
+    // nullptr if the persistent jit code cache is disabled
+    JitCodeCache *GetCodeCache() const
+    {
+        return codeCache_.get();
+    }
+
     void IncJitTaskCnt(JSThread *thread);
     void DecJitTaskCnt(JSThread *thread);
 
@@ -257,6 +264,8 @@ private:
 #endif
     void CreateJitResources();
     bool IsLibResourcesResolved() const;
+    void CreateCodeCache(const JSRuntimeOptions &options);
+    bool TryInstallCachedCode(EcmaVM *vm, const CompileDecision &decision);
     bool initialized_ { false };
     bool fastJitEnable_ { false };
     bool baselineJitEnable_ { false };
@@ -275,6 +284,7 @@ private:
 
     JitDfx *jitDfx_ { nullptr };
     std::unique_ptr<JitResources> jitResources_;
+    std::unique_ptr<JitCodeCache> codeCache_;
     static constexpr int MIN_CODE_SPACE_SIZE = 1_KB;
 };
 }  // namespace panda::ecmascript
@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/jit/jit_code_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "common_components/taskpool/taskpool.h"
+#include "ecmascript/ic/profile_type_info_cell.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/js_thread.h"
+#include "ecmascript/jspandafile/js_pandafile.h"
+#include "ecmascript/method.h"
+#include "ecmascript/platform/os.h"
+
+namespace panda::ecmascript {
+namespace {
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261U;
+constexpr uint32_t FNV_PRIME = 16777619U;
+constexpr uint32_t MAX_CACHE_ENTRIES = 64 * 1024;
+constexpr uint32_t MAX_CACHED_CODE_SIZE = 16 * 1024 * 1024;
+constexpr uint32_t BITS_PER_BYTE = 8;
+#if defined(PANDA_TARGET_AMD64)
+constexpr uint32_t ARCH_X64 = 1;
+// movabs: REX.W prefix and opcode, followed by the 64-bit immediate
+constexpr uint32_t X64_MOVABS_IMM_OFFSET = 2;
+#elif defined(PANDA_TARGET_ARM64)
+constexpr uint32_t ARCH_AARCH64 = 2;
+// movz + 3 movk, each carrying 16 bits of the address in bits [20:5]
+constexpr uint32_t AARCH64_MOV_SEQUENCE_LENGTH = 4;
+constexpr uint32_t AARCH64_IMM16_SHIFT = 5;
+constexpr uint32_t AARCH64_IMM16_MASK = 0xFFFFU;
+constexpr uint32_t HWORD_BITS = 16;
+#endif
+
+inline uint32_t HashCombine(uint32_t hash, uint32_t value)
+{
+    for (uint32_t i = 0; i < sizeof(uint32_t); i++) {
+        hash ^= (value >> (i * BITS_PER_BYTE)) & 0xFFU;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+template<class T>
+bool ReadPod(std::ifstream &file, T &value)
+{
+    file.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return file.good();
+}
+
+template<class T>
+bool ReadVector(std::ifstream &file, std::vector<T> &vec, size_t count)
+{
+    vec.resize(count);
+    if (count == 0) {
+        return true;
+    }
+    file.read(reinterpret_cast<char *>(vec.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    return file.good();
+}
+
+template<class T>
+void WritePod(std::ofstream &file, const T &value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template<class T>
+void WriteVector(std::ofstream &file, const std::vector<T> &vec)
+{
+    if (!vec.empty()) {
+        file.write(reinterpret_cast<const char *>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(T)));
+    }
+}
+}  // namespace
+
+uint32_t JitCodeCache::GetArch()
+{
+#if defined(PANDA_TARGET_AMD64)
+    return ARCH_X64;
+#elif defined(PANDA_TARGET_ARM64)
+    return ARCH_AARCH64;
+#else
+    return 0;
+#endif
+}
+
+uint32_t JitCodeCache::GetRuntimeStamp()
+{
+    // Baseline code hard codes the stub ids and the few object offsets below, a runtime that changes any of them
+    // must not reuse code cached by another build.
+    uint32_t stamp = FNV_OFFSET_BASIS;
+    stamp = HashCombine(stamp, static_cast<uint32_t>(BaselineStubEntries::COUNT));
+    stamp = HashCombine(stamp, static_cast<uint32_t>(JSFunction::RAW_PROFILE_TYPE_INFO_OFFSET));
+    stamp = HashCombine(stamp, static_cast<uint32_t>(JSFunctionBase::METHOD_OFFSET));
+    stamp = HashCombine(stamp, static_cast<uint32_t>(Method::LITERAL_INFO_OFFSET));
+    stamp = HashCombine(stamp, static_cast<uint32_t>(ProfileTypeInfoCell::VALUE_OFFSET));
+    return stamp;
+}
+
+uint32_t JitCodeCache::ComputeProfileHash(JSThread *thread, Method *method)
+{
+    // Baseline code is laid out from the bytecode and the ic slot layout of the method only.
+    uint32_t hash = FNV_OFFSET_BASIS;
+    hash = HashCombine(hash, method->GetSlotSize());
+    hash = HashCombine(hash, method->GetNumberVRegs());
+    uint32_t codeSize = method->GetCodeSize(thread);
+    hash = HashCombine(hash, codeSize);
+    const uint8_t *bytecode = method->GetBytecodeArray();
+    for (uint32_t i = 0; i < codeSize; i++) {
+        hash ^= bytecode[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t JitCodeCache::ComputePayloadHash(const Entry &entry)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    hash = HashCombine(hash, static_cast<uint32_t>(entry.code.size()));
+    hash = HashCombine(hash, static_cast<uint32_t>(entry.offsetTable.size()));
+    hash = HashCombine(hash, static_cast<uint32_t>(entry.relocations.size()));
+    for (uint8_t byte : entry.code) {
+        hash ^= byte;
+        hash *= FNV_PRIME;
+    }
+    for (uint8_t byte : entry.offsetTable) {
+        hash ^= byte;
+        hash *= FNV_PRIME;
+    }
+    for (const Relocation &relocation : entry.relocations) {
+        hash = HashCombine(hash, relocation.offset);
+        hash = HashCombine(hash, relocation.stubId);
+    }
+    return hash;
+}
+
+JitCodeCache::~JitCodeCache()
+{
+    WaitAllTasksFinished();
+}
+
+bool JitCodeCache::MakeKey(JSThread *thread, Method *method, CompilerTier tier, Key &key)
+{
+    const JSPandaFile *jsPandaFile = method->GetJSPandaFile(thread);
+    if (jsPandaFile == nullptr) {
+        return false;
+    }
+    key.abcChecksum = jsPandaFile->GetChecksum();
+    key.methodId = method->GetMethodId().GetOffset();
+    key.tier = tier.GetTier();
+    key.profileHash = ComputeProfileHash(thread, method);
+    return true;
+}
+
+bool JitCodeCache::Lookup(JSThread *thread, Method *method, CompilerTier tier, CachedCode &result)
+{
+    Key key;
+    if (!MakeKey(thread, method, tier, key)) {
+        return false;
+    }
+    return Lookup(thread, key, result);
+}
+
+bool JitCodeCache::Lookup(JSThread *thread, const Key &key, CachedCode &result)
+{
+    LockHolder lock(mutex_);
+    FileCache &fileCache = GetFileCache(static_cast<int32_t>(thread->GetThreadId()), key.abcChecksum);
+    if (fileCache.state != LoadState::LOADED) {
+        missCount_++;
+        return false;
+    }
+    auto iter = fileCache.entries.find(GetKey(key.methodId, key.tier));
+    if (iter == fileCache.entries.end()) {
+        missCount_++;
+        return false;
+    }
+    Entry &entry = iter->second;
+    if (entry.index.profileHash != key.profileHash) {
+        LOG_JIT(DEBUG) << "JitCodeCache: drop stale entry of method " << key.methodId;
+        fileCache.entries.erase(iter);
+        fileCache.dirty = true;
+        missCount_++;
+        return false;
+    }
+    result.code = entry.code;
+    result.offsetTable = entry.offsetTable;
+    if (!Relocate(thread, entry, result.code)) {
+        fileCache.entries.erase(iter);
+        fileCache.dirty = true;
+        missCount_++;
+        return false;
+    }
+    hitCount_++;
+    return true;
+}
+
+void JitCodeCache::Record(JSThread *thread, Method *method, CompilerTier tier, const MachineCodeDesc &desc)
+{
+    Key key;
+    if (!MakeKey(thread, method, tier, key)) {
+        return;
+    }
+    Record(thread, key, desc);
+}
+
+void JitCodeCache::Record(JSThread *thread, const Key &key, const MachineCodeDesc &desc)
+{
+    if (!desc.stubCallsPatchable || desc.codeSize == 0 || desc.codeSize > MAX_CACHED_CODE_SIZE) {
+        return;
+    }
+    Entry entry;
+    entry.index.methodId = key.methodId;
+    entry.index.tier = static_cast<uint32_t>(key.tier);
+    entry.index.profileHash = key.profileHash;
+    const uint8_t *code = reinterpret_cast<const uint8_t *>(desc.codeAddr);
+    entry.code.assign(code, code + desc.codeSize);
+    const uint8_t *offsetTable = reinterpret_cast<const uint8_t *>(desc.stackMapOrOffsetTableAddr);
+    entry.offsetTable.assign(offsetTable, offsetTable + desc.stackMapOrOffsetTableSize);
+
+    LockHolder lock(mutex_);
+    const StubRelocation *stubRelocations = reinterpret_cast<const StubRelocation *>(desc.stubRelocationAddr);
+    for (size_t i = 0; i < desc.stubRelocationCount; i++) {
+        int32_t stubId = FindStubId(thread, stubRelocations[i].target);
+        if (stubId < 0) {
+            // not a baseline stub, the code can't be relocated in another process
+            return;
+        }
+        entry.relocations.push_back({stubRelocations[i].offset, static_cast<uint32_t>(stubId)});
+    }
+    entry.index.codeSize = static_cast<uint32_t>(entry.code.size());
+    entry.index.offsetTableSize = static_cast<uint32_t>(entry.offsetTable.size());
+    entry.index.relocationCount = static_cast<uint32_t>(entry.relocations.size());
+    entry.index.payloadHash = ComputePayloadHash(entry);
+
+    int32_t id = static_cast<int32_t>(thread->GetThreadId());
+    FileCache &fileCache = GetFileCache(id, key.abcChecksum);
+    if (fileCache.entries.size() >= MAX_CACHE_ENTRIES) {
+        return;
+    }
+    fileCache.entries[GetKey(key.methodId, key.tier)] = std::move(entry);
+    fileCache.dirty = true;
+    if (++unflushedCount_ >= FLUSH_BATCH_SIZE) {
+        PostFlushTask(id);
+    }
+}
+
+void JitCodeCache::RequestFlush(int32_t id)
+{
+    LockHolder lock(mutex_);
+    if (unflushedCount_ > 0) {
+        PostFlushTask(id);
+    }
+}
+
+void JitCodeCache::Flush()
+{
+    WaitAllTasksFinished();
+    // the load tasks of these were dropped, the code on disk has to be merged before the file is rewritten
+    std::vector<uint32_t> unloaded;
+    {
+        LockHolder lock(mutex_);
+        for (const auto &it : files_) {
+            if (it.second.dirty && it.second.state != LoadState::LOADED) {
+                unloaded.push_back(it.first);
+            }
+        }
+    }
+    for (uint32_t abcChecksum : unloaded) {
+        LoadFile(abcChecksum);
+    }
+    FlushFiles();
+    LOG_JIT(INFO) << "JitCodeCache: hit " << hitCount_ << ", miss " << missCount_;
+}
+
+void JitCodeCache::WaitAllTasksFinished()
+{
+    LockHolder lock(mutex_);
+    while (runningTaskCount_ > 0) {
+        taskFinishedCV_.Wait(&mutex_);
+    }
+}
+
+bool JitCodeCache::IsLoaded(uint32_t abcChecksum)
+{
+    LockHolder lock(mutex_);
+    auto iter = files_.find(abcChecksum);
+    return iter != files_.end() && iter->second.state == LoadState::LOADED;
+}
+
+JitCodeCache::FileCache &JitCodeCache::GetFileCache(int32_t id, uint32_t abcChecksum)
+{
+    auto result = files_.try_emplace(abcChecksum);
+    FileCache &fileCache = result.first->second;
+    if (result.second) {
+        std::stringstream path;
+        path << cachePath_ << "/" << std::hex << std::setw(8) << std::setfill('0')  // 8: hex digits
+             << abcChecksum << ".jitcache";
+        fileCache.path = path.str();
+        fileCache.abcChecksum = abcChecksum;
+    }
+    if (fileCache.state == LoadState::UNLOADED) {
+        fileCache.state = LoadState::LOADING;
+        runningTaskCount_++;
+        common::Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<LoadTask>(id, this, abcChecksum));
+    }
+    return fileCache;
+}
+
+void JitCodeCache::PostFlushTask(int32_t id)
+{
+    if (flushPosted_) {
+        return;
+    }
+    flushPosted_ = true;
+    runningTaskCount_++;
+    common::Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<FlushTask>(id, this));
+}
+
+void JitCodeCache::FinishTask()
+{
+    if (--runningTaskCount_ == 0) {
+        taskFinishedCV_.SignalAll();
+    }
+}
+
+void JitCodeCache::FinishLoadTask(uint32_t abcChecksum)
+{
+    LockHolder lock(mutex_);
+    FileCache &fileCache = files_[abcChecksum];
+    if (fileCache.state == LoadState::LOADING) {
+        // dropped without running, try again on the next lookup
+        fileCache.state = LoadState::UNLOADED;
+    }
+    FinishTask();
+}
+
+void JitCodeCache::FinishFlushTask()
+{
+    LockHolder lock(mutex_);
+    flushPosted_ = false;
+    FinishTask();
+}
+
+JitCodeCache::LoadTask::~LoadTask()
+{
+    cache_->FinishLoadTask(abcChecksum_);
+}
+
+bool JitCodeCache::LoadTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK, "JitCodeCache::LoadTask::Run", "");
+    cache_->LoadFile(abcChecksum_);
+    return true;
+}
+
+JitCodeCache::FlushTask::~FlushTask()
+{
+    cache_->FinishFlushTask();
+}
+
+bool JitCodeCache::FlushTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK, "JitCodeCache::FlushTask::Run", "");
+    cache_->FlushFiles();
+    return true;
+}
+
+void JitCodeCache::LoadFile(uint32_t abcChecksum)
+{
+    std::string path;
+    {
+        LockHolder lock(mutex_);
+        path = files_[abcChecksum].path;
+    }
+    EntryMap entries;
+    bool valid = ReadFile(path, abcChecksum, entries);
+
+    LockHolder lock(mutex_);
+    FileCache &fileCache = files_[abcChecksum];
+    for (auto &it : entries) {
+        // code recorded by this process while the file was read is newer than the one on disk
+        fileCache.entries.try_emplace(it.first, std::move(it.second));
+    }
+    if (!valid) {
+        // rewrite the file even if nothing new gets compiled, so the stale payloads are not kept around
+        fileCache.dirty = true;
+    }
+    fileCache.state = LoadState::LOADED;
+}
+
+bool JitCodeCache::ReadFile(const std::string &path, uint32_t abcChecksum, EntryMap &entries)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return true;
+    }
+    FileHeader header;
+    if (!ReadPod(file, header)) {
+        return false;
+    }
+    if (header.magic != MAGIC || header.version != VERSION || header.arch != GetArch() ||
+        header.runtimeStamp != GetRuntimeStamp() || header.abcChecksum != abcChecksum ||
+        header.entryCount > MAX_CACHE_ENTRIES) {
+        LOG_JIT(INFO) << "JitCodeCache: invalidate " << path;
+        return false;
+    }
+    std::vector<IndexEntry> indexes;
+    if (!ReadVector(file, indexes, header.entryCount)) {
+        return false;
+    }
+    bool valid = true;
+    for (const IndexEntry &index : indexes) {
+        Entry entry;
+        entry.index = index;
+        if (!ReadPayload(file, entry)) {
+            LOG_JIT(INFO) << "JitCodeCache: drop corrupted entry of method " << index.methodId << " in " << path;
+            valid = false;
+            continue;
+        }
+        entries[GetKey(index.methodId, static_cast<CompilerTier::Tier>(index.tier))] = std::move(entry);
+    }
+    return valid;
+}
+
+bool JitCodeCache::ReadPayload(std::ifstream &file, Entry &entry)
+{
+    const IndexEntry &index = entry.index;
+    if (index.codeSize == 0 || index.codeSize > MAX_CACHED_CODE_SIZE ||
+        index.offsetTableSize > MAX_CACHED_CODE_SIZE || index.relocationCount > MAX_CACHED_CODE_SIZE) {
+        return false;
+    }
+    // a failed read of the previous payload leaves the stream failed
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(index.payloadOffset));
+    if (!ReadVector(file, entry.code, index.codeSize) ||
+        !ReadVector(file, entry.offsetTable, index.offsetTableSize) ||
+        !ReadVector(file, entry.relocations, index.relocationCount)) {
+        return false;
+    }
+    if (ComputePayloadHash(entry) != index.payloadHash) {
+        return false;
+    }
+    for (const Relocation &relocation : entry.relocations) {
+        if (relocation.stubId >= BaselineStubEntries::COUNT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JitCodeCache::WriteFile(const std::string &path, uint32_t abcChecksum, EntryMap &entries)
+{
+    // other processes may flush the same abc, each writes its own temporary file and renames it atomically
+    std::string tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_JIT(ERROR) << "JitCodeCache: can't open " << tmpPath;
+        return false;
+    }
+    FileHeader header;
+    header.arch = GetArch();
+    header.runtimeStamp = GetRuntimeStamp();
+    header.abcChecksum = abcChecksum;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    WritePod(file, header);
+
+    uint64_t payloadOffset = sizeof(FileHeader) + entries.size() * sizeof(IndexEntry);
+    for (auto &it : entries) {
+        Entry &entry = it.second;
+        entry.index.payloadOffset = payloadOffset;
+        WritePod(file, entry.index);
+        payloadOffset += entry.code.size() + entry.offsetTable.size() + entry.relocations.size() * sizeof(Relocation);
+    }
+    for (const auto &it : entries) {
+        const Entry &entry = it.second;
+        WriteVector(file, entry.code);
+        WriteVector(file, entry.offsetTable);
+        WriteVector(file, entry.relocations);
+    }
+    file.close();
+    if (file.fail() || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        LOG_JIT(ERROR) << "JitCodeCache: fail to write " << path;
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void JitCodeCache::FlushFiles()
+{
+    struct Snapshot {
+        uint32_t abcChecksum;
+        std::string path;
+        EntryMap entries;
+    };
+    LockHolder flushLock(flushMutex_);
+    std::vector<Snapshot> snapshots;
+    {
+        LockHolder lock(mutex_);
+        for (auto &it : files_) {
+            FileCache &fileCache = it.second;
+            if (fileCache.state != LoadState::LOADED || !fileCache.dirty) {
+                continue;
+            }
+            snapshots.push_back({fileCache.abcChecksum, fileCache.path, fileCache.entries});
+            fileCache.dirty = false;
+        }
+        unflushedCount_ = 0;
+    }
+    for (Snapshot &snapshot : snapshots) {
+        if (!WriteFile(snapshot.path, snapshot.abcChecksum, snapshot.entries)) {
+            LockHolder lock(mutex_);
+            files_[snapshot.abcChecksum].dirty = true;
+        }
+    }
+}
+
+bool JitCodeCache::Relocate(JSThread *thread, const Entry &entry, std::vector<uint8_t> &code) const
+{
+    for (const Relocation &relocation : entry.relocations) {
+        uint64_t target = static_cast<uint64_t>(thread->GetBaselineStubEntry(relocation.stubId));
+        uint8_t *pc = code.data() + relocation.offset;
+#if defined(PANDA_TARGET_AMD64)
+        if (relocation.offset + X64_MOVABS_IMM_OFFSET + sizeof(uint64_t) > code.size()) {
+            return false;
+        }
+        if (memcpy_s(pc + X64_MOVABS_IMM_OFFSET, sizeof(uint64_t), &target, sizeof(uint64_t)) != EOK) {
+            return false;
+        }
+#elif defined(PANDA_TARGET_ARM64)
+        if (relocation.offset + AARCH64_MOV_SEQUENCE_LENGTH * sizeof(uint32_t) > code.size()) {
+            return false;
+        }
+        for (uint32_t i = 0; i < AARCH64_MOV_SEQUENCE_LENGTH; i++) {
+            uint32_t insn = 0;
+            uint8_t *insnAddr = pc + i * sizeof(uint32_t);
+            if (memcpy_s(&insn, sizeof(insn), insnAddr, sizeof(insn)) != EOK) {
+                return false;
+            }
+            uint32_t imm16 = static_cast<uint32_t>(target >> (i * HWORD_BITS)) & AARCH64_IMM16_MASK;
+            insn &= ~(AARCH64_IMM16_MASK << AARCH64_IMM16_SHIFT);
+            insn |= imm16 << AARCH64_IMM16_SHIFT;
+            if (memcpy_s(insnAddr, sizeof(insn), &insn, sizeof(insn)) != EOK) {
+                return false;
+            }
+        }
+#else
+        (void)target;
+        (void)pc;
+        return false;
+#endif
+    }
+    return true;
+}
+
+int32_t JitCodeCache::FindStubId(JSThread *thread, uintptr_t target)
+{
+    if (stubIds_.empty()) {
+        for (uint32_t i = 0; i < BaselineStubEntries::COUNT; i++) {
+            stubIds_.emplace(static_cast<uintptr_t>(thread->GetBaselineStubEntry(i)), i);
+        }
+    }
+    auto iter = stubIds_.find(target);
+    if (iter == stubIds_.end()) {
+        return -1;
+    }
+    return static_cast<int32_t>(iter->second);
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_JIT_JIT_CODE_CACHE_H
+#define ECMASCRIPT_JIT_JIT_CODE_CACHE_H
+
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common_components/taskpool/task.h"
+#include "ecmascript/jit/compile_decision.h"
+#include "ecmascript/mem/machine_code.h"
+#include "ecmascript/platform/mutex.h"
+
+namespace panda::ecmascript {
+class JSPandaFile;
+class JSThread;
+class Method;
+
+// Persistent cache of baseline jit code, so that a restarted process does not recompile the same hot functions.
+// Every abc file gets one cache file named after its checksum. Entries are keyed by method id and compiler tier,
+// and carry a hash of the method shape the code was generated for and a hash of their payload. Stub entry addresses
+// embedded in the code are stored as stub ids and patched with the current process's addresses when the code is
+// loaded.
+//
+// The js thread never touches the disk: the first lookup of an abc posts a task which reads its whole cache file,
+// and the lookups miss until it is loaded. Recorded code is written by a background task once FLUSH_BATCH_SIZE
+// entries are pending or a vm asks for it, and synchronously only by Flush when the jit is destroyed.
+//
+// Cache file layout:
+//     +-------------------------------+
+//     | FileHeader                    |
+//     +-------------------------------+
+//     | IndexEntry * entryCount       |
+//     +-------------------------------+
+//     | payloads: code, offset table, |
+//     | Relocation * relocationCount  |
+//     +-------------------------------+
+class JitCodeCache {
+public:
+    static constexpr uint32_t FLUSH_BATCH_SIZE = 16;
+
+    struct CachedCode {
+        std::vector<uint8_t> code;
+        std::vector<uint8_t> offsetTable;
+    };
+
+    // Identifies the code of a method, see MakeKey.
+    struct Key {
+        uint32_t abcChecksum {0};
+        uint32_t methodId {0};
+        CompilerTier::Tier tier {CompilerTier::Tier::BASELINE};
+        uint32_t profileHash {0};
+    };
+
+    explicit JitCodeCache(const std::string &cachePath) : cachePath_(cachePath) {}
+    ~JitCodeCache();
+
+    NO_COPY_SEMANTIC(JitCodeCache);
+    NO_MOVE_SEMANTIC(JitCodeCache);
+
+    static bool MakeKey(JSThread *thread, Method *method, CompilerTier tier, Key &key);
+
+    // Find the code of the method in the cache, relocated for the current process. Returns false on a miss, if the
+    // cache file of the abc is still being loaded, or if the cached entry was generated for a different version of
+    // the method.
+    bool Lookup(JSThread *thread, Method *method, CompilerTier tier, CachedCode &result);
+    bool Lookup(JSThread *thread, const Key &key, CachedCode &result);
+    // Remember freshly installed code; it is written to disk by the next flush.
+    void Record(JSThread *thread, Method *method, CompilerTier tier, const MachineCodeDesc &desc);
+    void Record(JSThread *thread, const Key &key, const MachineCodeDesc &desc);
+    // Post a background flush if code was recorded since the last one. The id is the one of the posting thread.
+    void RequestFlush(int32_t id);
+    // Write all pending changes before returning, blocking on the disk.
+    void Flush();
+    void WaitAllTasksFinished();
+    // Whether the cache file of the abc was loaded, and lookups for it can hit.
+    bool IsLoaded(uint32_t abcChecksum);
+
+    uint32_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint32_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    static uint32_t ComputeProfileHash(JSThread *thread, Method *method);
+
+private:
+    static constexpr uint32_t MAGIC = 0x4a434331;  // "JCC1"
+    static constexpr uint32_t VERSION = 2;
+
+    struct FileHeader {
+        uint32_t magic {MAGIC};
+        uint32_t version {VERSION};
+        uint32_t arch {0};
+        uint32_t runtimeStamp {0};
+        uint32_t abcChecksum {0};
+        uint32_t entryCount {0};
+    };
+
+    struct IndexEntry {
+        uint32_t methodId {0};
+        uint32_t tier {0};
+        uint32_t profileHash {0};
+        uint32_t payloadHash {0};
+        uint32_t codeSize {0};
+        uint32_t offsetTableSize {0};
+        uint32_t relocationCount {0};
+        uint64_t payloadOffset {0};
+    };
+
+    struct Relocation {
+        uint32_t offset {0};
+        uint32_t stubId {0};
+    };
+
+    struct Entry {
+        IndexEntry index;
+        std::vector<uint8_t> code;
+        std::vector<uint8_t> offsetTable;
+        std::vector<Relocation> relocations;
+    };
+
+    using EntryMap = std::unordered_map<uint64_t, Entry>;
+
+    enum class LoadState : uint8_t {
+        UNLOADED,
+        LOADING,
+        LOADED,
+    };
+
+    struct FileCache {
+        std::string path;
+        uint32_t abcChecksum {0};
+        LoadState state {LoadState::UNLOADED};
+        bool dirty {false};
+        EntryMap entries;
+    };
+
+    class LoadTask : public common::Task {
+    public:
+        LoadTask(int32_t id, JitCodeCache *cache, uint32_t abcChecksum)
+            : common::Task(id), cache_(cache), abcChecksum_(abcChecksum) {}
+        // The task may be dropped without running, the file is then loaded by the next lookup.
+        ~LoadTask() override;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(LoadTask);
+        NO_MOVE_SEMANTIC(LoadTask);
+
+    private:
+        JitCodeCache *cache_;
+        uint32_t abcChecksum_;
+    };
+
+    class FlushTask : public common::Task {
+    public:
+        FlushTask(int32_t id, JitCodeCache *cache) : common::Task(id), cache_(cache) {}
+        ~FlushTask() override;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(FlushTask);
+        NO_MOVE_SEMANTIC(FlushTask);
+
+    private:
+        JitCodeCache *cache_;
+    };
+
+    static uint64_t GetKey(uint32_t methodId, CompilerTier::Tier tier)
+    {
+        // 32: the method id takes the high half of the key
+        return (static_cast<uint64_t>(methodId) << 32U) | static_cast<uint64_t>(tier);
+    }
+
+    static uint32_t GetArch();
+    static uint32_t GetRuntimeStamp();
+    static uint32_t ComputePayloadHash(const Entry &entry);
+
+    // Called with mutex_ held.
+    FileCache &GetFileCache(int32_t id, uint32_t abcChecksum);
+    void PostFlushTask(int32_t id);
+    void FinishTask();
+
+    void FinishLoadTask(uint32_t abcChecksum);
+    void FinishFlushTask();
+
+    // Called without mutex_ held, these do the disk io.
+    void LoadFile(uint32_t abcChecksum);
+    static bool ReadFile(const std::string &path, uint32_t abcChecksum, EntryMap &entries);
+    static bool ReadPayload(std::ifstream &file, Entry &entry);
+    static bool WriteFile(const std::string &path, uint32_t abcChecksum, EntryMap &entries);
+    void FlushFiles();
+
+    bool Relocate(JSThread *thread, const Entry &entry, std::vector<uint8_t> &code) const;
+    int32_t FindStubId(JSThread *thread, uintptr_t target);
+
+    std::string cachePath_;
+    std::unordered_map<uint32_t, FileCache> files_;
+    std::unordered_map<uintptr_t, uint32_t> stubIds_;
+    uint32_t hitCount_ {0};
+    uint32_t missCount_ {0};
+    // entries recorded since the last flush was posted
+    uint32_t unflushedCount_ {0};
+    bool flushPosted_ {false};
+    uint32_t runningTaskCount_ {0};
+    Mutex mutex_;
+    ConditionVariable taskFinishedCV_;
+    // serializes the writers of the cache files
+    Mutex flushMutex_;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_JIT_JIT_CODE_CACHE_H
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/jit/jit_compile_queue.h"
+
+#include <algorithm>
+
+namespace panda::ecmascript {
+uint64_t JitCompileQueue::ComputeBenefit(uint32_t hotness, uint32_t codeSize)
+{
+    // scaled so that small methods of the same hotness still compare apart
+    constexpr uint64_t BENEFIT_SCALE = 1024;
+    return static_cast<uint64_t>(hotness) * BENEFIT_SCALE / std::max(codeSize, 1U);
+}
+
+uint64_t JitCompileQueue::ElapsedUs(TimePoint from, TimePoint to)
+{
+    if (to <= from) {
+        return 0;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+}
+
+void JitCompileQueue::Push(std::unique_ptr<common::Task> task, const TaskInfo &info, TimePoint now)
+{
+    LockHolder lock(mutex_);
+    entries_.push_back({std::move(task), info, now, nextSeq_++});
+}
+
+bool JitCompileQueue::IsStale(const Entry &entry, TimePoint now) const
+{
+    if (entry.task->IsTerminate()) {
+        return true;
+    }
+    if (entry.info.isSync) {
+        return false;
+    }
+    uint64_t maxWaitUs = entry.info.isOsr ? MAX_OSR_WAIT_US : MAX_WAIT_US;
+    return ElapsedUs(entry.enqueueTime, now) > maxWaitUs;
+}
+
+bool JitCompileQueue::IsBetter(const Entry &lhs, const Entry &rhs) const
+{
+    if (lhs.info.isSync != rhs.info.isSync) {
+        return lhs.info.isSync;
+    }
+    if (lhs.info.benefit != rhs.info.benefit) {
+        return lhs.info.benefit > rhs.info.benefit;
+    }
+    return lhs.seq < rhs.seq;
+}
+
+void JitCompileQueue::UpdateWindow(TimePoint now)
+{
+    if (ElapsedUs(windowStart_, now) >= BUDGET_WINDOW_US) {
+        windowStart_ = now;
+        windowUsedUs_ = 0;
+    }
+}
+
+JitCompileQueue::PopResult JitCompileQueue::Pop(std::unique_ptr<common::Task> &task, uint64_t &waitUs,
+                                                uint64_t &delayUs, uint32_t &droppedCount, uint32_t &expiredCount,
+                                                TimePoint now)
+{
+    std::vector<std::unique_ptr<common::Task>> dropped;
+    std::vector<std::function<void()>> expired;
+    PopResult result = PopResult::EMPTY;
+    expiredCount = 0;
+    {
+        LockHolder lock(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (IsStale(*it, now)) {
+                if (!it->task->IsTerminate()) {
+                    expiredCount++;
+                    if (it->info.onExpired) {
+                        expired.push_back(std::move(it->info.onExpired));
+                    }
+                }
+                // destroyed out of the lock, the destructor of a task may take other locks
+                dropped.push_back(std::move(it->task));
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        auto best = entries_.end();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (best == entries_.end() || IsBetter(*it, *best)) {
+                best = it;
+            }
+        }
+        if (best != entries_.end()) {
+            UpdateWindow(now);
+            if (!best->info.isSync && windowUsedUs_ >= budgetUs_) {
+                delayUs = BUDGET_WINDOW_US - ElapsedUs(windowStart_, now);
+                result = PopResult::OVER_BUDGET;
+            } else {
+                waitUs = ElapsedUs(best->enqueueTime, now);
+                task = std::move(best->task);
+                entries_.erase(best);
+                result = PopResult::TASK;
+            }
+        }
+    }
+    for (auto &onExpired : expired) {
+        onExpired();
+    }
+    droppedCount = static_cast<uint32_t>(dropped.size());
+    return result;
+}
+
+void JitCompileQueue::RecordCompileTime(uint64_t timeUs, TimePoint now)
+{
+    LockHolder lock(mutex_);
+    UpdateWindow(now);
+    windowUsedUs_ += timeUs;
+}
+
+void JitCompileQueue::SetBudget(uint64_t budgetUs)
+{
+    LockHolder lock(mutex_);
+    budgetUs_ = budgetUs;
+}
+
+uint64_t JitCompileQueue::GetBudget() const
+{
+    LockHolder lock(mutex_);
+    return budgetUs_;
+}
+
+void JitCompileQueue::ForEach(const std::function<void(common::Task *)> &func)
+{
+    LockHolder lock(mutex_);
+    for (auto &entry : entries_) {
+        func(entry.task.get());
+    }
+}
+
+void JitCompileQueue::Clear()
+{
+    std::vector<Entry> entries;
+    {
+        LockHolder lock(mutex_);
+        entries.swap(entries_);
+    }
+}
+
+size_t JitCompileQueue::Size() const
+{
+    LockHolder lock(mutex_);
+    return entries_.size();
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_JIT_JIT_COMPILE_QUEUE_H
+#define ECMASCRIPT_JIT_JIT_COMPILE_QUEUE_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "common_components/taskpool/task.h"
+#include "ecmascript/common.h"
+#include "ecmascript/platform/mutex.h"
+
+namespace panda::ecmascript {
+// Compile tasks waiting for the jit thread. They are not run in arrival order: the task with the highest expected
+// benefit, i.e. hotness per byte of bytecode, goes first, and tasks which waited so long that the code they would
+// produce is likely useless by now are dropped. Sync tasks block the js thread and always go first.
+//
+// The time the jit thread spends compiling is limited per window of one second, the budget is lowered while the
+// application is in background. Sync tasks are not held back by the budget.
+class PUBLIC_API JitCompileQueue {
+public:
+    using SteadyClock = std::chrono::steady_clock;
+    using TimePoint = SteadyClock::time_point;
+
+    enum class PopResult : uint8_t {
+        TASK,
+        EMPTY,
+        OVER_BUDGET,
+    };
+
+    struct TaskInfo {
+        uint64_t benefit {0};
+        bool isSync {false};
+        bool isOsr {false};
+        // Called on the jit thread when the task is dropped as stale, but not when it is terminated. The requester
+        // marked the function as compiling and has to be told that no code will come.
+        std::function<void()> onExpired {};
+    };
+
+    static constexpr uint64_t BUDGET_WINDOW_US = 1000000;
+    static constexpr uint64_t FOREGROUND_BUDGET_US = 600000;
+    static constexpr uint64_t BACKGROUND_BUDGET_US = 200000;
+    // an osr task is useless once the loop is left, so it goes stale much earlier
+    static constexpr uint64_t MAX_WAIT_US = 3000000;
+    static constexpr uint64_t MAX_OSR_WAIT_US = 500000;
+
+    JitCompileQueue() = default;
+    ~JitCompileQueue() = default;
+
+    NO_COPY_SEMANTIC(JitCompileQueue);
+    NO_MOVE_SEMANTIC(JitCompileQueue);
+
+    static uint64_t ComputeBenefit(uint32_t hotness, uint32_t codeSize);
+
+    void Push(std::unique_ptr<common::Task> task, const TaskInfo &info, TimePoint now = SteadyClock::now());
+    // Takes the task to be compiled next. Terminated and stale tasks met on the way are dropped and counted in
+    // droppedCount, the stale ones which were not terminated are also counted in expiredCount, and their onExpired
+    // is called out of the lock. On OVER_BUDGET the best task stays queued, and delayUs tells when the next window
+    // begins.
+    PopResult Pop(std::unique_ptr<common::Task> &task, uint64_t &waitUs, uint64_t &delayUs, uint32_t &droppedCount,
+                  uint32_t &expiredCount, TimePoint now = SteadyClock::now());
+
+    void RecordCompileTime(uint64_t timeUs, TimePoint now = SteadyClock::now());
+    void SetBudget(uint64_t budgetUs);
+    uint64_t GetBudget() const;
+
+    void ForEach(const std::function<void(common::Task *)> &func);
+    void Clear();
+    size_t Size() const;
+
+private:
+    struct Entry {
+        std::unique_ptr<common::Task> task;
+        TaskInfo info;
+        TimePoint enqueueTime;
+        uint64_t seq {0};
+    };
+
+    static uint64_t ElapsedUs(TimePoint from, TimePoint to);
+    bool IsStale(const Entry &entry, TimePoint now) const;
+    bool IsBetter(const Entry &lhs, const Entry &rhs) const;
+    void UpdateWindow(TimePoint now);
+
+    std::vector<Entry> entries_ {};
+    uint64_t nextSeq_ {0};
+    uint64_t budgetUs_ {FOREGROUND_BUDGET_US};
+    uint64_t windowUsedUs_ {0};
+    TimePoint windowStart_ {};
+    mutable Mutex mutex_;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_JIT_JIT_COMPILE_QUEUE_H
@@ -14,6 +14,9 @@
  */
 
 #include "ecmascript/jit/jit_dfx.h"
+
+#include <sstream>
+
 #include "ecmascript/runtime.h"
 #include "bytecode_instruction-inl.h"
 #include "code_data_accessor.h"
@@ -147,6 +150,11 @@ void JitDfx::TraceJitCode(JSThread *thread, Method *method, bool isEntry)
 void JitDfx::PrintJitStatsLog()
 {
     if (checkUploadConditions()) {
+        std::ostringstream histograms;
+        histograms << " queue wait: ";
+        queueWaitHistogram_.Dump(histograms);
+        histograms << " compile time: ";
+        compileTimeHistogram_.Dump(histograms);
         LOG_JIT(DEBUG) << "Jit Compiler stats Log: "
         << " bundleName: " << GetBundleName()
         << " pid: " << GetPidNumber()
@@ -160,6 +168,8 @@ void JitDfx::PrintJitStatsLog()
         << " max time on hold lock: " << GetMaxLockHoldingTime()
         << " longtime of hold lock: " << GetLongtimeLockCount()
         << " JitDeopt times: " << GetJitDeoptCount()
+        << " stale task times: " << GetStaleTaskCount()
+        << histograms.str()
         << "\n";
         SendJitStatsEvent();
         InitializeRecord();
@@ -234,6 +244,9 @@ void JitDfx::InitializeRecord()
     jitEventParams.totalTimeOnJitThread_.store(0);
     jitEventParams.totalLockHoldingTime_.store(0);
     jitEventParams.maxLockHoldingTime_ .store(0);
+    jitEventParams.staleTaskTimes_.store(0);
+    queueWaitHistogram_.Reset();
+    compileTimeHistogram_.Reset();
     ResetCompilerTime();
 }
 
@@ -16,6 +16,7 @@
 #ifndef ECMASCRIPT_JIT_JIT_DFX_H
 #define ECMASCRIPT_JIT_JIT_DFX_H
 
+#include <array>
 #include <fstream>
 #include <map>
 #include <atomic>
@@ -32,6 +33,7 @@ struct JitEventParams {
     std::atomic<int> totalBaselineJitTimes_;
     std::atomic<int> totalFastoptJitTimes_;
     std::atomic<int> jitDeoptTimes_;
+    std::atomic<int> staleTaskTimes_;
     std::atomic<int> longtimeLockTimes_;
     std::atomic<int> singleTimeOnMainThread_;
     std::atomic<int> totalTimeOnMainThread_;
@@ -43,11 +45,56 @@ struct JitEventParams {
     Clock::time_point blockUIEventstart_;
 
     JitEventParams() : totalBaselineJitTimes_(0), totalFastoptJitTimes_(0), jitDeoptTimes_(0),
-        longtimeLockTimes_(0), singleTimeOnMainThread_(0), totalTimeOnMainThread_(0),
+        staleTaskTimes_(0), longtimeLockTimes_(0), singleTimeOnMainThread_(0), totalTimeOnMainThread_(0),
         singleTimeOnJitThread_(0), totalTimeOnJitThread_(0), totalLockHoldingTime_(0),
         maxLockHoldingTime_(0), start_(Clock::now()), blockUIEventstart_(Clock::now()) {}
 };
 
+// Counts of times in microseconds, in buckets growing by powers of four from below 100us to above 100ms.
+class JitTimeHistogram {
+public:
+    static constexpr size_t BUCKET_NUM = 7;
+
+    void Record(uint64_t timeUs)
+    {
+        size_t index = 0;
+        uint64_t bound = FIRST_BUCKET_BOUND;
+        while (index + 1 < BUCKET_NUM && timeUs >= bound) {
+            index++;
+            bound *= BUCKET_GROWTH;
+        }
+        buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t GetCount(size_t index) const
+    {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+
+    void Reset()
+    {
+        for (auto &bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Dump(std::ostream &os) const
+    {
+        uint64_t bound = FIRST_BUCKET_BOUND;
+        for (size_t i = 0; i + 1 < BUCKET_NUM; i++) {
+            os << "<" << bound << "us:" << GetCount(i) << " ";
+            bound *= BUCKET_GROWTH;
+        }
+        os << ">=" << bound / BUCKET_GROWTH << "us:" << GetCount(BUCKET_NUM - 1);
+    }
+
+private:
+    static constexpr uint64_t FIRST_BUCKET_BOUND = 100;
+    static constexpr uint64_t BUCKET_GROWTH = 4;
+
+    std::array<std::atomic<uint32_t>, BUCKET_NUM> buckets_ {};
+};
+
 class Method;
 class JitDfx {
 public:
@@ -95,6 +142,7 @@ public:
         int mainThreadCompileTime)
     {
         SetTotalTimeOnJitThread(compilerTime);
+        compileTimeHistogram_.Record(static_cast<uint64_t>(compilerTime));
         if (ReportBlockUIEvent(mainThreadCompileTime)) {
             SetBlockUIEventInfo(methodName, isBaselineJit, mainThreadCompileTime, compilerTime);
         }
@@ -216,6 +264,32 @@ public:
         return jitEventParams.jitDeoptTimes_.load();
     }
 
+    // time a task spent in JitCompileQueue before the jit thread took it
+    void RecordQueueWaitTime(uint64_t timeUs)
+    {
+        queueWaitHistogram_.Record(timeUs);
+    }
+
+    const JitTimeHistogram &GetQueueWaitHistogram() const
+    {
+        return queueWaitHistogram_;
+    }
+
+    const JitTimeHistogram &GetCompileTimeHistogram() const
+    {
+        return compileTimeHistogram_;
+    }
+
+    void AddStaleTaskCount(uint32_t count)
+    {
+        jitEventParams.staleTaskTimes_.fetch_add(static_cast<int>(count));
+    }
+
+    int GetStaleTaskCount() const
+    {
+        return jitEventParams.staleTaskTimes_.load();
+    }
+
     void ResetCompilerTime()
     {
         jitEventParams.start_ = Clock::now();
@@ -267,6 +341,8 @@ private:
     CString methodInfo_ = "";
     ThreadId pidNum_ {0};
     JitEventParams jitEventParams;
+    JitTimeHistogram queueWaitHistogram_;
+    JitTimeHistogram compileTimeHistogram_;
     static constexpr int MAX_TRIGGER_TIMES = 100;
     static constexpr int MIN_SEND_INTERVAL = 60; // seconds
     static constexpr int HOLD_LOCK_LIMIT = 1000; // microseconds
@@ -326,6 +326,13 @@ void JITProfiler::ProfileBytecode(JSThread *thread, const JSHandle<ProfileTypeIn
                 ConvertInstanceof(bcOffset, slotId);
                 break;
             }
+            case EcmaOpcode::ISIN_IMM8_V8: {
+                Jit::JitLockHolder lock(thread);
+                uint8_t slotId = READ_INST_8_0();
+                CHECK_SLOTID_BREAK(slotId);
+                ConvertIsIn(bcOffset, slotId);
+                break;
+            }
             case EcmaOpcode::DEFINEGETTERSETTERBYVALUE_V8_V8_V8_V8:
             default:
                 break;
@@ -665,10 +672,49 @@ void JITProfiler::HandleLoadTypePrototypeHandler(ApEntityId &abcId, int32_t &bcO
         int32_t holderHClassIndex = ptManager_->RecordAndGetHclassIndexForJIT(holderHClass);
         jitCompilationEnv->RecordHolderHClassIndex2HeapConstantIndex(holderHClassIndex, heapConstantIndex);
     }
+    if (HandlerBase::IsField(handlerInfo)) {
+        RecordPolyCallTarget(bcOffset, holder, handlerInfo);
+    }
     auto primitiveType = HandlerBase::TryGetPrimitiveType(handlerInfo);
     AddObjectInfo(abcId, bcOffset, hclass, holderHClass, holderHClass, accessorMethodId, primitiveType, name);
 }
 
+void JITProfiler::RecordPolyCallTarget(int32_t bcOffset, JSTaggedValue holder, uint32_t handlerInfo)
+{
+    // The call ic only keeps a single target, so the targets of a call through a method loaded from different
+    // prototypes are taken from the prototypes the load ic has seen.
+    if (!compilationEnv_->SupportHeapConstant() || !holder.IsJSObject()) {
+        return;
+    }
+    JSTaggedValue value = ICRuntimeStub::LoadFromField(mainThread_, JSObject::Cast(holder.GetTaggedObject()),
+                                                       handlerInfo);
+    if (!value.IsJSFunction()) {
+        return;
+    }
+    auto *jitCompilationEnv = static_cast<JitCompilationEnv*>(compilationEnv_);
+    auto valueHandle = jitCompilationEnv->NewJSHandle(value);
+    auto callee = JSHandle<JSFunction>::Cast(valueHandle);
+    Method *calleeMethod = Method::Cast(callee->GetMethod(mainThread_));
+    if (calleeMethod->IsNativeWithCallField() || calleeMethod->GetFunctionKind() == FunctionKind::ARROW_FUNCTION ||
+        !callee->IsCallable()) {
+        return;
+    }
+    compilationEnv_->ProcessMethod(calleeMethod->GetMethodLiteral(mainThread_),
+                                   calleeMethod->GetJSPandaFile(mainThread_));
+    uint32_t calleeMethodId = calleeMethod->GetMethodId().GetOffset();
+    auto heapConstantIndex = jitCompilationEnv->RecordHeapConstant(valueHandle);
+    if (heapConstantIndex == JitCompilationEnv::INVALID_HEAP_CONSTANT_INDEX) {
+        return;
+    }
+    if (calleeMethod->GetMethodLiteral(mainThread_)->IsTypedCall() && callee->IsCompiledCode()) {
+        jitCompilationEnv->RecordCallMethodId2HeapConstantIndex(calleeMethodId, heapConstantIndex);
+    } else {
+        jitCompilationEnv->RecordOnlyInlineMethodId2HeapConstantIndex(calleeMethodId, heapConstantIndex);
+    }
+    jitCompilationEnv->SetCalleeJSFunction(calleeMethodId, callee);
+    jitCompilationEnv->RecordPolyCallTarget(methodId_.GetOffset(), static_cast<uint32_t>(bcOffset), calleeMethodId);
+}
+
 void JITProfiler::HandleOtherTypes(ApEntityId &abcId, int32_t &bcOffset,
                                    JSHClass *hclass, JSTaggedValue &secondValue, uint32_t slotId)
 {
@@ -1001,20 +1047,80 @@ void JITProfiler::ConvertInstanceof(int32_t bcOffset, uint32_t slotId)
         TaggedObject *object = firstValue.GetWeakReferentUnChecked();
         if (object->GetClass()->IsHClass()) {
             JSHClass *hclass = JSHClass::Cast(object);
-            // Since pgo does not support symbol, we choose to return if hclass having @@hasInstance
-            JSTaggedValue key = mainThread_->GlobalConstants()->GetHasInstanceSymbol();
-            JSHClass *functionPrototypeHC =
-                JSObject::Cast(GetCurrentGlobalEnv()->GetFunctionPrototypeWithBarrier().GetTaggedValue())->GetClass();
-            JSTaggedValue foundHClass = TryFindKeyInPrototypeChain(object, hclass, key);
-            if (!foundHClass.IsUndefined() && JSHClass::Cast(foundHClass.GetTaggedObject()) != functionPrototypeHC) {
+            if (HasCustomHasInstance(hclass)) {
                 return;
             }
             AddObjectInfo(abcId_, bcOffset, hclass, hclass, hclass);
         }
         return;
     }
-    // Poly Not Consider now
-    return;
+    if (!firstValue.IsTaggedArray()) {
+        return;
+    }
+    auto array = TaggedArray::Cast(firstValue);
+    uint32_t length = array->GetLength();
+    for (uint32_t i = 0; i < length; i += 2) { // 2 means one ic, two slot
+        auto result = array->Get(mainThread_, i);
+        if (!result.IsHeapObject() || !result.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = result.GetWeakReferentUnChecked();
+        if (object->GetClass()->IsHClass() && HasCustomHasInstance(JSHClass::Cast(object))) {
+            AddObjectInfoWithMega(bcOffset);
+            return;
+        }
+    }
+    for (uint32_t i = 0; i < length; i += 2) { // 2 means one ic, two slot
+        auto result = array->Get(mainThread_, i);
+        if (!result.IsHeapObject() || !result.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = result.GetWeakReferentUnChecked();
+        if (!object->GetClass()->IsHClass()) {
+            continue;
+        }
+        JSHClass *hclass = JSHClass::Cast(object);
+        AddObjectInfo(abcId_, bcOffset, hclass, hclass, hclass);
+    }
+}
+
+bool JITProfiler::HasCustomHasInstance(JSHClass *hclass)
+{
+    // Since pgo does not support symbol, a constructor having its own @@hasInstance is not recorded
+    JSTaggedValue key = mainThread_->GlobalConstants()->GetHasInstanceSymbol();
+    JSHClass *functionPrototypeHC =
+        JSObject::Cast(GetCurrentGlobalEnv()->GetFunctionPrototypeWithBarrier().GetTaggedValue())->GetClass();
+    JSTaggedValue foundHClass = TryFindKeyInPrototypeChain(hclass, hclass, key);
+    return !foundHClass.IsUndefined() && JSHClass::Cast(foundHClass.GetTaggedObject()) != functionPrototypeHC;
+}
+
+void JITProfiler::ConvertIsIn(int32_t bcOffset, uint32_t slotId)
+{
+    JSTaggedValue cacheValue = profileTypeInfo_->GetICSlot(mainThread_, slotId);
+    if (!cacheValue.IsHeapObject()) {
+        if (cacheValue.IsHole()) {
+            // Mega state
+            AddObjectInfoWithMega(bcOffset);
+        }
+        return;
+    }
+    if (!cacheValue.IsTaggedArray()) {
+        return;
+    }
+    auto array = TaggedArray::Cast(cacheValue);
+    uint32_t length = array->GetLength();
+    for (uint32_t i = 0; i < length; i += IsInICRuntime::ENTRY_SIZE) {
+        auto cachedHClass = array->Get(mainThread_, i + IsInICRuntime::HCLASS_INDEX);
+        if (!cachedHClass.IsHeapObject() || !cachedHClass.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = cachedHClass.GetWeakReferentUnChecked();
+        if (!object->GetClass()->IsHClass()) {
+            continue;
+        }
+        JSHClass *hclass = JSHClass::Cast(object);
+        AddObjectInfo(abcId_, bcOffset, hclass, hclass, hclass);
+    }
 }
 
 void JITProfiler::ConvertTryldGlobalByName(uint32_t bcOffset, uint32_t slotId)
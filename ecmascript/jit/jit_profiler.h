@@ -110,6 +110,7 @@ private:
         ApEntityId &abcId, int32_t &bcOffset, JSHClass *hclass,
         JSTaggedValue &secondValue, uint32_t slotId,
         JSTaggedValue = JSTaggedValue::Undefined());
+    void RecordPolyCallTarget(int32_t bcOffset, JSTaggedValue holder, uint32_t handlerInfo);
     void HandleOtherTypes(ApEntityId &abcId, int32_t &bcOffset,
                           JSHClass *hclass, JSTaggedValue &secondValue, uint32_t slotId);
     void HandleTransitionHandler(ApEntityId &abcId, int32_t &bcOffset,
@@ -137,6 +138,8 @@ private:
                                   JSTaggedValue name, JSTaggedValue cacheValue,
                                   BCType type, uint32_t slotId);
     void ConvertInstanceof(int32_t bcOffset, uint32_t slotId);
+    bool HasCustomHasInstance(JSHClass *hclass);
+    void ConvertIsIn(int32_t bcOffset, uint32_t slotId);
     void ConvertTryldGlobalByName(uint32_t bcOffset, uint32_t slotId);
 
     void ConvertExternalModuleVar(uint32_t index, uint32_t bcOffset);
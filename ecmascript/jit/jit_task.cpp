@@ -34,6 +34,51 @@ uint32_t JitTaskpool::TheMostSuitableThreadNum([[maybe_unused]]uint32_t threadNu
     return 1;
 }
 
+void JitTaskpool::PostCompileTask(std::unique_ptr<common::Task> task, const JitCompileQueue::TaskInfo &info)
+{
+    int32_t id = task->GetId();
+    compileQueue_.Push(std::move(task), info);
+    // one dispatch task per compile task, it runs whichever compile task is the best when the thread gets to it
+    PostTask(std::make_unique<DispatchTask>(id));
+}
+
+bool JitTaskpool::DispatchTask::Run(uint32_t threadIndex)
+{
+    if (IsTerminate()) {
+        return false;
+    }
+    return JitTaskpool::GetCurrentTaskpool()->RunNextCompileTask(threadIndex, GetId());
+}
+
+bool JitTaskpool::RunNextCompileTask(uint32_t threadIndex, int32_t id)
+{
+    std::unique_ptr<common::Task> task;
+    uint64_t waitUs = 0;
+    uint64_t delayUs = 0;
+    uint32_t droppedCount = 0;
+    uint32_t expiredCount = 0;
+    JitCompileQueue::PopResult result = compileQueue_.Pop(task, waitUs, delayUs, droppedCount, expiredCount);
+    JitDfx *jitDfx = JitDfx::GetInstance();
+    // terminated tasks are dropped on vm teardown, they are not stale
+    if (expiredCount != 0) {
+        jitDfx->AddStaleTaskCount(expiredCount);
+    }
+    if (result == JitCompileQueue::PopResult::OVER_BUDGET) {
+        constexpr uint64_t US_PER_MS = 1000;
+        PostDelayedTask(std::make_unique<DispatchTask>(id), delayUs / US_PER_MS + 1);
+        return false;
+    }
+    if (result == JitCompileQueue::PopResult::EMPTY) {
+        return false;
+    }
+    jitDfx->RecordQueueWaitTime(waitUs);
+    auto start = JitCompileQueue::SteadyClock::now();
+    bool success = task->Run(threadIndex);
+    auto spent = std::chrono::duration_cast<std::chrono::microseconds>(JitCompileQueue::SteadyClock::now() - start);
+    compileQueue_.RecordCompileTime(static_cast<uint64_t>(spent.count()));
+    return success;
+}
+
 JitTask::JitTask(JSThread *hostThread, JSThread *compilerThread, Jit *jit, JSHandle<JSFunction> &jsFunction,
     CompilerTier tier, CString &methodName, int32_t offset, JitCompileMode mode)
     : hostThread_(hostThread),
@@ -348,6 +393,10 @@ void JitTask::InstallCode()
         InstallOsrCode(machineCodeObj);
     } else {
         InstallCodeByCompilerTier(machineCodeObj, methodHandle);
+        JitCodeCache *codeCache = jit_->GetCodeCache();
+        if (codeCache != nullptr && compilerTier_.IsBaseLine() && !isCachedCode_) {
+            codeCache->Record(hostThread_, *methodHandle, compilerTier_, codeDesc_);
+        }
     }
 
     // sometimes get ILL_ILLOPC error if i-cache  not flushed for Jit code
@@ -377,6 +426,56 @@ void JitTask::InstallCode()
     }
 }
 
+void JitTask::ResetCompilingState()
+{
+    if (compilerTier_.IsBaseLine()) {
+        jsFunction_->SetBaselinejitCompilingFlag(false);
+    } else {
+        jsFunction_->SetJitCompilingFlag(false);
+    }
+    // the counter which triggered the request has gone past its threshold, start counting again so that the
+    // function is requested again once it is still hot
+    JSTaggedValue profile = jsFunction_->GetProfileTypeInfo(hostThread_);
+    if (profile.IsUndefined()) {
+        return;
+    }
+    ProfileTypeInfo *profileTypeInfo = ProfileTypeInfo::Cast(profile.GetTaggedObject());
+    if (IsOsrTask()) {
+        profileTypeInfo->SetOsrHotnessCnt(0);
+    } else {
+        profileTypeInfo->SetJitHotnessCnt(0);
+    }
+    LOG_JIT(DEBUG) << "Drop stale compile task: " << GetMethodName();
+}
+
+bool JitTask::InstallCachedCode(const JitCodeCache::CachedCode &cachedCode)
+{
+    ASSERT(compilerTier_.IsBaseLine() && !IsOsrTask());
+    isCachedCode_ = true;
+    codeDesc_.codeType = MachineCodeType::BASELINE_CODE;
+    codeDesc_.codeAddr = ToUintPtr(cachedCode.code.data());
+    codeDesc_.codeSize = cachedCode.code.size();
+    codeDesc_.stackMapOrOffsetTableAddr = ToUintPtr(cachedCode.offsetTable.data());
+    codeDesc_.stackMapOrOffsetTableSize = cachedCode.offsetTable.size();
+    if (Jit::GetInstance()->IsEnableJitFort() && Jit::GetInstance()->IsEnableAsyncCopyToFort()) {
+        // with async copy the instructions are expected to be in the fort already, which is otherwise done by the
+        // compiler thread
+        ComputePayLoadSize(codeDesc_);
+        uintptr_t mem = hostThread_->GetEcmaVM()->GetHeap()->GetMachineCodeSpace()->JitFortAllocate(&codeDesc_);
+        if (mem == ToUintPtr(nullptr)) {
+            return false;
+        }
+        codeDesc_.instructionsAddr = mem;
+        if (memcpy_s(reinterpret_cast<void *>(mem), codeDesc_.codeSizeAlign,
+                     cachedCode.code.data(), cachedCode.code.size()) != EOK) {
+            LOG_JIT(ERROR) << "memcpy failed in InstallCachedCode";
+            return false;
+        }
+    }
+    InstallCode();
+    return jsFunction_->GetBaselineCode(hostThread_).IsMachineCodeObject();
+}
+
 void JitTask::InstallCodeByCompilerTier(JSHandle<MachineCode> &machineCodeObj,
     JSHandle<Method> &methodHandle)
 {
@@ -26,6 +26,8 @@
 
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/jit/jit.h"
+#include "ecmascript/jit/jit_code_cache.h"
+#include "ecmascript/jit/jit_compile_queue.h"
 #include "ecmascript/jit/jit_thread.h"
 #include "ecmascript/sustaining_js_handle.h"
 
@@ -90,10 +92,35 @@ public:
     {
         WaitForJitTaskPoolReady();
         common::Taskpool::Destroy(threadId_);
+        compileQueue_.Clear();
+    }
+
+    // Queues the compile task in the compile queue, the jit thread takes the most beneficial one when it is free.
+    void PostCompileTask(std::unique_ptr<common::Task> task, const JitCompileQueue::TaskInfo &info);
+
+    void ForEachCompileTask(const std::function<void(common::Task*)> &f)
+    {
+        compileQueue_.ForEach(f);
+    }
+
+    void SetCompileBudget(uint64_t budgetUs)
+    {
+        compileQueue_.SetBudget(budgetUs);
     }
 
 private:
+    class DispatchTask : public common::Task {
+    public:
+        explicit DispatchTask(int32_t id) : common::Task(id) {}
+        ~DispatchTask() override = default;
+
+        bool Run(uint32_t threadIndex) override;
+    };
+
     uint32_t TheMostSuitableThreadNum(uint32_t threadNum) const override;
+    bool RunNextCompileTask(uint32_t threadIndex, int32_t id);
+
+    JitCompileQueue compileQueue_;
     EcmaVM *compilerVm_ { nullptr };
     Mutex jitTaskPoolMutex_;
     ConditionVariable jitTaskPoolCV_;
@@ -123,6 +150,9 @@ public:
     void PrepareCompile();
 
     virtual void InstallCode();
+    // Install code loaded from the persistent jit code cache instead of compiling it, returns false if it could
+    // not be installed and the method has to be compiled.
+    bool InstallCachedCode(const JitCodeCache::CachedCode &cachedCode);
     void InstallOsrCode(JSHandle<MachineCode> &codeObj);
     void InstallCodeByCompilerTier(JSHandle<MachineCode> &machineCode,
         JSHandle<Method> &methodHandle);
@@ -167,6 +197,20 @@ public:
         return offset_ != MachineCode::INVALID_OSR_OFFSET;
     }
 
+    // Set by the compile queue when the task is dropped as stale. The task is then passed to the host thread like a
+    // compiled one, which calls ResetCompilingState instead of installing code.
+    void SetExpired()
+    {
+        expired_.store(true, std::memory_order_release);
+    }
+
+    bool IsExpired() const
+    {
+        return expired_.load(std::memory_order_acquire);
+    }
+
+    void ResetCompilingState();
+
     CompilerTier GetCompilerTier() const
     {
         return compilerTier_;
@@ -301,6 +345,8 @@ private:
     JitCompileMode jitCompileMode_;
     JitDfx *jitDfx_ { nullptr };
     int mainThreadCompileTime_ {0};
+    bool isCachedCode_ {false};
+    std::atomic<bool> expired_ {false};
 
     std::atomic<RunState> runState_;
     Mutex runStateMutex_;
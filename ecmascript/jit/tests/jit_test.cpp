@@ -13,10 +13,14 @@
  * limitations under the License.
  */
 
+#include <cstdio>
+#include <fstream>
+
 #include "ecmascript/checkpoint/thread_state_transition.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/object_factory-inl.h"
 #include "ecmascript/tests/test_helper.h"
+#include "ecmascript/jit/jit_code_cache.h"
 #include "ecmascript/jit/jit_task.h"
 
 using namespace panda::ecmascript;
@@ -82,4 +86,306 @@ HWTEST_F_L0(JitTest, NewJitTask)
         JitCompileMode(JitCompileMode::Mode::SYNC));
     EXPECT_TRUE(jitTask->GetHostThread() == thread_);
 }
+
+/**
+ * @tc.name: JitCodeCacheDisabledByDefault
+ * @tc.desc: check the persistent jit code cache is only created when a cache path is configured.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitCodeCacheDisabledByDefault)
+{
+    EXPECT_FALSE(instance_->GetJSOptions().IsEnableJitCodeCache());
+    EXPECT_TRUE(jit_->GetCodeCache() == nullptr);
+}
+namespace {
+class FakeCompileTask : public common::Task {
+public:
+    FakeCompileTask(uint32_t index, std::vector<uint32_t> &order) : common::Task(0), index_(index), order_(order) {}
+    ~FakeCompileTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        order_.push_back(index_);
+        return true;
+    }
+
+private:
+    uint32_t index_ {0};
+    std::vector<uint32_t> &order_;
+};
+
+void RunAll(JitCompileQueue &queue, JitCompileQueue::TimePoint now)
+{
+    std::unique_ptr<common::Task> task;
+    uint64_t waitUs = 0;
+    uint64_t delayUs = 0;
+    uint32_t droppedCount = 0;
+    uint32_t expiredCount = 0;
+    while (queue.Pop(task, waitUs, delayUs, droppedCount, expiredCount, now) == JitCompileQueue::PopResult::TASK) {
+        task->Run(0);
+    }
+}
+}  // namespace
+
+/**
+ * @tc.name: JitCompileQueueOrder
+ * @tc.desc: check sync tasks are taken first, then tasks by descending benefit, and stale tasks are dropped.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitCompileQueueOrder)
+{
+    JitCompileQueue queue;
+    std::vector<uint32_t> order;
+    auto start = JitCompileQueue::SteadyClock::now();
+    queue.Push(std::make_unique<FakeCompileTask>(0, order), {JitCompileQueue::ComputeBenefit(100, 1000), false, false},
+               start);
+    queue.Push(std::make_unique<FakeCompileTask>(1, order), {JitCompileQueue::ComputeBenefit(100, 10), false, false},
+               start);
+    queue.Push(std::make_unique<FakeCompileTask>(2, order), {0, true, false}, start);
+    queue.Push(std::make_unique<FakeCompileTask>(3, order), {JitCompileQueue::ComputeBenefit(100, 10), false, true},
+               start);
+    EXPECT_EQ(queue.Size(), 4U);
+    RunAll(queue, start);
+    EXPECT_EQ(order, std::vector<uint32_t>({2, 1, 3, 0}));
+
+    order.clear();
+    queue.Push(std::make_unique<FakeCompileTask>(0, order), {1, false, false}, start);
+    queue.Push(std::make_unique<FakeCompileTask>(1, order), {1, false, true}, start);
+    auto later = start + std::chrono::microseconds(JitCompileQueue::MAX_OSR_WAIT_US + 1);
+    std::unique_ptr<common::Task> task;
+    uint64_t waitUs = 0;
+    uint64_t delayUs = 0;
+    uint32_t droppedCount = 0;
+    uint32_t expiredCount = 0;
+    EXPECT_EQ(queue.Pop(task, waitUs, delayUs, droppedCount, expiredCount, later), JitCompileQueue::PopResult::TASK);
+    EXPECT_EQ(droppedCount, 1U);
+    EXPECT_EQ(expiredCount, 1U);
+    EXPECT_EQ(waitUs, JitCompileQueue::MAX_OSR_WAIT_US + 1);
+    EXPECT_EQ(queue.Size(), 0U);
+}
+
+/**
+ * @tc.name: JitCompileQueueExpiredTaskCanCompileAgain
+ * @tc.desc: check a stale task is handed back to the host thread, which clears the compiling flag of the function
+ *           so that it can be compiled again, and that terminated tasks are not handed back.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitCompileQueueExpiredTaskCanCompileAgain)
+{
+    JSHandle<JSFunction> function(instance_->GetGlobalEnv()->GetObjectFunction());
+    function->SetJitCompilingFlag(true);
+    CString methodName("methodName");
+    std::shared_ptr<JitTask> jitTask = std::make_shared<JitTask>(thread_, compilerVm_->GetJSThreadNoCheck(),
+        jit_, function, CompilerTier(CompilerTier::Tier::FAST), methodName, MachineCode::INVALID_OSR_OFFSET,
+        JitCompileMode(JitCompileMode::Mode::ASYNC));
+
+    JitCompileQueue queue;
+    std::vector<uint32_t> order;
+    auto start = JitCompileQueue::SteadyClock::now();
+    uint32_t expiredCount = 0;
+    JitCompileQueue::TaskInfo info {1, false, false};
+    info.onExpired = [this, jitTask, &expiredCount]() {
+        expiredCount++;
+        jitTask->SetExpired();
+        jit_->RequestInstallCode(jitTask);
+    };
+    queue.Push(std::make_unique<FakeCompileTask>(0, order), info, start);
+    auto terminated = std::make_unique<FakeCompileTask>(1, order);
+    terminated->Terminated();
+    info.onExpired = [&expiredCount]() { expiredCount++; };
+    queue.Push(std::move(terminated), info, start);
+
+    std::unique_ptr<common::Task> task;
+    uint64_t waitUs = 0;
+    uint64_t delayUs = 0;
+    uint32_t droppedCount = 0;
+    uint32_t staleCount = 0;
+    auto later = start + std::chrono::microseconds(JitCompileQueue::MAX_WAIT_US + 1);
+    EXPECT_EQ(queue.Pop(task, waitUs, delayUs, droppedCount, staleCount, later), JitCompileQueue::PopResult::EMPTY);
+    EXPECT_EQ(droppedCount, 2U);
+    // the terminated task is dropped but not counted as stale
+    EXPECT_EQ(staleCount, 1U);
+    EXPECT_EQ(expiredCount, 1U);
+    EXPECT_TRUE(order.empty());
+    EXPECT_TRUE(jitTask->IsExpired());
+    EXPECT_TRUE(function->IsJitCompiling());
+
+    jit_->InstallTasks(thread_);
+    EXPECT_FALSE(function->IsJitCompiling());
+}
+
+/**
+ * @tc.name: JitCompileQueueBudget
+ * @tc.desc: check async tasks wait for the next window once the compile budget is used up, sync tasks do not.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitCompileQueueBudget)
+{
+    JitCompileQueue queue;
+    std::vector<uint32_t> order;
+    auto start = JitCompileQueue::SteadyClock::now();
+    queue.SetBudget(JitCompileQueue::BACKGROUND_BUDGET_US);
+    queue.RecordCompileTime(JitCompileQueue::BACKGROUND_BUDGET_US, start);
+    queue.Push(std::make_unique<FakeCompileTask>(0, order), {1, false, false}, start);
+
+    std::unique_ptr<common::Task> task;
+    uint64_t waitUs = 0;
+    uint64_t delayUs = 0;
+    uint32_t droppedCount = 0;
+    uint32_t expiredCount = 0;
+    EXPECT_EQ(queue.Pop(task, waitUs, delayUs, droppedCount, expiredCount, start),
+              JitCompileQueue::PopResult::OVER_BUDGET);
+    EXPECT_EQ(delayUs, JitCompileQueue::BUDGET_WINDOW_US);
+    EXPECT_EQ(queue.Size(), 1U);
+
+    queue.Push(std::make_unique<FakeCompileTask>(1, order), {0, true, false}, start);
+    RunAll(queue, start);
+    EXPECT_EQ(order, std::vector<uint32_t>({1}));
+
+    RunAll(queue, start + std::chrono::microseconds(JitCompileQueue::BUDGET_WINDOW_US));
+    EXPECT_EQ(order, std::vector<uint32_t>({1, 0}));
+}
+
+/**
+ * @tc.name: JitTimeHistogram
+ * @tc.desc: check times are counted in the bucket of their range.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitTimeHistogram)
+{
+    JitTimeHistogram histogram;
+    histogram.Record(0);
+    histogram.Record(99);
+    histogram.Record(100);
+    histogram.Record(10000000);
+    EXPECT_EQ(histogram.GetCount(0), 2U);
+    EXPECT_EQ(histogram.GetCount(1), 1U);
+    EXPECT_EQ(histogram.GetCount(JitTimeHistogram::BUCKET_NUM - 1), 1U);
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(0), 0U);
+}
+
+#if defined(PANDA_TARGET_AMD64) || defined(PANDA_TARGET_ARM64)
+namespace {
+constexpr uint32_t CACHED_CODE_SIZE = 32;
+constexpr uint32_t RELOCATION_OFFSET = 8;
+constexpr uint8_t GARBAGE_BYTE = 0xAB;
+
+std::vector<uint8_t> MakeCodeWithStubCall()
+{
+    std::vector<uint8_t> code(CACHED_CODE_SIZE, 0);
+#if defined(PANDA_TARGET_AMD64)
+    // movabs rax, imm64 with a wrong address, relocation has to patch it
+    code[RELOCATION_OFFSET] = 0x48;
+    code[RELOCATION_OFFSET + 1] = 0xB8;
+    std::fill(code.begin() + RELOCATION_OFFSET + 2, code.begin() + RELOCATION_OFFSET + 10, GARBAGE_BYTE);
+#else
+    // movz x0 and 3 movk x0 with a wrong address, relocation has to patch it
+    const uint32_t insns[] = {0xD2955560, 0xF2B55560, 0xF2D55560, 0xF2F55560};
+    if (memcpy_s(code.data() + RELOCATION_OFFSET, sizeof(insns), insns, sizeof(insns)) != EOK) {
+        code.clear();
+    }
+#endif
+    return code;
+}
+
+uint64_t ReadStubAddress(const std::vector<uint8_t> &code)
+{
+    uint64_t address = 0;
+#if defined(PANDA_TARGET_AMD64)
+    if (memcpy_s(&address, sizeof(address), code.data() + RELOCATION_OFFSET + 2, sizeof(address)) != EOK) {
+        return 0;
+    }
+#else
+    for (uint32_t i = 0; i < 4; i++) {  // 4: movz and 3 movk
+        uint32_t insn = 0;
+        if (memcpy_s(&insn, sizeof(insn), code.data() + RELOCATION_OFFSET + i * sizeof(insn), sizeof(insn)) != EOK) {
+            return 0;
+        }
+        address |= static_cast<uint64_t>((insn >> 5U) & 0xFFFFU) << (i * 16U);  // 5: imm16 shift, 16: hword bits
+    }
+#endif
+    return address;
+}
+}  // namespace
+
+/**
+ * @tc.name: JitCodeCacheRoundTrip
+ * @tc.desc: check code stored in the jit code cache is loaded in the background, relocated with the current stub
+ *           addresses, and that stale or corrupted entries are rejected.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(JitTest, JitCodeCacheRoundTrip)
+{
+    const std::string cacheDir = "/tmp";
+    const std::string cacheFile = "/tmp/7e57c0de.jitcache";
+    std::remove(cacheFile.c_str());
+    JitCodeCache::Key key;
+    key.abcChecksum = 0x7e57c0de;
+    key.methodId = 1;
+    key.profileHash = 42;  // 42: any hash
+
+    std::vector<uint8_t> code = MakeCodeWithStubCall();
+    ASSERT_EQ(code.size(), CACHED_CODE_SIZE);
+    std::vector<uint8_t> offsetTable {1, 2, 3, 4};
+    uint64_t target = static_cast<uint64_t>(thread_->GetBaselineStubEntry(0));
+    StubRelocation relocation {RELOCATION_OFFSET, static_cast<uintptr_t>(target)};
+    MachineCodeDesc desc;
+    desc.codeAddr = ToUintPtr(code.data());
+    desc.codeSize = code.size();
+    desc.stackMapOrOffsetTableAddr = ToUintPtr(offsetTable.data());
+    desc.stackMapOrOffsetTableSize = offsetTable.size();
+    desc.stubRelocationAddr = ToUintPtr(&relocation);
+    desc.stubRelocationCount = 1;
+    desc.stubCallsPatchable = true;
+    {
+        JitCodeCache cache(cacheDir);
+        cache.Record(thread_, key, desc);
+        cache.Flush();
+    }
+    {
+        JitCodeCache cache(cacheDir);
+        JitCodeCache::CachedCode cached;
+        // the first lookup only starts loading the file
+        EXPECT_FALSE(cache.Lookup(thread_, key, cached));
+        cache.WaitAllTasksFinished();
+        EXPECT_TRUE(cache.IsLoaded(key.abcChecksum));
+        ASSERT_TRUE(cache.Lookup(thread_, key, cached));
+        EXPECT_EQ(cached.code.size(), code.size());
+        EXPECT_EQ(cached.offsetTable, offsetTable);
+        EXPECT_EQ(ReadStubAddress(cached.code), target);
+
+        JitCodeCache::Key staleKey = key;
+        staleKey.profileHash++;
+        EXPECT_FALSE(cache.Lookup(thread_, staleKey, cached));
+    }
+
+    // flip the last byte of the payload, the entry must not be used
+    {
+        std::fstream file(cacheFile, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        file.seekg(-1, std::ios::end);
+        char last = 0;
+        file.read(&last, 1);
+        file.seekp(-1, std::ios::end);
+        last = static_cast<char>(~last);
+        file.write(&last, 1);
+    }
+    {
+        JitCodeCache cache(cacheDir);
+        JitCodeCache::CachedCode cached;
+        EXPECT_FALSE(cache.Lookup(thread_, key, cached));
+        cache.WaitAllTasksFinished();
+        EXPECT_TRUE(cache.IsLoaded(key.abcChecksum));
+        EXPECT_FALSE(cache.Lookup(thread_, key, cached));
+    }
+    std::remove(cacheFile.c_str());
+}
+#endif
 }  // namespace panda::test
@@ -17,15 +17,32 @@
 
 #include "ecmascript/global_env.h"
 #include "ecmascript/jobs/pending_job.h"
+#include "ecmascript/js_async_function.h"
 #include "ecmascript/js_tagged_value_wrapper-inl.h"
 #include "ecmascript/tagged_queue.h"
 
+#if defined(ENABLE_HITRACE)
+#include "hitrace/trace.h"
+#endif
+
 namespace panda::ecmascript::job {
-uint32_t MicroJobQueue::GetPromiseQueueSize(JSThread *thread, JSHandle<MicroJobQueue> jobQueue)
+uint32_t MicroJobQueue::GetPromiseQueueSize(JSThread *thread, [[maybe_unused]] JSHandle<MicroJobQueue> jobQueue)
 {
-    [[maybe_unused]] EcmaHandleScope handleScope(thread);
-    JSHandle<TaggedQueue> promiseQueue(thread, jobQueue->GetPromiseJobQueue(thread));
-    return promiseQueue->Size(thread);
+    return thread->GetEcmaVM()->GetPromiseJobRing().Size();
+}
+
+bool MicroJobQueue::NeedsPendingJob([[maybe_unused]] JSThread *thread)
+{
+#if defined(ENABLE_HITRACE)
+    // the hitrace chain and the micro job trace keep their ids in the PendingJob
+    if (thread->GetEcmaVM()->GetJSOptions().EnableMicroJobTrace()) {
+        return true;
+    }
+    HiTraceId id = HiTraceChain::GetId();
+    return id.IsValid() && id.IsFlagEnabled(HITRACE_FLAG_INCLUDE_ASYNC);
+#else
+    return false;
+#endif
 }
 
 void MicroJobQueue::EnqueueJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue, QueueType queueType,
@@ -36,33 +53,129 @@ void MicroJobQueue::EnqueueJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueu
     // 3. Assert: arguments is a List that has the same number of elements as the number of parameters required by job.
     // 4. Let callerContext be the running execution context.
     // 5. Let callerRealm be callerContext’s Realm.
-    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-    [[maybe_unused]] EcmaHandleScope handleScope(thread);
-    JSHandle<PendingJob> pendingJob(factory->NewPendingJob(job, argv));
-    ENQUEUE_JOB_HITRACE(pendingJob, queueType);
-    ENQUEUE_JOB_TRACE(thread, pendingJob);
-
     if (queueType == QueueType::QUEUE_PROMISE) {
-        JSHandle<TaggedQueue> promiseQueue(thread, jobQueue->GetPromiseJobQueue(thread));
-        TaggedQueue *newPromiseQueue = TaggedQueue::Push(thread, promiseQueue, JSHandle<JSTaggedValue>(pendingJob));
-        jobQueue->SetPromiseJobQueue(thread, JSTaggedValue(newPromiseQueue));
-        LOG_ECMA(VERBOSE) << "EnqueueJob length: " << newPromiseQueue->Size(thread);
+        if (UNLIKELY(NeedsPendingJob(thread))) {
+            EnqueuePendingPromiseJob(thread, job, argv);
+            return;
+        }
+        PromiseJobRing::Entry entry;
+        entry.job = job.GetTaggedValue();
+        entry.argc = argv->GetLength();
+        if (entry.IsSpilled()) {
+            entry.args[0] = argv.GetTaggedValue();
+        } else {
+            for (uint32_t i = 0; i < entry.argc; i++) {
+                entry.args[i] = argv->Get(thread, i);
+            }
+        }
+        PromiseJobRing &ring = thread->GetEcmaVM()->GetPromiseJobRing();
+        ring.Push(entry);
+        LOG_ECMA(VERBOSE) << "EnqueueJob length: " << ring.Size();
     } else if (queueType == QueueType::QUEUE_SCRIPT) {
+        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        JSHandle<PendingJob> pendingJob(factory->NewPendingJob(job, argv));
+        ENQUEUE_JOB_HITRACE(pendingJob, queueType);
+        ENQUEUE_JOB_TRACE(thread, pendingJob);
         JSHandle<TaggedQueue> scriptQueue(thread, jobQueue->GetScriptJobQueue(thread));
         TaggedQueue *newScriptQueue = TaggedQueue::Push(thread, scriptQueue, JSHandle<JSTaggedValue>(pendingJob));
         jobQueue->SetScriptJobQueue(thread, JSTaggedValue(newScriptQueue));
     }
 }
 
-void MicroJobQueue::ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue)
+void MicroJobQueue::EnqueuePromiseReactionJob(JSThread *thread, JSTaggedValue reaction, JSTaggedValue argument)
+{
+    JSTaggedValue promiseReactionJob = thread->GetEcmaVM()->GetGlobalEnv()->GetPromiseReactionJob().GetTaggedValue();
+    if (UNLIKELY(NeedsPendingJob(thread))) {
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        JSHandle<JSFunction> job(thread, promiseReactionJob);
+        JSHandle<JSTaggedValue> reactionHandle(thread, reaction);
+        JSHandle<JSTaggedValue> argumentHandle(thread, argument);
+        JSHandle<TaggedArray> argv = thread->GetEcmaVM()->GetFactory()->NewTaggedArray(2);  // 2: reaction, argument
+        argv->Set(thread, 0, reactionHandle);
+        argv->Set(thread, 1, argumentHandle);
+        EnqueuePendingPromiseJob(thread, job, argv);
+        return;
+    }
+    PromiseJobRing::Entry entry;
+    entry.job = promiseReactionJob;
+    entry.args[0] = reaction;
+    entry.args[1] = argument;
+    entry.argc = 2;  // 2: reaction, argument
+    thread->GetEcmaVM()->GetPromiseJobRing().Push(entry);
+}
+
+void MicroJobQueue::EnqueueAwaitResumeJob(JSThread *thread, JSTaggedValue asyncCtxt, JSTaggedValue value,
+                                          bool isRejected)
 {
+    ASSERT(asyncCtxt.IsGeneratorContext());
+    PromiseJobRing::Entry entry;
+    entry.job = asyncCtxt;
+    entry.args[0] = value;
+    entry.args[1] = JSTaggedValue(isRejected);
+    entry.argc = 2;  // 2: value, isRejected
+    thread->GetEcmaVM()->GetPromiseJobRing().Push(entry);
+}
+
+void MicroJobQueue::EnqueuePendingPromiseJob(JSThread *thread, const JSHandle<JSFunction> &job,
+                                             const JSHandle<TaggedArray> &argv)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
-    JSMutableHandle<TaggedQueue> promiseQueue(thread, jobQueue->GetPromiseJobQueue(thread));
-    JSMutableHandle<PendingJob> pendingJob(thread, JSTaggedValue::Undefined());
-    while (!promiseQueue->Empty(thread)) {
-        LOG_ECMA(VERBOSE) << "ExecutePendingJob length: " << promiseQueue->Size(thread);
-        pendingJob.Update(promiseQueue->Pop(thread));
+    JSHandle<PendingJob> pendingJob(factory->NewPendingJob(job, argv));
+    ENQUEUE_JOB_HITRACE(pendingJob, QueueType::QUEUE_PROMISE);
+    ENQUEUE_JOB_TRACE(thread, pendingJob);
+    PromiseJobRing::Entry entry;
+    entry.job = pendingJob.GetTaggedValue();
+    thread->GetEcmaVM()->GetPromiseJobRing().Push(entry);
+}
+
+void MicroJobQueue::ExecutePromiseJob(JSThread *thread, const PromiseJobRing::Entry &entry)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    if (entry.job.IsPendingJob()) {
+        JSHandle<PendingJob> pendingJob(thread, entry.job);
         PendingJob::ExecutePendingJob(pendingJob, thread);
+        return;
+    }
+    if (entry.job.IsGeneratorContext()) {
+        JSHandle<GeneratorContext> asyncCtxt(thread, entry.job);
+        JSHandle<JSTaggedValue> value(thread, entry.args[0]);
+        JSAsyncFunction::AsyncFunctionAwaitResume(thread, asyncCtxt, value, entry.args[1].IsTrue());
+        return;
+    }
+    JSHandle<JSTaggedValue> job(thread, entry.job);
+    if (entry.IsSpilled()) {
+        JSHandle<TaggedArray> argv(thread, entry.args[0]);
+        JSHandle<JSTaggedValue> firstArg(thread, argv->Get(thread, 0));
+        uint32_t argsLength = entry.argc;
+        PendingJob::CallJob(thread, job, argsLength, firstArg, [&argv, argsLength](EcmaRuntimeCallInfo *info) {
+            info->SetCallArg(argsLength, argv);
+        });
+        return;
+    }
+    std::array<JSHandle<JSTaggedValue>, PromiseJobRing::MAX_INLINE_ARGS> args;
+    for (uint32_t i = 0; i < entry.argc; i++) {
+        args[i] = JSHandle<JSTaggedValue>(thread, entry.args[i]);
+    }
+    JSHandle<JSTaggedValue> firstArg = entry.argc >= 1 ? args[0] : thread->GlobalConstants()->GetHandledUndefined();
+    uint32_t argsLength = entry.argc;
+    PendingJob::CallJob(thread, job, argsLength, firstArg, [&args, argsLength](EcmaRuntimeCallInfo *info) {
+        for (uint32_t i = 0; i < argsLength; i++) {
+            info->SetCallArg(i, args[i].GetTaggedValue());
+        }
+    });
+}
+
+void MicroJobQueue::ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    // jobs queued while the ring is drained are run in the same pass, an entry is put into handles before it runs
+    PromiseJobRing &promiseRing = thread->GetEcmaVM()->GetPromiseJobRing();
+    PromiseJobRing::Entry entry;
+    while (promiseRing.Pop(entry)) {
+        LOG_ECMA(VERBOSE) << "ExecutePendingJob length: " << promiseRing.Size() + 1;
+        ExecutePromiseJob(thread, entry);
         if (!thread->IsInConcurrentScope()) {
             thread->SetTaskInfo(reinterpret_cast<uintptr_t>(nullptr));
         }
@@ -70,14 +183,13 @@ void MicroJobQueue::ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue>
             return;
         }
         if (thread->HasTerminated()) {
-            JSHandle<TaggedQueue> emptyQueue(thread->GlobalConstants()->GetHandledEmptyTaggedQueue());
-            jobQueue->SetPromiseJobQueue(thread, emptyQueue);
+            promiseRing.Clear();
             return;
         }
-        promiseQueue.Update(jobQueue->GetPromiseJobQueue(thread));
     }
 
     JSHandle<TaggedQueue> scriptQueue(thread, jobQueue->GetScriptJobQueue(thread));
+    JSMutableHandle<PendingJob> pendingJob(thread, JSTaggedValue::Undefined());
     while (!scriptQueue->Empty(thread)) {
         pendingJob.Update(scriptQueue->Pop(thread));
         PendingJob::ExecutePendingJob(pendingJob, thread);
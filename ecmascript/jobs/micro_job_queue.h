@@ -19,10 +19,13 @@
 #include "ecmascript/js_function.h"
 #include "ecmascript/js_handle.h"
 #include "ecmascript/js_thread.h"
+#include "ecmascript/jobs/promise_job_ring.h"
 #include "ecmascript/record.h"
 #include "ecmascript/tagged_array.h"
 
 namespace panda::ecmascript::job {
+// Promise jobs are queued in the PromiseJobRing of the vm rather than in PromiseJobQueue, which stays an empty
+// TaggedQueue so that the layout of the object described by snapshots and heap dumps does not change.
 class MicroJobQueue final : public Record {
 public:
     static MicroJobQueue *Cast(TaggedObject *object)
@@ -34,7 +37,15 @@ public:
     static uint32_t GetPromiseQueueSize(JSThread *thread, JSHandle<MicroJobQueue> jobQueue);
     static void EnqueueJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue, QueueType queueType,
         const JSHandle<JSFunction> &job, const JSHandle<TaggedArray> &argv);
+    // Queues PromiseReactionJob(reaction, argument) without allocating anything on the heap, unless a trace has
+    // to follow the job.
+    static void EnqueuePromiseReactionJob(JSThread *thread, JSTaggedValue reaction, JSTaggedValue argument);
+    // Queues the continuation of an async function whose await took the fast path, see JSAsyncFunction.
+    static void EnqueueAwaitResumeJob(JSThread *thread, JSTaggedValue asyncCtxt, JSTaggedValue value,
+                                      bool isRejected);
     static void ExecutePendingJob(JSThread *thread, JSHandle<MicroJobQueue> jobQueue);
+    // Whether a trace follows the jobs queued now, which then have to be PendingJobs.
+    static bool NeedsPendingJob(JSThread *thread);
 
     static constexpr size_t PROMISE_JOB_QUEUE_OFFSET = Record::SIZE;
     ACCESSORS(PromiseJobQueue, PROMISE_JOB_QUEUE_OFFSET, SCRIPT_JOB_QUEUE_OFFSET);
@@ -43,6 +54,11 @@ public:
     DECL_DUMP()
 
     DECL_VISIT_OBJECT(PROMISE_JOB_QUEUE_OFFSET, SIZE)
+
+private:
+    static void EnqueuePendingPromiseJob(JSThread *thread, const JSHandle<JSFunction> &job,
+                                         const JSHandle<TaggedArray> &argv);
+    static void ExecutePromiseJob(JSThread *thread, const PromiseJobRing::Entry &entry);
 };
 }  // namespace panda::ecmascript::job
 #endif  // ECMASCRIPT_JOBS_MICRO_JOB_QUEUE_H
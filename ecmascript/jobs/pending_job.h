@@ -43,29 +43,41 @@ public:
         EXECUTE_JOB_TRACE(thread, pendingJob);
 
         JSHandle<JSTaggedValue> job(thread, pendingJob->GetJob(thread));
-        ASSERT(job->IsCallable());
         JSHandle<TaggedArray> argv(thread, pendingJob->GetArguments(thread));
         const uint32_t argsLength = argv->GetLength();
+        JSHandle<JSTaggedValue> firstArg(thread, argsLength >= 1 ? argv->Get(thread, 0) : JSTaggedValue::Undefined());
+        return CallJob(thread, job, argsLength, firstArg, [&argv, argsLength](EcmaRuntimeCallInfo *info) {
+            info->SetCallArg(argsLength, argv);
+        });
+    }
+
+    // Calls a job with its arguments; setArgs puts them into the call info. The first argument is the promise
+    // reaction or the promise the async stack trace follows.
+    template <typename SetArgs>
+    static JSTaggedValue CallJob(JSThread *thread, const JSHandle<JSTaggedValue> &job, uint32_t argsLength,
+                                 const JSHandle<JSTaggedValue> &firstArg, const SetArgs &setArgs)
+    {
+        ASSERT(job->IsCallable());
         JSHandle<JSTaggedValue> undefined = thread->GlobalConstants()->GetHandledUndefined();
         EcmaVM *vm = thread->GetEcmaVM();
         bool stackTrace = vm->GetJsDebuggerManager()->IsAsyncStackTrace();
         if (stackTrace && argsLength >= 1) {
-            vm->GetAsyncStackTrace()->InsertCurrentAsyncTaskStack(argv->Get(thread, 0));
+            vm->GetAsyncStackTrace()->InsertCurrentAsyncTaskStack(firstArg.GetTaggedValue());
         }
         // For runtime async stack recording
         if (UNLIKELY(vm->IsEnableRuntimeAsyncStack()) && argsLength >= 1) {
-            vm->GetAsyncStackTraceManager()->SetCurrentPromiseTask(argv->Get(thread, 0));
+            vm->GetAsyncStackTraceManager()->SetCurrentPromiseTask(firstArg.GetTaggedValue());
         }
         EcmaRuntimeCallInfo *info = EcmaInterpreter::NewRuntimeCallInfo(thread, job, undefined, undefined, argsLength);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        info->SetCallArg(argsLength, argv);
+        setArgs(info);
         JSTaggedValue result = JSFunction::Call(info);
         if (stackTrace && argsLength >= 1) {
-            vm->GetAsyncStackTrace()->RemoveAsyncTaskStack(argv->Get(thread, 0));
+            vm->GetAsyncStackTrace()->RemoveAsyncTaskStack(firstArg.GetTaggedValue());
         }
         // For runtime async stack recording
         if (UNLIKELY(vm->IsEnableRuntimeAsyncStack()) && argsLength >= 1) {
-            vm->GetAsyncStackTraceManager()->ResetCurrentPromiseJob(argv->Get(thread, 0));
+            vm->GetAsyncStackTraceManager()->ResetCurrentPromiseJob(firstArg.GetTaggedValue());
         }
         return result;
     }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/jobs/promise_job_ring.h"
+
+#include <cstddef>
+
+namespace panda::ecmascript::job {
+// the job and the arguments of an entry are visited as one range of slots
+static_assert(offsetof(PromiseJobRing::Entry, args) == sizeof(JSTaggedValue));
+
+void PromiseJobRing::Push(const Entry &entry)
+{
+    if (size_ == Capacity()) {
+        Grow();
+    }
+    entries_[(head_ + size_) & Mask()] = entry;
+    size_++;
+}
+
+bool PromiseJobRing::Pop(Entry &entry)
+{
+    if (size_ == 0) {
+        return false;
+    }
+    entry = entries_[head_];
+    // the slot must not keep the job alive once it is out of the ring
+    entries_[head_] = Entry();
+    head_ = (head_ + 1) & Mask();
+    size_--;
+    if (size_ == 0) {
+        head_ = 0;
+        if (Capacity() > MAX_RETAINED_CAPACITY) {
+            std::vector<Entry>(INITIAL_CAPACITY).swap(entries_);
+        }
+    }
+    return true;
+}
+
+const PromiseJobRing::Entry &PromiseJobRing::Front() const
+{
+    ASSERT(size_ != 0);
+    return entries_[head_];
+}
+
+void PromiseJobRing::Clear()
+{
+    std::vector<Entry>().swap(entries_);
+    head_ = 0;
+    size_ = 0;
+}
+
+void PromiseJobRing::Grow()
+{
+    // the capacity stays a power of two, so that an index wraps around with a mask
+    uint32_t newCapacity = Capacity() == 0 ? INITIAL_CAPACITY : Capacity() * 2;  // 2: double the capacity
+    std::vector<Entry> newEntries(newCapacity);
+    for (uint32_t i = 0; i < size_; i++) {
+        newEntries[i] = entries_[(head_ + i) & Mask()];
+    }
+    entries_.swap(newEntries);
+    head_ = 0;
+}
+
+void PromiseJobRing::Iterate(RootVisitor &v)
+{
+    for (uint32_t i = 0; i < size_; i++) {
+        Entry &entry = entries_[(head_ + i) & Mask()];
+        v.VisitRangeRoot(Root::ROOT_VM, ObjectSlot(ToUintPtr(&entry.job)),
+                         ObjectSlot(ToUintPtr(entry.args.data() + MAX_INLINE_ARGS)));
+    }
+}
+}  // namespace panda::ecmascript::job
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_JOBS_PROMISE_JOB_RING_H
+#define ECMASCRIPT_JOBS_PROMISE_JOB_RING_H
+
+#include <array>
+#include <vector>
+
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/visitor.h"
+
+namespace panda::ecmascript::job {
+// The promise jobs of a vm waiting to run, in a ring buffer outside of the heap. An entry holds the job function
+// and up to MAX_INLINE_ARGS arguments in place, so a promise reaction is queued without any heap allocation. Jobs
+// with more arguments keep them in their TaggedArray, which then sits in the first argument slot.
+//
+// The job may also be a PendingJob, which is executed as a whole; it is used when hitrace needs to follow the job.
+// A GeneratorContext as the job resumes an async function after an await, with the value and whether it was
+// rejected as the arguments. The slots of all queued entries are roots of the vm.
+class PromiseJobRing {
+public:
+    static constexpr uint32_t MAX_INLINE_ARGS = 3;
+
+    struct Entry {
+        JSTaggedValue job {JSTaggedValue::Undefined()};
+        std::array<JSTaggedValue, MAX_INLINE_ARGS> args {JSTaggedValue::Undefined(), JSTaggedValue::Undefined(),
+                                                         JSTaggedValue::Undefined()};
+        uint32_t argc {0};
+
+        bool IsSpilled() const
+        {
+            return argc > MAX_INLINE_ARGS;
+        }
+    };
+
+    PromiseJobRing() = default;
+    ~PromiseJobRing() = default;
+
+    NO_COPY_SEMANTIC(PromiseJobRing);
+    NO_MOVE_SEMANTIC(PromiseJobRing);
+
+    void Push(const Entry &entry);
+    // The popped entry is only safe until the next allocation, its values must be put into handles first.
+    bool Pop(Entry &entry);
+    const Entry &Front() const;
+    void Clear();
+    void Iterate(RootVisitor &v);
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    uint32_t Size() const
+    {
+        return size_;
+    }
+
+    uint32_t Capacity() const
+    {
+        return static_cast<uint32_t>(entries_.size());
+    }
+
+private:
+    static constexpr uint32_t INITIAL_CAPACITY = 64;
+    // a burst of jobs may grow the ring a lot, it goes back to the initial capacity once drained
+    static constexpr uint32_t MAX_RETAINED_CAPACITY = 4096;
+
+    void Grow();
+
+    uint32_t Mask() const
+    {
+        return Capacity() - 1;
+    }
+
+    std::vector<Entry> entries_ {};
+    uint32_t head_ {0};
+    uint32_t size_ {0};
+};
+}  // namespace panda::ecmascript::job
+#endif  // ECMASCRIPT_JOBS_PROMISE_JOB_RING_H
@@ -90,8 +90,8 @@ HWTEST_F_L0(MicroJobQueueTest, GetJobQueue)
 /**
  * @tc.name: EnqueuePromiseJob
  * @tc.desc: Get a JobQueue called MicroJobQueue from vm.define a function and TaggedArray object,call EnqueuePromiseJob
- *           function to enter the "function" and TaggedArray object into the promise job queueof the MicroJobQueue,then
- *           check whether the object out of the queue is the same as the object in the queue.
+ *           function to enter the "function" and TaggedArray object into the promise job ring of the vm,then
+ *           check whether the entry in the ring holds the job and its arguments.
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -100,29 +100,110 @@ HWTEST_F_L0(MicroJobQueueTest, EnqueuePromiseJob)
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
     JSHandle<GlobalEnv> globalEnv = thread->GetEcmaVM()->GetGlobalEnv();
     JSHandle<MicroJobQueue> handleMicrojob = thread->GetEcmaVM()->GetMicroJobQueue();
-    JSHandle<TaggedQueue> originalPromiseQueue(thread, handleMicrojob->GetPromiseJobQueue(thread));
     JSHandle<JSTaggedValue> scriptQueue(thread, handleMicrojob->GetScriptJobQueue(thread));
+    uint32_t originalSize = MicroJobQueue::GetPromiseQueueSize(thread, handleMicrojob);
 
     JSHandle<TaggedArray> arguments = factory->NewTaggedArray(2);
-    arguments->Set(thread, 0, JSTaggedValue::Undefined());
+    arguments->Set(thread, 0, JSTaggedValue(1));
     arguments->Set(thread, 1, JSTaggedValue::Undefined());
     JSHandle<JSFunction> promiseReactionsJob(globalEnv->GetPromiseReactionJob());
 
     QueueType type = QueueType::QUEUE_PROMISE;
     MicroJobQueue::EnqueueJob(thread, handleMicrojob, type, promiseReactionsJob, arguments);
 
-    JSHandle<TaggedQueue> promiseQueue(thread, handleMicrojob->GetPromiseJobQueue(thread));
-    EXPECT_EQ(JSTaggedValue::SameValue(thread, promiseQueue.GetTaggedValue(), originalPromiseQueue.GetTaggedValue()),
-              false);
+    EXPECT_EQ(MicroJobQueue::GetPromiseQueueSize(thread, handleMicrojob), originalSize + 1);
     EXPECT_EQ(JSTaggedValue::SameValue(thread, handleMicrojob->GetScriptJobQueue(thread), scriptQueue.GetTaggedValue()),
               true);
 
-    JSTaggedValue result = promiseQueue->Pop(thread);
-    EXPECT_TRUE(result.IsPendingJob());
+    job::PromiseJobRing &ring = thread->GetEcmaVM()->GetPromiseJobRing();
+    job::PromiseJobRing::Entry entry;
+    while (ring.Size() > 1) {
+        ring.Pop(entry);
+    }
+    ASSERT_TRUE(ring.Pop(entry));
+    EXPECT_EQ(entry.job, promiseReactionsJob.GetTaggedValue());
+    EXPECT_EQ(entry.argc, 2U);
+    EXPECT_EQ(entry.args[0], JSTaggedValue(1));
+    EXPECT_EQ(entry.args[1], JSTaggedValue::Undefined());
+}
+
+/**
+ * @tc.name: PromiseJobRingWrapAndGrow
+ * @tc.desc: Push and pop entries so that the ring wraps around, then push past its capacity, and check that the
+ *           entries still come out in FIFO order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MicroJobQueueTest, PromiseJobRingWrapAndGrow)
+{
+    job::PromiseJobRing ring;
+    job::PromiseJobRing::Entry entry;
+    constexpr int32_t firstRound = 40;
+    constexpr int32_t secondRound = 200;
+    for (int32_t i = 0; i < firstRound; i++) {
+        entry.job = JSTaggedValue(i);
+        ring.Push(entry);
+    }
+    for (int32_t i = 0; i < firstRound / 2; i++) {  // 2: leave half of the entries behind
+        ASSERT_TRUE(ring.Pop(entry));
+        EXPECT_EQ(entry.job.GetInt(), i);
+    }
+    for (int32_t i = firstRound; i < secondRound; i++) {
+        entry.job = JSTaggedValue(i);
+        ring.Push(entry);
+    }
+    EXPECT_EQ(ring.Size(), static_cast<uint32_t>(secondRound - firstRound / 2));  // 2: half of the entries are left
+    EXPECT_EQ(ring.Capacity() & (ring.Capacity() - 1), 0U);
+    for (int32_t i = firstRound / 2; i < secondRound; i++) {  // 2: half of the entries are left
+        ASSERT_TRUE(ring.Pop(entry));
+        EXPECT_EQ(entry.job.GetInt(), i);
+    }
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_FALSE(ring.Pop(entry));
+}
 
-    JSHandle<PendingJob> pendingJob(thread, result);
-    EXPECT_EQ(JSTaggedValue::SameValue(thread, pendingJob->GetJob(thread), promiseReactionsJob.GetTaggedValue()), true);
-    EXPECT_EQ(JSTaggedValue::SameValue(thread, pendingJob->GetArguments(thread), arguments.GetTaggedValue()), true);
+/**
+ * @tc.name: PromiseJobRingSurvivesGC
+ * @tc.desc: Queue reaction jobs whose arguments are only referenced from the ring, run a full gc, then execute the
+ *           jobs and check that the promises are resolved with those arguments.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MicroJobQueueTest, PromiseJobRingSurvivesGC)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    auto env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> promiseFunc = env->GetPromiseFunction();
+    constexpr uint32_t jobCount = 100;
+    JSHandle<TaggedArray> promises = factory->NewTaggedArray(jobCount);
+    {
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        for (uint32_t i = 0; i < jobCount; i++) {
+            JSHandle<PromiseCapability> capability = JSPromise::NewPromiseCapability(thread, promiseFunc);
+            promises->Set(thread, i, capability->GetPromise(thread));
+            JSHandle<PromiseReaction> reaction = factory->NewPromiseReaction();
+#if ENABLE_LATEST_OPTIMIZATION
+            reaction->SetPromiseOrCapability(thread, capability.GetTaggedValue());
+#else // ENABLE_LATEST_OPTIMIZATION
+            reaction->SetPromiseCapability(thread, capability.GetTaggedValue());
+#endif // ENABLE_LATEST_OPTIMIZATION
+            reaction->SetHandler(thread, thread->GlobalConstants()->GetIdentityString());
+            JSHandle<TaggedArray> argument = factory->NewTaggedArray(1);
+            argument->Set(thread, 0, JSTaggedValue(static_cast<int32_t>(i)));
+            MicroJobQueue::EnqueuePromiseReactionJob(thread, reaction.GetTaggedValue(), argument.GetTaggedValue());
+        }
+    }
+    thread->GetEcmaVM()->CollectGarbage(TriggerGCType::FULL_GC);
+
+    MicroJobQueue::ExecutePendingJob(thread, thread->GetEcmaVM()->GetMicroJobQueue());
+    EXPECT_FALSE(thread->GetEcmaVM()->HasPendingJob());
+    for (uint32_t i = 0; i < jobCount; i++) {
+        JSHandle<JSPromise> promise(thread, promises->Get(thread, i));
+        EXPECT_EQ(promise->GetPromiseState(), PromiseState::FULFILLED);
+        JSTaggedValue result = promise->GetPromiseResult(thread);
+        ASSERT_TRUE(result.IsTaggedArray());
+        EXPECT_EQ(TaggedArray::Cast(result.GetTaggedObject())->Get(thread, 0).GetInt(), static_cast<int32_t>(i));
+    }
 }
 
 /**
@@ -24,6 +24,7 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter.h"
 #include "ecmascript/js_async_generator_object.h"
+#include "ecmascript/jobs/micro_job_queue.h"
 
 namespace panda::ecmascript {
 using BuiltinsPromiseHandler = builtins::BuiltinsPromiseHandler;
@@ -47,6 +48,9 @@ void JSAsyncFunction::AsyncFunctionAwait(JSThread *thread, const JSHandle<JSTagg
         JSHandle<JSAsyncFuncObject> asyncFun = JSHandle<JSAsyncFuncObject>::Cast(obj);
         asyncCtxt = JSHandle<JSTaggedValue>(thread, asyncFun->GetGeneratorContext(thread));
     }
+    if (TryAwaitFastPath(thread, asyncCtxt, value)) {
+        return;
+    }
 
     // 2.Let promise be ? PromiseResolve(%Promise%, value).
     JSHandle<GlobalEnv> env = vm->GetGlobalEnv();
@@ -120,16 +124,81 @@ void JSAsyncFunction::AsyncFunctionAwait(JSThread *thread, const JSHandle<JSTagg
     // 13.Return.
 }
 
+bool JSAsyncFunction::TryAwaitFastPath(JSThread *thread, const JSHandle<JSTaggedValue> &asyncCtxt,
+                                       const JSHandle<JSTaggedValue> &value)
+{
+    // Await of a primitive or of a settled native promise queues the continuation itself: the promise, the
+    // onFulfilled and onRejected functions and the reactions of the full protocol are never observable there, and
+    // the continuation runs in the same tick as their reaction job would. The async stack traces and the job traces
+    // follow those objects, so they take the full protocol.
+    EcmaVM *vm = thread->GetEcmaVM();
+    if (!asyncCtxt->IsGeneratorContext() || vm->GetJsDebuggerManager()->IsAsyncStackTrace() ||
+        UNLIKELY(vm->IsEnableRuntimeAsyncStack()) || job::MicroJobQueue::NeedsPendingJob(thread)) {
+        return false;
+    }
+    bool isRejected = false;
+    JSMutableHandle<JSTaggedValue> result(thread, value.GetTaggedValue());
+    if (value->IsECMAObject()) {
+        // any other object may be a thenable or have a "constructor" getter, both run user code in PromiseResolve
+        if (!JSPromise::IsUnmodifiedNativePromise(thread, value.GetTaggedValue())) {
+            return false;
+        }
+        JSHandle<JSPromise> promise = JSHandle<JSPromise>::Cast(value);
+        PromiseState state = promise->GetPromiseState();
+        if (state == PromiseState::PENDING) {
+            return false;
+        }
+        isRejected = state == PromiseState::REJECTED;
+        // as PerformPromiseThen does for a rejected promise which gets its first handler
+        if (isRejected && !promise->GetPromiseIsHandled()) {
+            JSHandle<JSTaggedValue> reason(thread, JSTaggedValue::Null());
+            vm->PromiseRejectionTracker(promise, reason, PromiseRejectionEvent::HANDLE);
+        }
+        promise->SetPromiseIsHandled(true);
+        result.Update(promise->GetPromiseResult(thread));
+    }
+    job::MicroJobQueue::EnqueueAwaitResumeJob(thread, asyncCtxt.GetTaggedValue(), result.GetTaggedValue(),
+                                              isRejected);
+    return true;
+}
+
+void JSAsyncFunction::AsyncFunctionAwaitResume(JSThread *thread, const JSHandle<GeneratorContext> &asyncCtxt,
+                                               const JSHandle<JSTaggedValue> &value, bool isRejected)
+{
+    if (isRejected) {
+        JSAsyncAwaitStatusFunction::ResumeRejected(thread, asyncCtxt, value);
+    } else {
+        JSAsyncAwaitStatusFunction::ResumeFulfilled(thread, asyncCtxt, value);
+    }
+    // PromiseReactionJob would settle the throwaway promise of the await with an abrupt completion of the handler
+    if (thread->HasPendingException()) {
+        thread->ClearExceptionAndExtraErrorMessage();
+    }
+}
+
 JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::AsyncFunctionAwaitFulfilled(
     JSThread *thread, const JSHandle<JSAsyncAwaitStatusFunction> &func, const JSHandle<JSTaggedValue> &value)
 {
     // 1.Let asyncContext be F.[[AsyncContext]].
     JSHandle<GeneratorContext> asyncCtxt(thread, func->GetAsyncContext(thread));
+    ResumeFulfilled(thread, asyncCtxt, value);
+    return JSHandle<JSTaggedValue>(thread, JSTaggedValue::Undefined());
+}
+
+JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::AsyncFunctionAwaitRejected(
+    JSThread *thread, const JSHandle<JSAsyncAwaitStatusFunction> &func, const JSHandle<JSTaggedValue> &reason)
+{
+    // 1.Let asyncContext be F.[[AsyncContext]].
+    JSHandle<GeneratorContext> asyncCtxt(thread, func->GetAsyncContext(thread));
+    return ResumeRejected(thread, asyncCtxt, reason);
+}
 
+void JSAsyncAwaitStatusFunction::ResumeFulfilled(JSThread *thread, const JSHandle<GeneratorContext> &asyncCtxt,
+                                                 const JSHandle<JSTaggedValue> &value)
+{
     JSHandle<JSTaggedValue> tagVal(thread, asyncCtxt->GetGeneratorObject(thread));
     if (tagVal->IsAsyncGeneratorObject()) {
         AsyncGeneratorHelper::Next(thread, asyncCtxt, value.GetTaggedValue());
-        return JSHandle<JSTaggedValue>(thread, JSTaggedValue::Undefined());
     } else {
         // 2.Let prevContext be the running execution context.
         // 3.Suspend prevContext.
@@ -141,16 +210,13 @@ JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::AsyncFunctionAwaitFulfilled(
         //   and prevContext is the currently running execution context.
 
         // 7.Return Completion(result).
-        return JSHandle<JSTaggedValue>(thread, JSTaggedValue::Undefined());
     }
 }
 
-JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::AsyncFunctionAwaitRejected(
-    JSThread *thread, const JSHandle<JSAsyncAwaitStatusFunction> &func, const JSHandle<JSTaggedValue> &reason)
+JSHandle<JSTaggedValue> JSAsyncAwaitStatusFunction::ResumeRejected(JSThread *thread,
+                                                                   const JSHandle<GeneratorContext> &asyncCtxt,
+                                                                   const JSHandle<JSTaggedValue> &reason)
 {
-    // 1.Let asyncContext be F.[[AsyncContext]].
-    JSHandle<GeneratorContext> asyncCtxt(thread, func->GetAsyncContext(thread));
-
     JSHandle<JSTaggedValue> tagVal(thread, asyncCtxt->GetGeneratorObject(thread));
     if (tagVal->IsAsyncGeneratorObject()) {
         ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
@@ -34,6 +34,12 @@ public:
                                                               const JSHandle<JSAsyncAwaitStatusFunction> &func,
                                                               const JSHandle<JSTaggedValue> &reason);
 
+    // Resume the async function or async generator of asyncCtxt with the outcome of an await.
+    static void ResumeFulfilled(JSThread *thread, const JSHandle<GeneratorContext> &asyncCtxt,
+                                const JSHandle<JSTaggedValue> &value);
+    static JSHandle<JSTaggedValue> ResumeRejected(JSThread *thread, const JSHandle<GeneratorContext> &asyncCtxt,
+                                                  const JSHandle<JSTaggedValue> &reason);
+
     static constexpr size_t ASYNC_CONTEXT_OFFSET = JSFunction::SIZE;
     ACCESSORS(AsyncContext, ASYNC_CONTEXT_OFFSET, SIZE);
 
@@ -52,11 +58,20 @@ public:
 
     static void AsyncFunctionAwait(JSThread *thread, const JSHandle<JSTaggedValue> &asyncFuncObj,
                                    const JSHandle<JSTaggedValue> &value);
+
+    // Runs the continuation queued by the await fast path, in place of the reaction job of onFulfilled or
+    // onRejected.
+    static void AsyncFunctionAwaitResume(JSThread *thread, const JSHandle<GeneratorContext> &asyncCtxt,
+                                         const JSHandle<JSTaggedValue> &value, bool isRejected);
     static constexpr size_t SIZE = JSFunction::SIZE;
 
     DECL_VISIT_OBJECT_FOR_JS_OBJECT(JSFunction, SIZE, SIZE)
 
     DECL_DUMP()
+
+private:
+    static bool TryAwaitFastPath(JSThread *thread, const JSHandle<JSTaggedValue> &asyncCtxt,
+                                 const JSHandle<JSTaggedValue> &value);
 };
 }  // namespace panda::ecmascript
 
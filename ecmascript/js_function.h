@@ -59,6 +59,20 @@ public:
         return IsCallNapiBit::Decode(bitField);
     }
 
+    // functions made by FunctionRef::NewFastCall, their native pointer is Callback::RegisterFastCallback
+    void SetFastNativeCall(bool isFastNativeCall)
+    {
+        uint32_t bitField = GetBitField();
+        uint32_t newValue = IsFastNativeCallBit::Update(bitField, isFastNativeCall);
+        SetBitField(newValue);
+    }
+
+    bool IsFastNativeCall() const
+    {
+        uint32_t bitField = GetBitField();
+        return IsFastNativeCallBit::Decode(bitField);
+    }
+
     FunctionKind GetFunctionKind(const JSThread *thread) const
     {
         JSTaggedValue method = GetMethod(thread);
@@ -189,6 +203,7 @@ public:
     using JitCompilingFlagBit = TaskConcurrentFuncFlagBit::NextFlag; // offset 3
     using BaselinejitCompilingFlagBit = JitCompilingFlagBit::NextFlag; // offset 4
     using IsCallNapiBit = BaselinejitCompilingFlagBit::NextFlag; // offset 5
+    using IsFastNativeCallBit = IsCallNapiBit::NextFlag; // offset 6
 
     static constexpr size_t METHOD_OFFSET = JSObject::SIZE;
     ACCESSORS(Method, METHOD_OFFSET, CODE_ENTRY_OFFSET)
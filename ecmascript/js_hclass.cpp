@@ -956,15 +956,19 @@ void JSHClass::VisitTransitionAndUpdateObjSize(const JSThread *thread, JSHClass
 }
 
 uint32_t JSHClass::VisitTransitionAndFindMaxNumOfProps(const JSThread *thread, JSHClass *ownHClass)
+{
+    return VisitTransitionAndFindMaxPropsHClass(thread, ownHClass)->NumberOfProps();
+}
+
+JSHClass *JSHClass::VisitTransitionAndFindMaxPropsHClass(const JSThread *thread, JSHClass *ownHClass)
 {
     std::queue<JSHClass *> backHClass;
     backHClass.push(ownHClass);
-    uint32_t maxNumOfProps = 0;
+    JSHClass *maxPropsHClass = ownHClass;
     while (!backHClass.empty()) {
         JSHClass *current = backHClass.front();
-        uint32_t numOfProps = current->NumberOfProps();
-        if (numOfProps > maxNumOfProps) {
-            maxNumOfProps = numOfProps;
+        if (current->NumberOfProps() > maxPropsHClass->NumberOfProps()) {
+            maxPropsHClass = current;
         }
         backHClass.pop();
 
@@ -982,7 +986,7 @@ uint32_t JSHClass::VisitTransitionAndFindMaxNumOfProps(const JSThread *thread, J
         TransitionsDictionary *dict = TransitionsDictionary::Cast(transitions.GetTaggedObject());
         dict->IterateEntryValue(thread, [&backHClass](JSHClass *cache) { backHClass.push(JSHClass::Cast(cache)); });
     }
-    return maxNumOfProps;
+    return maxPropsHClass;
 }
 
 TransitionResult JSHClass::ConvertOrTransitionWithRep(const JSThread *thread,
@@ -1015,6 +1019,11 @@ TransitionResult JSHClass::ConvertOrTransitionWithRep(const JSThread *thread,
         if (value->IsInt()) {
             int intValue = value->GetInt();
             return {false, false, JSTaggedValue(static_cast<JSTaggedType>(intValue))};
+        } else if (value->IsDouble() && attr.IsInlinedProps()) {
+            // every int is exact as a double, widen the field and keep it unboxed instead of going to tagged
+            attr.SetRepresentation(Representation::DOUBLE);
+            JSHClass::TransitionForRepChange(thread, receiver, key, attr);
+            return {false, true, JSTaggedValue(bit_cast<JSTaggedType>(value->GetDouble()))};
         } else {
             attr.SetRepresentation(Representation::TAGGED);
             JSHClass::TransitionForRepChange(thread, receiver, key, attr);
@@ -520,6 +520,8 @@ public:
     static void VisitTransitionAndUpdateObjSize(const JSThread *thread, JSHClass *ownHClass,
                                                 uint32_t finalInObjPropsNum);
     static uint32_t VisitTransitionAndFindMaxNumOfProps(const JSThread *thread, JSHClass *ownHClass);
+    // the hclass with the most properties among ownHClass and all hclasses reachable from it by transitions
+    static JSHClass *VisitTransitionAndFindMaxPropsHClass(const JSThread *thread, JSHClass *ownHClass);
 
     static void NotifyHClassNotPrototypeChanged(JSThread *thread, const JSHandle<JSHClass> &jsHClass);
     static void NotifyLeafHClassChanged(JSThread *thread, const JSHandle<JSHClass> &jsHClass);
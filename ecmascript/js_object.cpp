@@ -827,6 +827,92 @@ JSHandle<TaggedArray> JSObject::GetAllEnumKeys(JSThread *thread, const JSHandle<
     return keyArray;
 }
 
+JSHandle<TaggedArray> JSObject::GetOrCreateEnumKeysSnapshot(JSThread *thread, const JSHandle<JSHClass> &jsHclass,
+                                                            uint32_t numOfKeys)
+{
+    ASSERT(numOfKeys > 0 && !jsHclass.GetTaggedValue().IsInSharedHeap());
+    JSHandle<EnumCache> enumCache = GetOrCreateEnumCache(thread, jsHclass);
+    JSTaggedValue cacheOwn = enumCache->GetEnumCacheOwn(thread);
+    if (cacheOwn.IsCOWArray()) {
+        return JSHandle<TaggedArray>(thread, cacheOwn);
+    }
+    // The copy-on-write array is non-movable, so only a shape whose keys Object.keys hands out replaces its young
+    // cached keys with one. for-in and the other users of the cache keep the movable array.
+    JSHandle<TaggedArray> keyArray(thread->GetEcmaVM()->GetFactory()->NewCOWTaggedArray(numOfKeys));
+    uint32_t keys = 0;
+    int end = static_cast<int>(jsHclass->NumberOfProps());
+    LayoutInfo::Cast(jsHclass->GetLayout(thread).GetTaggedObject())->GetAllEnumKeys(thread, end, 0, keyArray, &keys);
+    enumCache->SetEnumCacheOwn(thread, keyArray.GetTaggedValue());
+    return keyArray;
+}
+
+bool JSObject::IsEnumKeysSnapshotable(const JSThread *thread, JSObject *obj)
+{
+    // other types of objects have keys which live outside of the layout, e.g. in their elements or in a target
+    JSHClass *hclass = obj->GetJSHClass();
+    if (hclass->GetObjectType() != JSType::JS_OBJECT || hclass->IsDictionaryMode() ||
+        JSTaggedValue(hclass).IsInSharedHeap()) {
+        return false;
+    }
+    return TaggedArray::Cast(obj->GetElements(thread).GetTaggedObject())->GetLength() == 0;
+}
+
+JSTaggedValue JSObject::GetEnumKeysSnapshot(JSThread *thread, const JSHandle<JSObject> &obj)
+{
+    if (!IsEnumKeysSnapshotable(thread, *obj)) {
+        return JSTaggedValue::Undefined();
+    }
+    uint32_t numOfKeys = obj->GetNumberOfEnumKeys(thread).first;
+    if (numOfKeys == 0) {
+        return thread->GlobalConstants()->GetEmptyArray();
+    }
+    JSHandle<JSHClass> jsHclass(thread, obj->GetJSHClass());
+    return GetOrCreateEnumKeysSnapshot(thread, jsHclass, numOfKeys).GetTaggedValue();
+}
+
+bool JSObject::TryCopyDataPropertiesWithSameHClass(JSThread *thread, const JSHandle<JSObject> &dst,
+                                                   const JSHandle<JSObject> &src)
+{
+    JSHClass *dstHClass = dst->GetJSHClass();
+    JSHClass *srcHClass = src->GetJSHClass();
+    if (dstHClass->GetObjectType() != JSType::JS_OBJECT || dstHClass->NumberOfProps() != 0 ||
+        dstHClass->IsDictionaryMode() || dstHClass->IsPrototype() || !dstHClass->IsExtensible() ||
+        TaggedArray::Cast(dst->GetProperties(thread).GetTaggedObject())->GetLength() != 0 ||
+        TaggedArray::Cast(dst->GetElements(thread).GetTaggedObject())->GetLength() != 0) {
+        return false;
+    }
+    if (!IsEnumKeysSnapshotable(thread, *src) || srcHClass->IsPrototype() || !srcHClass->IsExtensible() ||
+        srcHClass->GetObjectSize() != dstHClass->GetObjectSize() ||
+        srcHClass->GetPrototype(thread) != dstHClass->GetPrototype(thread)) {
+        return false;
+    }
+    // The copy has every property writable, enumerable and configurable, so the hclass of src describes it only if
+    // that holds for src as well.
+    int end = static_cast<int>(srcHClass->NumberOfProps());
+    LayoutInfo *layout = LayoutInfo::Cast(srcHClass->GetLayout(thread).GetTaggedObject());
+    for (int i = 0; i < end; i++) {
+        PropertyAttributes attr = layout->GetAttr(thread, i);
+        if (!attr.IsDefaultAttributes() || attr.IsAccessor() || !attr.IsTaggedRep() || attr.IsConstProps() ||
+            src->GetProperty(thread, srcHClass, attr).IsHole()) {
+            return false;
+        }
+    }
+    TaggedArray *srcProperties = TaggedArray::Cast(src->GetProperties(thread).GetTaggedObject());
+    if (srcProperties->GetLength() != 0) {
+        JSHandle<TaggedArray> properties(thread, srcProperties);
+        JSHandle<TaggedArray> newProperties =
+            thread->GetEcmaVM()->GetFactory()->CopyArray(properties, properties->GetLength(), properties->GetLength());
+        dst->SetProperties(thread, newProperties);
+    }
+    JSHClass *hclass = src->GetJSHClass();
+    uint32_t numOfInlinedProps = hclass->GetInlinedProperties();
+    for (uint32_t i = 0; i < numOfInlinedProps; i++) {
+        dst->SetPropertyInlinedProps(thread, hclass, i, src->GetPropertyInlinedProps(thread, hclass, i));
+    }
+    dst->SynchronizedTransitionClass(thread, hclass);
+    return true;
+}
+
 uint32_t JSObject::GetAllEnumKeys(JSThread *thread, const JSHandle<JSObject> &obj, int offset,
                                   const JSHandle<TaggedArray> &keyArray)
 {
@@ -2374,6 +2460,59 @@ void JSObject::EnumerableOwnPropertyNamesHelper(JSThread *thread, const JSHandle
     }
 }
 
+JSTaggedValue JSObject::EnumerableOwnValuesByLayout(JSThread *thread, const JSHandle<JSObject> &obj,
+                                                    PropertyKind kind)
+{
+    // The layout lists the keys in the order of the enum cache of the hclass and tells where each value lives, so it
+    // serves as the index of the values without a lookup per key.
+    if (kind == PropertyKind::KEY || !IsEnumKeysSnapshotable(thread, *obj)) {
+        return JSTaggedValue::Undefined();
+    }
+    JSHandle<JSHClass> jsHclass(thread, obj->GetJSHClass());
+    int end = static_cast<int>(jsHclass->NumberOfProps());
+    uint32_t numOfValues = 0;
+    {
+        DISALLOW_GARBAGE_COLLECTION;
+        LayoutInfo *layout = LayoutInfo::Cast(jsHclass->GetLayout(thread).GetTaggedObject());
+        for (int i = 0; i < end; i++) {
+            PropertyAttributes attr = layout->GetAttr(thread, i);
+            if (!layout->GetKey(thread, i).IsString() || !attr.IsEnumerable()) {
+                continue;
+            }
+            // a getter may change the object under us
+            if (attr.IsAccessor()) {
+                return JSTaggedValue::Undefined();
+            }
+            numOfValues++;
+        }
+    }
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    if (numOfValues == 0) {
+        return factory->EmptyArray().GetTaggedValue();
+    }
+    JSHandle<TaggedArray> properties = factory->NewTaggedArray(numOfValues);
+    JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> value(thread, JSTaggedValue::Undefined());
+    uint32_t index = 0;
+    for (int i = 0; i < end; i++) {
+        LayoutInfo *layout = LayoutInfo::Cast(jsHclass->GetLayout(thread).GetTaggedObject());
+        PropertyAttributes attr = layout->GetAttr(thread, i);
+        key.Update(layout->GetKey(thread, i));
+        if (!key->IsString() || !attr.IsEnumerable()) {
+            continue;
+        }
+        value.Update(obj->GetProperty(thread, *jsHclass, attr));
+        if (value->IsHole()) {
+            continue;
+        }
+        index = SetValuesOrEntries(thread, properties, index, key, value, kind);
+    }
+    if (UNLIKELY(index < numOfValues)) {
+        properties->Trim(thread, index);
+    }
+    return properties.GetTaggedValue();
+}
+
 JSHandle<TaggedArray> JSObject::EnumerableOwnPropertyNames(JSThread *thread, const JSHandle<JSObject> &obj,
                                                            PropertyKind kind)
 {
@@ -2384,6 +2523,10 @@ JSHandle<TaggedArray> JSObject::EnumerableOwnPropertyNames(JSThread *thread, con
     JSHandle<JSTaggedValue> tagObj(obj);
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
     if (tagObj->IsJSObject() && !tagObj->IsJSProxy() && !tagObj->IsTypedArray() && !tagObj->IsModuleNamespace()) {
+        JSTaggedValue values = EnumerableOwnValuesByLayout(thread, obj, kind);
+        if (!values.IsUndefined()) {
+            return JSHandle<TaggedArray>(thread, values);
+        }
         uint32_t copyLengthOfKeys = 0;
         uint32_t copyLengthOfElements = 0;
         uint32_t index = 0;
@@ -716,6 +716,12 @@ public:
                                                 uint32_t numOfKeys, uint32_t *keys);
     static uint32_t GetAllEnumKeys(JSThread *thread, const JSHandle<JSObject> &obj, int offset,
                                    const JSHandle<TaggedArray> &keyArray);
+    // The copy-on-write array of the enumerable own keys, which all objects of the hclass of obj share. Undefined if
+    // obj may have keys which its hclass does not describe. For Object.keys, which hands the array out, only.
+    static JSTaggedValue GetEnumKeysSnapshot(JSThread *thread, const JSHandle<JSObject> &obj);
+    // {...src} into the fresh empty object dst by giving dst the hclass of src, false if src does not allow it.
+    static bool TryCopyDataPropertiesWithSameHClass(JSThread *thread, const JSHandle<JSObject> &dst,
+                                                    const JSHandle<JSObject> &src);
 
     static void AddAccessor(JSThread *thread, const JSHandle<JSTaggedValue> &obj, const JSHandle<JSTaggedValue> &key,
                             const JSHandle<AccessorData> &value, PropertyAttributes attr);
@@ -869,6 +875,11 @@ private:
     static std::pair<JSHandle<TaggedArray>, JSHandle<TaggedArray>> GetOwnEnumerableNamesInFastMode(
         JSThread *thread, const JSHandle<JSObject> &obj, uint32_t *copyLengthOfKeys, uint32_t *copyLengthOfElements);
     static bool CheckHClassHit(const JSHandle<JSObject> &obj, const JSHandle<JSHClass> &cls);
+    static bool IsEnumKeysSnapshotable(const JSThread *thread, JSObject *obj);
+    static JSHandle<TaggedArray> GetOrCreateEnumKeysSnapshot(JSThread *thread, const JSHandle<JSHClass> &jsHclass,
+                                                             uint32_t numOfKeys);
+    static JSTaggedValue EnumerableOwnValuesByLayout(JSThread *thread, const JSHandle<JSObject> &obj,
+                                                     PropertyKind kind);
     static uint32_t SetValuesOrEntries(JSThread *thread, const JSHandle<TaggedArray> &prop, uint32_t index,
                                        const JSHandle<JSTaggedValue> &key, const JSHandle<JSTaggedValue> &value,
                                        PropertyKind kind);
@@ -19,6 +19,7 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter.h"
 #include "ecmascript/jobs/micro_job_queue.h"
+#include "ecmascript/layout_info.h"
 
 namespace panda::ecmascript {
 using BuiltinsPromiseHandler = builtins::BuiltinsPromiseHandler;
@@ -146,6 +147,37 @@ bool JSPromise::IsPromise(const JSHandle<JSTaggedValue> &value)
     return true;
 }
 
+bool JSPromise::IsUnmodifiedNativePromise(const JSThread *thread, JSTaggedValue value)
+{
+    if (!value.IsJSPromise()) {
+        return false;
+    }
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSTaggedValue promiseFunc = env->GetPromiseFunction().GetTaggedValue();
+    JSTaggedValue instanceClass = JSFunction::Cast(promiseFunc.GetTaggedObject())->GetProtoOrHClass(thread);
+    if (!instanceClass.IsJSHClass() || value.GetTaggedObject()->GetClass() != instanceClass.GetTaggedObject()) {
+        return false;
+    }
+    JSTaggedValue proto = JSHClass::Cast(instanceClass.GetTaggedObject())->GetPrototype(thread);
+    if (!proto.IsECMAObject()) {
+        return false;
+    }
+    JSHClass *protoClass = proto.GetTaggedObject()->GetClass();
+    if (protoClass->IsDictionaryMode()) {
+        return false;
+    }
+    int entry = JSHClass::FindPropertyEntry(thread, protoClass, thread->GlobalConstants()->GetConstructorString());
+    if (entry == -1) {
+        return false;
+    }
+    LayoutInfo *layout = LayoutInfo::Cast(protoClass->GetLayout(thread).GetTaggedObject());
+    PropertyAttributes attr = layout->GetAttr(thread, entry);
+    if (attr.IsAccessor()) {
+        return false;
+    }
+    return JSObject::Cast(proto.GetTaggedObject())->GetProperty(thread, protoClass, attr) == promiseFunc;
+}
+
 JSTaggedValue JSPromise::RejectPromise(JSThread *thread, const JSHandle<JSPromise> &promise,
                                        const JSHandle<JSTaggedValue> &reason)
 {
@@ -179,18 +211,9 @@ JSTaggedValue JSPromise::TriggerPromiseReactions(JSThread *thread, const JSHandl
 {
     // 1. Repeat for each reaction in reactions, in original insertion order
     // a. Perform EnqueueJob("PromiseJobs", PromiseReactionJob, «reaction, argument»).
-    JSHandle<job::MicroJobQueue> job = thread->GetEcmaVM()->GetMicroJobQueue();
-    JSHandle<GlobalEnv> globalEnv = thread->GetEcmaVM()->GetGlobalEnv();
     const GlobalEnvConstants *globalConst = thread->GlobalConstants();
-    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-    JSHandle<JSFunction> promiseReactionsJob(globalEnv->GetPromiseReactionJob());
-    JSMutableHandle<PromiseReaction> reaction(thread, JSTaggedValue::Undefined());
     while (!reactions->Empty(thread)) {
-        reaction.Update(reactions->Pop(thread));
-        JSHandle<TaggedArray> arguments = factory->NewTaggedArray(2);  // 2 means the length of new array
-        arguments->Set(thread, 0, reaction);
-        arguments->Set(thread, 1, argument);
-        job::MicroJobQueue::EnqueueJob(thread, job, job::QueueType::QUEUE_PROMISE, promiseReactionsJob, arguments);
+        job::MicroJobQueue::EnqueuePromiseReactionJob(thread, reactions->Pop(thread), argument.GetTaggedValue());
     }
     // 2. Return undefined.
     return globalConst->GetUndefined();
@@ -124,6 +124,11 @@ public:
     // ES6 24.4.1.6 IsPromise (x)
     static bool IsPromise(const JSHandle<JSTaggedValue> &value);
 
+    // Whether PromiseResolve(%Promise%, value) returns value itself without running user code: value is a promise
+    // of the initial instance hclass, so it has no own "constructor", and Promise.prototype.constructor is still a
+    // data property holding %Promise%.
+    static bool IsUnmodifiedNativePromise(const JSThread *thread, JSTaggedValue value);
+
     // ES6 25.4.1.7 RejectPromise (promise, reason)
     static JSTaggedValue RejectPromise(JSThread *thread, const JSHandle<JSPromise> &promise,
                                        const JSHandle<JSTaggedValue> &reason);
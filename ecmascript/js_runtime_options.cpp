@@ -120,6 +120,17 @@ const std::string PUBLIC_API HELP_OPTION_MSG =
     "--framework-abc-file:                 Snapshot file. Default: 'strip.native.min.abc'\n"
     "--gc-long-paused-time:                Set gc's longPauseTime in millisecond. Default: '40'\n"
     "--gc-thread-num:                      Set gc thread number. Default: '7'\n"
+    "--gc-numa-aware:                      Pin all threads of the shared taskpool, which also run non-gc background\n"
+    "                                      tasks, to the cpus of the NUMA node of the first vm that enables it,\n"
+    "                                      and prefer node-local heap regions. Default: 'false'\n"
+    "--enable-heap-huge-page:              Back regular heap regions with 2MB transparent huge pages, pre-fault\n"
+    "                                      young generation regions after gc and record page-fault and dTLB-miss\n"
+    "                                      counters in gc stats. Default: 'false'\n"
+    "--heap-verify-parallel:               Split heap verification by regions across gc threads. Default: 'false'\n"
+    "--heap-verify-sample-rate:            Percentage of heap regions checked by each heap verification, the\n"
+    "                                      selection changes from gc to gc. Range: 1-100. Default: '100'\n"
+    "--heap-verify-concurrent:             Verify objects surviving a gc on a background thread after the pause\n"
+    "                                      instead of inside it. Default: 'false'\n"
     "--icu-data-path:                      Path to generated icu data file. Default: 'default'\n"
     "--enable-worker:                      Whether is worker vm. Default: 'false'\n"
     "--log-level:                          Log level: ['debug', 'info', 'warning', 'error', 'fatal'].\n"
@@ -242,6 +253,24 @@ const std::string PUBLIC_API HELP_OPTION_MSG =
     "                                      Default: 'method_compiled_by_jit.cfg'\n"
     "--compiler-enable-merge-poly:         Enable poly-merge optimization for ldobjbyname. Default: 'true'\n"
     "--enable-pgo-napi:                    Enable pgo napi. Default: 'false'\n"
+    "--compiler-jit-code-cache-path:       Directory of the persistent baseline jit code cache, the cache is\n"
+    "                                      disabled when empty. Default: ''\n"
+    "--compiler-opt-allocation-folding:    Enable folding of adjacent young space allocations into one allocation\n"
+    "                                      for aot and jit compiler. Default: 'false'\n"
+    "--compiler-opt-loop-unrolling:        Enable unrolling of counted loops over typed arrays, and the llvm loop and\n"
+    "                                      slp vectorizers, for aot and jit compiler. Default: 'false'\n"
+    "--compiler-max-inline-poly-targets:   Set max call targets which a polymorphic call site can be inlined with,\n"
+    "                                      values below 2 disable polymorphic inlining. Default: '4'\n"
+    "--compiler-codegen-threads:           Number of threads running llvm optimization and code generation of aot\n"
+    "                                      modules, 1 keeps them on the compiling thread. Default: '1'\n"
+    "--compiler-incremental-aot:           Take over the code of abc files whose bytecode and profile are unchanged\n"
+    "                                      from the an file of the last incremental compilation. Default: 'false'\n"
+    "--compiler-opt-code-layout:           Compile the methods of every abc file sorted by their profiled hit count,\n"
+    "                                      methods without a profile go to modules of their own. Default: 'false'\n"
+    "--enable-aot-lazy-load:               Relocate the func entries of an an file module by module when a method of\n"
+    "                                      the module is bound for the first time, not all at load. Default: 'false'\n"
+    "--enable-ic-profiler:                 Record the state transitions, receiver hclasses and misses of the property\n"
+    "                                      access ics, logged ranked by function when the vm exits. Default: 'false'\n"
     // Please add new options above this line line after help message.
     "\n";
 
@@ -312,6 +341,11 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
         {"force-shared-gc-frequency", required_argument, nullptr, OPTION_ENABLE_FORCE_SHARED_GC_FREQUENCY},
         {"enable-heap-verify", required_argument, nullptr, OPTION_ENABLE_HEAP_VERIFY},
         {"gc-thread-num", required_argument, nullptr, OPTION_GC_THREADNUM},
+        {"gc-numa-aware", required_argument, nullptr, OPTION_GC_NUMA_AWARE},
+        {"enable-heap-huge-page", required_argument, nullptr, OPTION_ENABLE_HEAP_HUGE_PAGE},
+        {"heap-verify-parallel", required_argument, nullptr, OPTION_HEAP_VERIFY_PARALLEL},
+        {"heap-verify-sample-rate", required_argument, nullptr, OPTION_HEAP_VERIFY_SAMPLE_RATE},
+        {"heap-verify-concurrent", required_argument, nullptr, OPTION_HEAP_VERIFY_CONCURRENT},
         {"icu-data-path", required_argument, nullptr, OPTION_ICU_DATA_PATH},
         {"enable-worker", required_argument, nullptr, OPTION_ENABLE_WORKER},
         {"log-components", required_argument, nullptr, OPTION_LOG_COMPONENTS},
@@ -424,6 +458,15 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
         {"mem-config", required_argument, nullptr, OPTION_MEM_CONFIG},
         {"multi-context", required_argument, nullptr, OPTION_MULTI_CONTEXT},
         {"enable-pgo-napi", required_argument, nullptr, OPTION_PGO_NAPI},
+        {"compiler-jit-code-cache-path", required_argument, nullptr, OPTION_COMPILER_JIT_CODE_CACHE_PATH},
+        {"compiler-opt-allocation-folding", required_argument, nullptr, OPTION_COMPILER_OPT_ALLOCATION_FOLDING},
+        {"compiler-opt-loop-unrolling", required_argument, nullptr, OPTION_COMPILER_OPT_LOOP_UNROLLING},
+        {"compiler-max-inline-poly-targets", required_argument, nullptr, OPTION_COMPILER_MAX_INLINE_POLY_TARGETS},
+        {"compiler-codegen-threads", required_argument, nullptr, OPTION_COMPILER_CODEGEN_THREADS},
+        {"compiler-incremental-aot", required_argument, nullptr, OPTION_COMPILER_INCREMENTAL_AOT},
+        {"compiler-opt-code-layout", required_argument, nullptr, OPTION_COMPILER_OPT_CODE_LAYOUT},
+        {"enable-aot-lazy-load", required_argument, nullptr, OPTION_ENABLE_AOT_LAZY_LOAD},
+        {"enable-ic-profiler", required_argument, nullptr, OPTION_ENABLE_IC_PROFILER},
         {nullptr, 0, nullptr, 0},
     };
 
@@ -781,6 +824,46 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
                     return false;
                 }
                 break;
+            case OPTION_GC_NUMA_AWARE:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableGCNumaAware(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_ENABLE_HEAP_HUGE_PAGE:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableHeapHugePage(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_HEAP_VERIFY_PARALLEL:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetHeapVerifyParallel(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_HEAP_VERIFY_SAMPLE_RATE:
+                ret = ParseUint32Param("heap-verify-sample-rate", &argUint32);
+                if (ret) {
+                    SetHeapVerifySampleRate(argUint32);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_HEAP_VERIFY_CONCURRENT:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetHeapVerifyConcurrent(argBool);
+                } else {
+                    return false;
+                }
+                break;
             case OPTION_HELP:
                 return false;
             case OPTION_ICU_DATA_PATH:
@@ -1676,6 +1759,73 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
                     return false;
                 }
                 break;
+            case OPTION_COMPILER_JIT_CODE_CACHE_PATH:
+                SetJitCodeCachePath(optarg);
+                break;
+            case OPTION_COMPILER_OPT_ALLOCATION_FOLDING:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableAllocationFolding(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_COMPILER_OPT_LOOP_UNROLLING:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableOptLoopUnrolling(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_COMPILER_MAX_INLINE_POLY_TARGETS:
+                ret = ParseUint32Param("max-inline-poly-targets", &argUint32);
+                if (ret) {
+                    SetMaxInlinePolyTargets(argUint32);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_COMPILER_CODEGEN_THREADS:
+                ret = ParseUint32Param("compiler-codegen-threads", &argUint32);
+                if (ret) {
+                    SetCompilerCodegenThreads(argUint32);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_COMPILER_INCREMENTAL_AOT:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetCompilerIncrementalAot(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_COMPILER_OPT_CODE_LAYOUT:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableOptCodeLayout(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_ENABLE_AOT_LAZY_LOAD:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableAotLazyLoad(argBool);
+                } else {
+                    return false;
+                }
+                break;
+            case OPTION_ENABLE_IC_PROFILER:
+                ret = ParseBoolParam(&argBool);
+                if (ret) {
+                    SetEnableICProfiler(argBool);
+                } else {
+                    return false;
+                }
+                break;
             default:
                 LOG_ECMA(ERROR) << "Invalid option\n";
                 return false;
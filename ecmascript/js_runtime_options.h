@@ -16,6 +16,7 @@
 #ifndef ECMASCRIPT_JS_RUNTIME_OPTIONS_H_
 #define ECMASCRIPT_JS_RUNTIME_OPTIONS_H_
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -115,6 +116,11 @@ enum CommandValues {
     OPTION_ARK_PROPERTIES,
     OPTION_ARK_BUNDLENAME,
     OPTION_GC_THREADNUM,
+    OPTION_GC_NUMA_AWARE,
+    OPTION_ENABLE_HEAP_HUGE_PAGE,
+    OPTION_HEAP_VERIFY_PARALLEL,
+    OPTION_HEAP_VERIFY_SAMPLE_RATE,
+    OPTION_HEAP_VERIFY_CONCURRENT,
     OPTION_GC_LONG_PAUSED_TIME,
     OPTION_AOT_FILE,
     OPTION_COMPILER_TARGET_TRIPLE,
@@ -271,6 +277,15 @@ enum CommandValues {
     OPTION_MEM_CONFIG,
     OPTION_MULTI_CONTEXT,
     OPTION_PGO_NAPI,
+    OPTION_COMPILER_JIT_CODE_CACHE_PATH,
+    OPTION_COMPILER_OPT_ALLOCATION_FOLDING,
+    OPTION_COMPILER_OPT_LOOP_UNROLLING,
+    OPTION_COMPILER_MAX_INLINE_POLY_TARGETS,
+    OPTION_COMPILER_CODEGEN_THREADS,
+    OPTION_COMPILER_INCREMENTAL_AOT,
+    OPTION_COMPILER_OPT_CODE_LAYOUT,
+    OPTION_ENABLE_AOT_LAZY_LOAD,
+    OPTION_ENABLE_IC_PROFILER,
 
     // .an file descriptor passed from compiler_service via Binder
     OPTION_AN_FD,
@@ -562,6 +577,56 @@ public:
         return gcThreadNum_;
     }
 
+    void SetEnableGCNumaAware(bool value)
+    {
+        enableGCNumaAware_ = value;
+    }
+
+    bool EnableGCNumaAware() const
+    {
+        return enableGCNumaAware_;
+    }
+
+    void SetEnableHeapHugePage(bool value)
+    {
+        enableHeapHugePage_ = value;
+    }
+
+    bool EnableHeapHugePage() const
+    {
+        return enableHeapHugePage_;
+    }
+
+    void SetHeapVerifyParallel(bool value)
+    {
+        heapVerifyParallel_ = value;
+    }
+
+    bool IsHeapVerifyParallel() const
+    {
+        return heapVerifyParallel_;
+    }
+
+    void SetHeapVerifySampleRate(uint32_t rate)
+    {
+        heapVerifySampleRate_ = std::clamp(rate, 1U, MAX_HEAP_VERIFY_SAMPLE_RATE);
+    }
+
+    uint32_t GetHeapVerifySampleRate() const
+    {
+        return heapVerifySampleRate_;
+    }
+
+    void SetHeapVerifyConcurrent(bool value)
+    {
+        heapVerifyConcurrent_ = value;
+    }
+
+    bool IsHeapVerifyConcurrent() const
+    {
+        return heapVerifyConcurrent_;
+    }
+
     void SetLongPauseTime(size_t time)
     {
         longPauseTime_ = time;
@@ -1661,6 +1726,26 @@ public:
         compilerModuleMethods_ = compilerModuleMethods;
     }
 
+    uint32_t GetCompilerCodegenThreads() const
+    {
+        return compilerCodegenThreads_;
+    }
+
+    void SetCompilerCodegenThreads(uint32_t compilerCodegenThreads)
+    {
+        compilerCodegenThreads_ = compilerCodegenThreads;
+    }
+
+    bool IsCompilerIncrementalAot() const
+    {
+        return compilerIncrementalAot_;
+    }
+
+    void SetCompilerIncrementalAot(bool value)
+    {
+        compilerIncrementalAot_ = value;
+    }
+
     void SetTraceDeopt(bool value)
     {
         traceDeopt_ = value;
@@ -1871,6 +1956,16 @@ public:
         return maxInlineCount_;
     }
 
+    void SetMaxInlinePolyTargets(size_t value)
+    {
+        maxInlinePolyTargets_ = value;
+    }
+
+    size_t GetMaxInlinePolyTargets() const
+    {
+        return maxInlinePolyTargets_;
+    }
+
     void SetMaxInlineSizeLarge(size_t value)
     {
         maxInlineSizeLarge_ = value;
@@ -2452,6 +2547,71 @@ public:
         return jitMethodPath_;
     }
 
+    void SetJitCodeCachePath(const std::string &jitCodeCachePath)
+    {
+        jitCodeCachePath_ = jitCodeCachePath;
+    }
+
+    std::string GetJitCodeCachePath() const
+    {
+        return jitCodeCachePath_;
+    }
+
+    bool IsEnableJitCodeCache() const
+    {
+        return !jitCodeCachePath_.empty();
+    }
+
+    void SetEnableAllocationFolding(bool value)
+    {
+        enableAllocationFolding_ = value;
+    }
+
+    bool IsEnableAllocationFolding() const
+    {
+        return enableAllocationFolding_;
+    }
+
+    void SetEnableOptLoopUnrolling(bool value)
+    {
+        enableOptLoopUnrolling_ = value;
+    }
+
+    bool IsEnableOptLoopUnrolling() const
+    {
+        return enableOptLoopUnrolling_;
+    }
+
+    void SetEnableOptCodeLayout(bool value)
+    {
+        enableOptCodeLayout_ = value;
+    }
+
+    bool IsEnableOptCodeLayout() const
+    {
+        return enableOptCodeLayout_;
+    }
+
+    void SetEnableAotLazyLoad(bool value)
+    {
+        enableAotLazyLoad_ = value;
+    }
+
+    bool IsEnableAotLazyLoad() const
+    {
+        return enableAotLazyLoad_;
+    }
+
+    void SetEnableICProfiler(bool value)
+    {
+        enableICProfiler_ = value;
+    }
+
+    bool IsEnableICProfiler() const
+    {
+        return enableICProfiler_;
+    }
+
     void SetEnableMergePoly(bool value)
     {
         enableMergePoly_ = value;
@@ -2685,6 +2845,12 @@ private:
     bool pgoNapi_ {false};
     std::set<CString> traceBundleName_ = {};
     uint32_t gcThreadNum_ {7}; // 7: default thread num
+    bool enableGCNumaAware_ {false};
+    bool enableHeapHugePage_ {false};
+    static constexpr uint32_t MAX_HEAP_VERIFY_SAMPLE_RATE = 100;
+    bool heapVerifyParallel_ {false};
+    uint32_t heapVerifySampleRate_ {MAX_HEAP_VERIFY_SAMPLE_RATE};
+    bool heapVerifyConcurrent_ {false};
     uint32_t longPauseTime_ {40}; // 40: default pause time
     std::string aotOutputFile_ {""};
     std::string targetTriple_ {TARGET_X64};
@@ -2757,6 +2923,8 @@ private:
     bool forceBaselineCompileMain_ {false};
     bool enableOptTrackField_ {true};
     uint32_t compilerModuleMethods_ {100};
+    uint32_t compilerCodegenThreads_ {1};
+    bool compilerIncrementalAot_ {false};
     bool enableContext_ {false};
     bool enablePrintExecuteTime_ {false};
     bool enablePGOProfiler_ {false};
@@ -2788,6 +2956,7 @@ private:
     size_t maxInlineDepthSmall_ {3};
     size_t maxInlineDepthLarge_ {1};
     size_t maxInlineCount_ {6};
+    size_t maxInlinePolyTargets_ {4};
     size_t maxInlineSizeLarge_ {45};
     std::string targetCompilerMode_ {""};
     std::string frameworkAbcPath_ {""};
@@ -2848,6 +3017,12 @@ private:
     bool multiContext_ {false};
     std::string jitMethodDichotomy_ {"disable"};
     std::string jitMethodPath_ {"method_compiled_by_jit.cfg"};
+    std::string jitCodeCachePath_ {};
+    bool enableAllocationFolding_ {false};
+    bool enableOptLoopUnrolling_ {false};
+    bool enableOptCodeLayout_ {false};
+    bool enableAotLazyLoad_ {false};
+    bool enableICProfiler_ {false};
     size_t heapSize_ = {0};
     common::RuntimeParam param_;
     bool enableWarmStartupSmartGC_ {false};
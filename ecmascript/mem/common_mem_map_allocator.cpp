@@ -74,6 +74,29 @@ void MemMapAllocator::AsyncFree(void *mem, size_t size, bool isRegular, bool isC
     ReleaseMemory(mem, size, isRegular, isCompress);
 }
 
+size_t MemMapAllocator::PrefaultCommittedCache(size_t cachedSize)
+{
+    size_t prefaultSize = 0;
+    while (!memMapPool_.IsRegularCommittedFull(cachedSize)) {
+        if (memMapTotalSize_ + DEFAULT_REGION_SIZE > capacity_) {
+            break;
+        }
+        MemMap mem = memMapPool_.GetMemFromCache(DEFAULT_REGION_SIZE);
+        if (mem.GetMem() == nullptr) {
+            break;
+        }
+        if (PageProtect(mem.GetMem(), mem.GetSize(), PAGE_PROT_READWRITE) != 0) { // LCOV_EXCL_BR_LINE
+            memMapPool_.AddMemToCache(mem.GetMem(), mem.GetSize());
+            break;
+        }
+        PagePreFault(mem.GetMem(), mem.GetSize());
+        IncreaseMemMapTotalSize(mem.GetSize());
+        memMapPool_.AddMemToCommittedCache(mem.GetMem(), mem.GetSize());
+        prefaultSize += mem.GetSize();
+    }
+    return prefaultSize;
+}
+
 void MemMapAllocator::Free(void *mem, size_t size, bool isRegular, bool isCompress)
 {
     DecreaseMemMapTotalSize(size);
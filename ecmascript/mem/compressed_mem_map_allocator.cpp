@@ -24,6 +24,7 @@ namespace panda::ecmascript {
 void MemMapAllocator::InitializeRegularRegionMapForCompressedPointer(size_t capacity, void *addr)
 {
     MemMap mem(addr, capacity);
+    AdviseRegularPool(mem);
     memMapPool_.InsertMemMap(mem);
     memMapPool_.SplitMemMapToCache(mem);
 }
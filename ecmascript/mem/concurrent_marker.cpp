@@ -110,6 +110,7 @@ void ConcurrentMarker::Mark()
         + ";NativeBindingSize" + std::to_string(heap_->GetNativeBindingSize())
         + ";NativeLimitSize" + std::to_string(heap_->GetGlobalSpaceNativeLimit())).c_str(), "");
     MEM_ALLOCATE_AND_GC_TRACE(vm_, ConcurrentMarking);
+    heap_->WaitConcurrentVerifyFinished();
     ASSERT(runningTaskCount_ == 0);
     runningTaskCount_.fetch_add(1, std::memory_order_relaxed);
     InitializeMarking();
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/external_memory_tracker.h"
+
+#include "ecmascript/mem/slots.h"
+
+namespace panda::ecmascript {
+bool ExternalMemoryTracker::Register(TaggedObject *object, size_t externalSize, size_t retainedSize,
+                                     const CString &module)
+{
+    ASSERT(object != nullptr);
+    uintptr_t key = ToUintPtr(object);
+    auto iter = index_.find(key);
+    if (externalSize == 0 && retainedSize == 0) {
+        if (iter != index_.end()) {
+            RemoveAt(iter->second);
+        }
+        return true;
+    }
+    uint32_t moduleId = module.empty() ? INVALID_MODULE : GetOrCreateModule(module);
+    if (iter != index_.end()) {
+        Entry &entry = entries_[iter->second];
+        Release(entry);
+        entry.externalSize = externalSize;
+        entry.retainedSize = retainedSize;
+        entry.module = moduleId;
+        Charge(entry);
+    } else {
+        Entry entry {JSTaggedValue(object), externalSize, retainedSize, moduleId};
+        Charge(entry);
+        index_.emplace(key, entries_.size());
+        entries_.emplace_back(entry);
+    }
+    if (moduleId == INVALID_MODULE) {
+        return true;
+    }
+    const ModuleInfo &info = modules_[moduleId];
+    return info.budget == 0 || info.size <= info.budget;
+}
+
+void ExternalMemoryTracker::Unregister(TaggedObject *object)
+{
+    auto iter = index_.find(ToUintPtr(object));
+    if (iter != index_.end()) {
+        RemoveAt(iter->second);
+    }
+}
+
+void ExternalMemoryTracker::SetModuleBudget(const CString &module, size_t budget)
+{
+    if (module.empty()) {
+        return;
+    }
+    modules_[GetOrCreateModule(module)].budget = budget;
+}
+
+size_t ExternalMemoryTracker::GetModuleSize(const CString &module) const
+{
+    uint32_t moduleId = FindModule(module);
+    return moduleId == INVALID_MODULE ? 0 : modules_[moduleId].size;
+}
+
+bool ExternalMemoryTracker::IsModuleOverBudget(const CString &module) const
+{
+    uint32_t moduleId = FindModule(module);
+    if (moduleId == INVALID_MODULE) {
+        return false;
+    }
+    const ModuleInfo &info = modules_[moduleId];
+    return info.budget != 0 && info.size > info.budget;
+}
+
+size_t ExternalMemoryTracker::GetExternalSize(TaggedObject *object) const
+{
+    auto iter = index_.find(ToUintPtr(object));
+    if (iter == index_.end()) {
+        return 0;
+    }
+    return entries_[iter->second].externalSize;
+}
+
+void ExternalMemoryTracker::ProcessReferences(const WeakRootVisitor &visitor)
+{
+    if (entries_.empty()) {
+        return;
+    }
+    bool moved = false;
+    size_t i = 0;
+    while (i < entries_.size()) {
+        Entry &entry = entries_[i];
+        TaggedObject *object = entry.object.GetTaggedObject();
+        TaggedObject *fwd = visitor(object);
+        if (fwd == nullptr) {
+            Release(entry);
+            entries_[i] = entries_.back();
+            entries_.pop_back();
+            moved = true;
+            continue;
+        }
+        if (fwd != object) {
+            entry.object = JSTaggedValue(fwd);
+            moved = true;
+        }
+        ++i;
+    }
+    if (moved) {
+        RebuildIndex();
+    }
+}
+
+void ExternalMemoryTracker::IteratorReferences(WeakVisitor &visitor)
+{
+    if (entries_.empty()) {
+        return;
+    }
+    size_t i = 0;
+    while (i < entries_.size()) {
+        Entry &entry = entries_[i];
+        ObjectSlot slot(reinterpret_cast<uintptr_t>(&entry.object));
+        if (!visitor.VisitRoot(Root::ROOT_VM, slot)) {
+            Release(entry);
+            entries_[i] = entries_.back();
+            entries_.pop_back();
+            continue;
+        }
+        ++i;
+    }
+    RebuildIndex();
+}
+
+double ExternalMemoryTracker::SampleGrowthRate(double timeMs)
+{
+    if (lastSampleTimeMs_ > 0 && timeMs > lastSampleTimeMs_) {
+        lastGCIntervalMs_ = timeMs - lastSampleTimeMs_;
+        growthRate_ = accountedSize_ > lastSampledSize_ ?
+            static_cast<double>(accountedSize_ - lastSampledSize_) / lastGCIntervalMs_ : 0;
+    }
+    lastSampledSize_ = accountedSize_;
+    lastSampleTimeMs_ = timeMs;
+    return growthRate_;
+}
+
+size_t ExternalMemoryTracker::AdjustHeadroom(size_t headroom) const
+{
+    if (headroom == 0 || growthRate_ <= 0 || lastGCIntervalMs_ <= 0) {
+        return headroom;
+    }
+    // The heap and the native side grow in the same gc cycle, so split the cycle between them in proportion to
+    // what each side is expected to allocate.
+    double expectedGrowth = growthRate_ * lastGCIntervalMs_;
+    double factor = static_cast<double>(headroom) / (static_cast<double>(headroom) + expectedGrowth);
+    constexpr double MIN_HEADROOM_FACTOR = 0.5;
+    factor = std::max(factor, MIN_HEADROOM_FACTOR);
+    return static_cast<size_t>(static_cast<double>(headroom) * factor);
+}
+
+uint32_t ExternalMemoryTracker::GetOrCreateModule(const CString &module)
+{
+    uint32_t moduleId = FindModule(module);
+    if (moduleId != INVALID_MODULE) {
+        return moduleId;
+    }
+    modules_.emplace_back(ModuleInfo {module, 0, 0});
+    return static_cast<uint32_t>(modules_.size() - 1);
+}
+
+uint32_t ExternalMemoryTracker::FindModule(const CString &module) const
+{
+    // Only a handful of native modules report external memory, a linear scan is cheaper than hashing names.
+    for (size_t i = 0; i < modules_.size(); i++) {
+        if (modules_[i].name == module) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    return INVALID_MODULE;
+}
+
+void ExternalMemoryTracker::Charge(const Entry &entry)
+{
+    size_t size = entry.AccountedSize();
+    accountedSize_ += size;
+    if (entry.module != INVALID_MODULE) {
+        modules_[entry.module].size += size;
+    }
+}
+
+void ExternalMemoryTracker::Release(const Entry &entry)
+{
+    size_t size = entry.AccountedSize();
+    ASSERT(size <= accountedSize_);
+    accountedSize_ -= size;
+    if (entry.module != INVALID_MODULE) {
+        ASSERT(size <= modules_[entry.module].size);
+        modules_[entry.module].size -= size;
+    }
+}
+
+void ExternalMemoryTracker::RemoveAt(size_t index)
+{
+    ASSERT(index < entries_.size());
+    Release(entries_[index]);
+    index_.erase(ToUintPtr(entries_[index].object.GetTaggedObject()));
+    if (index != entries_.size() - 1) {
+        entries_[index] = entries_.back();
+        index_[ToUintPtr(entries_[index].object.GetTaggedObject())] = index;
+    }
+    entries_.pop_back();
+}
+
+void ExternalMemoryTracker::RebuildIndex()
+{
+    index_.clear();
+    for (size_t i = 0; i < entries_.size(); i++) {
+        index_.emplace(ToUintPtr(entries_[i].object.GetTaggedObject()), i);
+    }
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_EXTERNAL_MEMORY_TRACKER_H
+#define ECMASCRIPT_MEM_EXTERNAL_MEMORY_TRACKER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/c_containers.h"
+#include "ecmascript/mem/c_string.h"
+#include "ecmascript/mem/visitor.h"
+
+namespace panda::ecmascript {
+// Native memory that embedders attribute to individual js objects, e.g. a big native buffer kept alive by a small
+// napi wrapper. Each entry is weak: it is dropped, and its bytes are released from the accounting, once the gc finds
+// the owner dead. Entries may be charged to a named module which can be given a budget. Only used on the js thread.
+class ExternalMemoryTracker {
+public:
+    static constexpr uint32_t INVALID_MODULE = UINT32_MAX;
+
+    ExternalMemoryTracker() = default;
+    ~ExternalMemoryTracker() = default;
+
+    NO_COPY_SEMANTIC(ExternalMemoryTracker);
+    NO_MOVE_SEMANTIC(ExternalMemoryTracker);
+
+    // Register or replace the external size of the object; passing 0 for both sizes removes the entry.
+    // The retained size is the embedder's estimate of native bytes freed together with the object, including memory
+    // only reachable through it, and is what the gc heuristics are charged with when it exceeds the external size.
+    // Returns false if the owning module is now over its budget.
+    bool Register(TaggedObject *object, size_t externalSize, size_t retainedSize, const CString &module);
+    void Unregister(TaggedObject *object);
+
+    void SetModuleBudget(const CString &module, size_t budget);
+    size_t GetModuleSize(const CString &module) const;
+    bool IsModuleOverBudget(const CString &module) const;
+
+    size_t GetExternalSize(TaggedObject *object) const;
+
+    size_t GetAccountedSize() const
+    {
+        return accountedSize_;
+    }
+
+    size_t GetEntryCount() const
+    {
+        return entries_.size();
+    }
+
+    void ProcessReferences(const WeakRootVisitor &visitor);
+    void IteratorReferences(WeakVisitor &visitor);
+
+    // Sample the accounted size at the end of a gc and return the growth rate, in bytes per millisecond, since the
+    // previous sample. Shrinking is reported as 0.
+    double SampleGrowthRate(double timeMs);
+
+    double GetGrowthRate() const
+    {
+        return growthRate_;
+    }
+
+    // Scale a gc headroom so that the external memory expected to be allocated before the next gc is taken into
+    // account. The headroom is never reduced below half of its original value.
+    size_t AdjustHeadroom(size_t headroom) const;
+
+private:
+    struct Entry {
+        JSTaggedValue object;
+        size_t externalSize {0};
+        size_t retainedSize {0};
+        uint32_t module {INVALID_MODULE};
+
+        size_t AccountedSize() const
+        {
+            return std::max(externalSize, retainedSize);
+        }
+    };
+
+    struct ModuleInfo {
+        CString name;
+        size_t budget {0};  // 0: unlimited
+        size_t size {0};
+    };
+
+    uint32_t GetOrCreateModule(const CString &module);
+    uint32_t FindModule(const CString &module) const;
+    void Charge(const Entry &entry);
+    void Release(const Entry &entry);
+    void RemoveAt(size_t index);
+    void RebuildIndex();
+
+    CVector<Entry> entries_;
+    CUnorderedMap<uintptr_t, size_t> index_;
+    CVector<ModuleInfo> modules_;
+    size_t accountedSize_ {0};
+    size_t lastSampledSize_ {0};
+    double lastSampleTimeMs_ {0};
+    double lastGCIntervalMs_ {0};
+    double growthRate_ {0};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_MEM_EXTERNAL_MEMORY_TRACKER_H
@@ -151,10 +151,7 @@ void FullGC::Mark()
     marker->ProcessMarkStack(MAIN_THREAD_INDEX);
     heap_->WaitRunningMarkTaskFinished();
 
-    bool prev = heap_->IsParallelGCEnabled();
-    heap_->SetParallelGCEnabled(false);
     MarkUntilFixPoint();
-    heap_->SetParallelGCEnabled(prev);
 
     if (heap_->GetEvacuateNonMovableSpace()) {
         heap_->GetNonMovableSpace()->PrepareForIterate();
@@ -164,56 +161,27 @@ void FullGC::Mark()
 void FullGC::MarkUntilFixPoint()
 {
     ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK, "FullGC::MarkUntilFixPoint", "");
-    if (heap_->GetEvacuateNonMovableSpace()) {
-        MarkUntilFixPointImpl<true>();
-    } else {
-        MarkUntilFixPointImpl<false>();
-    }
-}
-
-template <bool evacuateNonMovableSpace>
-void FullGC::MarkUntilFixPointImpl()
-{
     CompressGCMarker *marker = static_cast<CompressGCMarker *>(heap_->GetCompressGCMarker());
-    WorkNodeHolder *holder = workManager_->GetWorkNodeHolder(MAIN_THREAD_INDEX);
-    FullGCRunner<evacuateNonMovableSpace> runner(heap_, holder, forAppSpawn_);
-
-    std::vector<WeakAggregate> pendingWeakAggregates;
+    [[maybe_unused]] WorkNodeHolder *holder = workManager_->GetWorkNodeHolder(MAIN_THREAD_INDEX);
     ASSERT(holder->freshWeakAggregateWorkNodeWrapper_.IsLocalAndGlobalEmpty());
-
-    WeakAggregate weakAggregate;
-    while (holder->PopPendingWeakAggregate(&weakAggregate)) {
-        if (!runner.HandleWeakAggregate(weakAggregate)) {
-            pendingWeakAggregates.emplace_back(weakAggregate);
-        }
-    }
+    // Each round retries every pending weak aggregate once, spread over the gc workers. Values marked in a round
+    // may make keys of other aggregates reachable, so keep going until a whole round resolves nothing.
     while (true) {
-        if (holder->markWorkNodeWrapper_.IsLocalAndGlobalEmpty()) {
-            return;
-        }
-        marker->ProcessMarkStack(MAIN_THREAD_INDEX);
-        marker->MarkJitCodeMap(MAIN_THREAD_INDEX);
-
-        while (holder->PopFreshWeakAggregate(&weakAggregate)) {
-            if (!runner.HandleWeakAggregate(weakAggregate)) {
-                pendingWeakAggregates.emplace_back(weakAggregate);
+        marker->ResetWeakAggregateProgress();
+        if (heap_->IsParallelGCEnabled()) {
+            uint32_t taskCount = heap_->GetMaxMarkTaskCount();
+            for (uint32_t i = 0; i < taskCount; i++) {
+                heap_->TryPostParallelGCTask(ParallelGCTaskPhase::COMPRESS_HANDLE_WEAK_AGGREGATE_TASK);
             }
         }
-
-        auto it = pendingWeakAggregates.begin();
-        while (it != pendingWeakAggregates.end()) {
-            if (runner.HandleWeakAggregate(*it)) {
-                *it = pendingWeakAggregates.back();
-                if (it + 1 == pendingWeakAggregates.end()) {
-                    pendingWeakAggregates.pop_back();
-                    it = pendingWeakAggregates.end();
-                } else {
-                    pendingWeakAggregates.pop_back();
-                }
-            } else {
-                ++it;
-            }
+        marker->ProcessWeakAggregates(MAIN_THREAD_INDEX);
+        heap_->WaitRunningMarkTaskFinished();
+        if (!marker->HasWeakAggregateProgress()) {
+            return;
         }
+        marker->MarkJitCodeMap(MAIN_THREAD_INDEX);
+        marker->ProcessMarkStack(MAIN_THREAD_INDEX);
+        heap_->WaitRunningMarkTaskFinished();
     }
 }
 
@@ -45,8 +45,6 @@ protected:
 private:
     void MarkRoots();
     void MarkUntilFixPoint();
-    template <bool evacuateNonMovableSpace>
-    void MarkUntilFixPointImpl();
     void ProcessSharedGCRSetWorkList();
     template <bool evacuateNonMovableSpace>
     void SweepImpl();
@@ -16,7 +16,9 @@
 #include "ecmascript/mem/gc_stats.h"
 #include "ecmascript/mem/gc_key_stats.h"
 #include "common_components/base/time_utils.h"
+#include "common_components/taskpool/taskpool.h"
 #include "ecmascript/mem/heap-inl.h"
+#include "ecmascript/platform/os.h"
 
 constexpr int DESCRIPTION_LENGTH = 25;
 constexpr int DATA_LENGTH = 8;
@@ -350,6 +352,7 @@ void GCStats::PrintGCMemoryStatistic()
                     << "KB\n"
                     << STATS_DESCRIPTION_FORMAT("ChunkNativeSize:")
                     << STATS_DATA_FORMAT(sizeToKB(heap_->GetNativeAreaAllocator()->GetChunkNativeSize())) << "KB";
+    PrintMemoryCounters();
     switch (gcType_) {
         case GCType::PARTIAL_YOUNG_GC: {
             double copiedRate = double(GetRecordData(RecordData::YOUNG_ALIVE_SIZE)) /
@@ -716,6 +719,7 @@ void GCStats::RecordStatisticBeforeGC(TriggerGCType gcType, GCReason reason)
             break;
     }
     ProcessBeforeLongGCStats();
+    RecordMemoryCountersBeforeGC();
     RecordGCStatisticStart();
 }
 
@@ -841,9 +845,82 @@ void GCStats::RecordStatisticAfterGC()
     IncreaseAccumulatedFreeSize(GetRecordData(RecordData::START_OBJ_SIZE) -
                                 GetRecordData(RecordData::END_OBJ_SIZE));
     ProcessAfterLongGCStats();
+    RecordMemoryCountersAfterGC();
     RecordGCStatisticEnd();
 }
 
+void GCStats::EnableMemoryCounters()
+{
+    if (memoryCountersEnabled_) {
+        return;
+    }
+    memoryCountersEnabled_ = true;
+    // A perf counter follows a single thread, so the gc workers of the shared taskpool get one each.
+    std::vector<uint32_t> threadIds = common::Taskpool::GetCurrentTaskpool()->GetThreadIds();
+    threadIds.emplace_back(0);
+    for (uint32_t threadId : threadIds) {
+        int fd = OpenDTLBMissCounter(threadId);
+        if (fd >= 0) {
+            dtlbMissCounterFds_.emplace_back(fd);
+        }
+    }
+}
+
+void GCStats::DisableMemoryCounters()
+{
+    memoryCountersEnabled_ = false;
+    for (int fd : dtlbMissCounterFds_) {
+        CloseDTLBMissCounter(fd);
+    }
+    dtlbMissCounterFds_.clear();
+}
+
+uint64_t GCStats::ReadDTLBMisses() const
+{
+    uint64_t misses = 0;
+    for (int fd : dtlbMissCounterFds_) {
+        misses += ReadDTLBMissCounter(fd);
+    }
+    return misses;
+}
+
+void GCStats::RecordMemoryCountersBeforeGC()
+{
+    if (!memoryCountersEnabled_) {
+        return;
+    }
+    startPageFaults_ = GetPageFaultCount();
+    startDTLBMisses_ = ReadDTLBMisses();
+}
+
+void GCStats::RecordMemoryCountersAfterGC()
+{
+    if (!memoryCountersEnabled_) {
+        return;
+    }
+    size_t pageFaults = static_cast<size_t>(GetPageFaultCount() - startPageFaults_);
+    size_t dtlbMisses = static_cast<size_t>(ReadDTLBMisses() - startDTLBMisses_);
+    SetRecordData(RecordData::GC_PAGE_FAULTS, pageFaults);
+    IncreaseRecordData(RecordData::GC_TOTAL_PAGE_FAULTS, pageFaults);
+    SetRecordData(RecordData::GC_DTLB_MISSES, dtlbMisses);
+    IncreaseRecordData(RecordData::GC_TOTAL_DTLB_MISSES, dtlbMisses);
+}
+
+void GCStats::PrintMemoryCounters()
+{
+    if (!memoryCountersEnabled_) {
+        return;
+    }
+    LOG_GC(INFO) << STATS_DESCRIPTION_FORMAT("Page faults (process):")
+                 << STATS_DATA_FORMAT(GetRecordData(RecordData::GC_PAGE_FAULTS)) << "\n"
+                 << STATS_DESCRIPTION_FORMAT("Total page faults:")
+                 << STATS_DATA_FORMAT(GetRecordData(RecordData::GC_TOTAL_PAGE_FAULTS)) << "\n"
+                 << STATS_DESCRIPTION_FORMAT("dTLB misses (js+gc):")
+                 << STATS_DATA_FORMAT(GetRecordData(RecordData::GC_DTLB_MISSES)) << "\n"
+                 << STATS_DESCRIPTION_FORMAT("Total dTLB misses:")
+                 << STATS_DATA_FORMAT(GetRecordData(RecordData::GC_TOTAL_DTLB_MISSES));
+}
+
 void GCStats::ProcessAfterLongGCStats()
 {
     LongGCStats *longGCStats = GetLongGCStats();
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cstring>
 #include <ctime>
+#include <vector>
 
 #include "ecmascript/common.h"
 #include "ecmascript/mem/clock_scope.h"
@@ -104,6 +105,7 @@ public:
             delete longGCStats_;
             longGCStats_ = nullptr;
         }
+        DisableMemoryCounters();
     };
 
     virtual void PrintStatisticResult();
@@ -274,6 +276,16 @@ public:
         return fullGCLongTimeCount_;
     }
 
+    // Record page faults and dTLB misses of each gc. Page faults are counted for the whole process, dTLB misses for
+    // the calling thread and the taskpool workers running when the counters are enabled.
+    void EnableMemoryCounters();
+    void DisableMemoryCounters();
+
+    bool IsMemoryCountersEnabled() const
+    {
+        return memoryCountersEnabled_;
+    }
+
     GCStatisticData GetGCStatistic();
     static GCStatisticData MergeGCStatistic(const GCStatisticData &localStats,
         const GCStatisticData &sharedStats);
@@ -290,6 +302,10 @@ protected:
     void InitializeRecordList();
     float GetConcurrrentMarkDuration();
     void GCFinishTrace();
+    void RecordMemoryCountersBeforeGC();
+    void RecordMemoryCountersAfterGC();
+    uint64_t ReadDTLBMisses() const;
+    void PrintMemoryCounters();
     virtual void ProcessBeforeLongGCStats();
     virtual void ProcessAfterLongGCStats();
     int GetRecordDurationIndex(RecordDuration durationIdx)
@@ -378,6 +394,10 @@ protected:
         DEFAULT_OLD_EVACUATE_SPACE_SPEED, DEFAULT_YOUNG_CLEAR_NATIVE_OBJ_SPEED};
     float recordDuration_[(uint8_t)RecordDuration::NUM_OF_DURATION] {0.0f};
     bool concurrentMark_ {false};
+    bool memoryCountersEnabled_ {false};
+    std::vector<int> dtlbMissCounterFds_ {};
+    uint64_t startPageFaults_ {0};
+    uint64_t startDTLBMisses_ {0};
 
     static constexpr uint32_t THOUSAND = 1000;
 
@@ -33,6 +33,7 @@
 #include "ecmascript/js_runtime_options.h"
 #include "ecmascript/mem/allocator-inl.h"
 #include "ecmascript/mem/concurrent_sweeper.h"
+#include "ecmascript/mem/external_memory_tracker.h"
 #include "ecmascript/mem/linear_space.h"
 #include "ecmascript/mem/local_cmc/concurrent_copy_gc.h"
 #include "ecmascript/mem/mem.h"
@@ -970,6 +971,10 @@ void Heap::ReclaimRegions(TriggerGCType gcType, bool cmsGC)
             isCSetClearing_.store(false, std::memory_order_release);
         }
         inactiveSemiSpace_->ReclaimRegions(cachedSize);
+        if (cachedSize != 0 && MemMapAllocator::GetInstance()->IsEnableHugePage()) {
+            // Usually runs in AsyncClearTask, so first-touch faults of the next young generation leave the mutator.
+            MemMapAllocator::GetInstance()->PrefaultCommittedCache(cachedSize);
+        }
     }
     hugeObjectSpace_->ReclaimHugeRegion();
     hugeMachineCodeSpace_->ReclaimHugeRegion();
@@ -1700,6 +1705,8 @@ void Heap::ProcessNativeDelete(const WeakRootVisitor& visitor)
 
 void Heap::ProcessReferences(const WeakRootVisitor& visitor)
 {
+    // external memory entries may belong to young objects, so they are updated by every gc
+    externalMemoryTracker_->ProcessReferences(visitor);
     // process native ref should be limited to OldGC or FullGC only
     if (!IsYoungGC()) {
         ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK,
@@ -1806,6 +1813,7 @@ void Heap::IteratorNativePointerList(WeakVisitor &visitor)
         }
     }
     ShrinkWithFactor(concurrentNativePointerList_);
+    externalMemoryTracker_->IteratorReferences(visitor);
 }
 
 void Heap::RemoveFromNativePointerList(const JSNativePointer* pointer)
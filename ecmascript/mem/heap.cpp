@@ -18,11 +18,13 @@
 #include "ecmascript/dfx/cpu_profiler/cpu_profiler.h"
 #endif
 
+#include "common_components/platform/cpu.h"
 #include "common_components/taskpool/taskpool.h"
 #include "ecmascript/cross_vm/unified_gc/unified_gc.h"
 #include "ecmascript/cross_vm/unified_gc/unified_gc_marker.h"
 #include "ecmascript/mem/cms_mem/sticky_sweep_gc.h"
 #include "ecmascript/mem/cms_mem/sweep_gc.h"
+#include "ecmascript/mem/external_memory_tracker.h"
 #include "ecmascript/mem/idle_gc_trigger.h"
 #include "ecmascript/mem/local_cmc/cc_evacuator-inl.h"
 #include "ecmascript/mem/partial_gc.h"
@@ -745,6 +747,7 @@ SharedHeap::SharedGCScope::SharedGCScope()
 {
     Runtime::GetInstance()->GCIterateThreadList([](JSThread *thread) {
         auto heap = thread->GetEcmaVM()->GetHeap();
+        heap->WaitConcurrentVerifyFinished();
         heap->WaitAndHandleCCFinished();
         std::shared_ptr<pgo::PGOProfiler> pgoProfiler =  thread->GetEcmaVM()->GetPGOProfiler();
         if (pgoProfiler != nullptr) {
@@ -1170,11 +1173,15 @@ void Heap::Initialize()
     memController_ = new MemController(this);
     nativeAreaAllocator_ = ecmaVm_->GetNativeAreaAllocator();
     heapRegionAllocator_ = ecmaVm_->GetHeapRegionAllocator();
+    ApplyGCNumaPlacement();
 
     InitializeSpaces();
 
     // whether should verify heap duration gc
     shouldVerifyHeap_ = ecmaVm_->GetJSOptions().EnableHeapVerify();
+    heapVerifyParallel_ = ecmaVm_->GetJSOptions().IsHeapVerifyParallel();
+    heapVerifyConcurrent_ = ecmaVm_->GetJSOptions().IsHeapVerifyConcurrent();
+    heapVerifySampleRate_ = ecmaVm_->GetJSOptions().GetHeapVerifySampleRate();
     parallelGC_ = ecmaVm_->GetJSOptions().EnableParallelGC();
     bool concurrentMarkerEnabled = ecmaVm_->GetJSOptions().EnableConcurrentMark();
     markType_ = MarkType::MARK_YOUNG;
@@ -1208,6 +1215,7 @@ void Heap::Initialize()
     nativeSizeOvershoot_ = config_.GetNativeSizeOvershoot();
     asyncClearNativePointerThreshold_ = config_.GetAsyncClearNativePointerThreshold();
     idleGCTrigger_ = new IdleGCTrigger(this, sHeap_, thread_, GetEcmaVM()->GetJSOptions().EnableOptionalLog());
+    externalMemoryTracker_ = new ExternalMemoryTracker();
 }
 
 void Heap::InitializeSpaces()
@@ -1574,6 +1582,10 @@ void Heap::Destroy()
         delete jitFort_;
         jitFort_ = nullptr;
     }
+    if (externalMemoryTracker_ != nullptr) {
+        delete externalMemoryTracker_;
+        externalMemoryTracker_ = nullptr;
+    }
 }
 
 void Heap::Prepare()
@@ -1717,6 +1729,24 @@ void Heap::EnableParallelGC()
 #endif
     sweeper_->ConfigConcurrentSweep(ecmaVm_->GetJSOptions().EnableConcurrentSweep());
     concurrentMarker_->ConfigConcurrentMark(concurrentMarkerEnabled);
+    ApplyGCNumaPlacement();
+}
+
+void Heap::ApplyGCNumaPlacement()
+{
+    if (!ecmaVm_->GetJSOptions().EnableGCNumaAware() || common::NumberOfNumaNode() <= 1) {
+        return;
+    }
+    // The gc workers are shared by all vms of the process, the taskpool binds them once, to the node of the first
+    // mutator asking for it. The regions of this heap follow its own mutator, which touches them first.
+    int32_t workerNode = common::Taskpool::GetCurrentTaskpool()->ApplyNumaPlacement();
+    int32_t node = common::CurrentNumaNode();
+    if (node == common::INVALID_NUMA_NODE) {
+        LOG_GC(WARN) << "GC numa placement is skipped, can not get the numa node of the mutator";
+        return;
+    }
+    heapRegionAllocator_->SetPreferredNumaNode(node);
+    LOG_GC(INFO) << "Heap regions prefer numa node " << node << ", gc workers are bound to node " << workerNode;
 }
 
 TriggerGCType Heap::SelectGCType() const
@@ -1766,6 +1796,7 @@ void Heap::CollectGarbageImpl(TriggerGCType gcType, GCReason reason)
     //    treats WAIT threads as suspended (IsSuspended() == true), so no deadlock.
     RuntimeReadLockHolder gcReadLock(thread_, BaseHeap::gcExclusiveRWLock_);
     Jit::JitGCLockHolder lock(GetEcmaVM()->GetJSThread());
+    WaitConcurrentVerifyFinished();
     {
 #if ECMASCRIPT_ENABLE_THREAD_STATE_CHECK
         if (UNLIKELY(!thread_->IsInRunningStateOrProfiling())) { // LOCV_EXCL_BR_LINE
@@ -1972,7 +2003,7 @@ void Heap::CollectGarbageImpl(TriggerGCType gcType, GCReason reason)
     if (UNLIKELY(ShouldVerifyHeap())) { // LCOV_EXCL_BR_LINE
         // verify post gc heap verify
         LOG_ECMA(DEBUG) << "post gc heap verify";
-        Verification(this, VerifyKind::VERIFY_POST_GC).VerifyAll();
+        VerifyHeapAfterGC();
     }
 
 #if defined(ECMASCRIPT_SUPPORT_TRACING)
@@ -2440,6 +2471,18 @@ void Heap::RecomputeLimits()
     size_t maxGlobalSize = config_.GetMaxHeapSize() - newSpaceCapacity;
     size_t newGlobalSpaceLimit = memController_->CalculateAllocLimit(GetHeapObjectSize(), MIN_HEAP_SIZE,
                                                                      maxGlobalSize, newSpaceCapacity, growingFactor);
+    // Small wrappers holding big native buffers barely grow the heap, so pull the old gc trigger forward while
+    // external memory keeps growing.
+    externalMemoryTracker_->SampleGrowthRate(MemController::GetSystemTimeInMs());
+    if (newOldSpaceLimit > oldSpaceSize) {
+        newOldSpaceLimit = std::max(MIN_OLD_SPACE_LIMIT,
+            oldSpaceSize + externalMemoryTracker_->AdjustHeadroom(newOldSpaceLimit - oldSpaceSize));
+    }
+    size_t heapObjectSize = GetHeapObjectSize();
+    if (newGlobalSpaceLimit > heapObjectSize) {
+        newGlobalSpaceLimit = std::max(MIN_HEAP_SIZE,
+            heapObjectSize + externalMemoryTracker_->AdjustHeadroom(newGlobalSpaceLimit - heapObjectSize));
+    }
     globalSpaceAllocLimit_ = newGlobalSpaceLimit;
     oldSpace_->SetInitialCapacity(newOldSpaceLimit);
     globalSpaceNativeLimit_ = memController_->CalculateAllocLimit(GetGlobalNativeSize(), MIN_HEAP_SIZE,
@@ -2851,6 +2894,37 @@ void Heap::DecreaseNativeBindingSize(size_t size)
     nativeBindingSize_ -= size;
 }
 
+size_t Heap::GetExternalMemorySize() const
+{
+    return externalMemoryTracker_ != nullptr ? externalMemoryTracker_->GetAccountedSize() : 0;
+}
+
+bool Heap::RegisterExternalMemory(TaggedObject *object, size_t externalSize, size_t retainedSize,
+                                  const CString &module)
+{
+    if (JSTaggedValue(object).IsInSharedHeap()) {
+        LOG_GC(ERROR) << "External memory can not be registered for shared objects";
+        return false;
+    }
+    bool withinBudget = externalMemoryTracker_->Register(object, externalSize, retainedSize, module);
+    if (g_isEnableCMCGC) {
+        return withinBudget;
+    }
+    if (!withinBudget && concurrentMarker_->IsEnabled()) {
+        OPTIONAL_LOG(ecmaVm_, INFO) << "Native module " << module << " is over its external memory budget";
+        SetFullMarkRequestedState(true);
+        TryTriggerConcurrentMarking(MarkReason::NATIVE_LIMIT);
+    } else {
+        TryTriggerFullMarkOrGCByNativeSize();
+    }
+    return withinBudget;
+}
+
+void Heap::SetExternalMemoryBudget(const CString &module, size_t budget)
+{
+    externalMemoryTracker_->SetModuleBudget(module, budget);
+}
+
 void Heap::PrepareRecordRegionsForReclaim()
 {
     // fixme: refactor?
@@ -2888,6 +2962,7 @@ void Heap::TriggerConcurrentMarking(MarkReason markReason)
 
 void Heap::WaitAllTasksFinished()
 {
+    WaitConcurrentVerifyFinished();
     WaitAndHandleCCFinished();
     WaitAllMarkTaskFinished();
     sweeper_->EnsureAllTaskFinished();
@@ -3263,6 +3338,9 @@ bool Heap::ParallelGCTask::RunInternal(uint32_t threadIndex)
         case ParallelGCTaskPhase::UNIFIED_HANDLE_GLOBAL_POOL_TASK:
             heap_->GetUnifiedGCMarker()->ProcessMarkStack(threadIndex);
             break;
+        case ParallelGCTaskPhase::COMPRESS_HANDLE_WEAK_AGGREGATE_TASK:
+            static_cast<CompressGCMarker *>(heap_->GetCompressGCMarker())->ProcessWeakAggregates(threadIndex);
+            break;
         default: // LOCV_EXCL_BR_LINE
             LOG_GC(FATAL) << "this branch is unreachable, type: " << static_cast<int>(taskPhase_);
             UNREACHABLE();
@@ -3278,6 +3356,84 @@ bool Heap::AsyncClearTask::Run([[maybe_unused]] uint32_t threadIndex)
     return true;
 }
 
+void Heap::VerifyHeapAfterGC()
+{
+    if (!heapVerifyConcurrent_ || !parallelGC_) {
+        Verification(this, VerifyKind::VERIFY_POST_GC).VerifyAll();
+        return;
+    }
+    // Roots and the young space change as soon as the mutator resumes, so only the marked objects outside young
+    // space are left to the background, and they are checked for dangling references only.
+    WaitConcurrentVerifyFinished();
+    auto verification = std::make_unique<ParallelVerification>(this, VerifyKind::VERIFY_NO_SLOT_CHECK,
+                                                               heapVerifySampleRate_);
+    verification->CollectMarkedRegions(NextHeapVerifyEpoch());
+    if (verification->GetUnitCount() == 0) {
+        return;
+    }
+    {
+        LockHolder holder(waitConcurrentVerifyMutex_);
+        concurrentVerifyFinished_ = false;
+    }
+    common::Taskpool::GetCurrentTaskpool()->PostTask(
+        std::make_unique<ConcurrentVerifyTask>(GetJSThread()->GetThreadId(), this, std::move(verification)));
+}
+
+void Heap::WaitConcurrentVerifyFinished()
+{
+    size_t suspectedCount = 0;
+    {
+        LockHolder holder(waitConcurrentVerifyMutex_);
+        while (!concurrentVerifyFinished_) {
+            waitConcurrentVerifyCV_.Wait(&waitConcurrentVerifyMutex_);
+        }
+        suspectedCount = concurrentVerifyFailCount_;
+        concurrentVerifyFailCount_ = 0;
+    }
+    if (suspectedCount == 0) {
+        return;
+    }
+    // Every caller is in a pause of this heap, and nothing has cleared the marks the background task used yet, so
+    // the same objects are verified again without the mutator running. All of them, not only the sampled ones.
+    ParallelVerification verification(this, VerifyKind::VERIFY_NO_SLOT_CHECK);
+    verification.CollectMarkedRegions(NextHeapVerifyEpoch());
+    size_t failCount = verification.Run(0);
+    if (failCount > 0) { // LCOV_EXCL_START
+        LOG_GC(FATAL) << "Concurrent verify corrupted and " << failCount << " corruptions";
+    } // LCOV_EXCL_STOP
+    LOG_GC(INFO) << "Concurrent verify suspected " << suspectedCount << " corruptions, all passed in the pause";
+}
+
+void Heap::ReportConcurrentVerifyFailure(size_t failCount)
+{
+    LockHolder holder(waitConcurrentVerifyMutex_);
+    concurrentVerifyFailCount_ += failCount;
+}
+
+Heap::ConcurrentVerifyTask::ConcurrentVerifyTask(int32_t id, Heap *heap,
+                                                 std::unique_ptr<ParallelVerification> verification)
+    : common::Task(id), heap_(heap), verification_(std::move(verification))
+{
+}
+
+Heap::ConcurrentVerifyTask::~ConcurrentVerifyTask()
+{
+    LockHolder holder(heap_->waitConcurrentVerifyMutex_);
+    heap_->concurrentVerifyFinished_ = true;
+    heap_->waitConcurrentVerifyCV_.SignalAll();
+}
+
+bool Heap::ConcurrentVerifyTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK, "ConcurrentVerifyTask::Run", "");
+    size_t failCount = verification_->Run(0);
+    if (failCount > 0) {
+        LOG_GC(ERROR) << "Concurrent verify suspects " << failCount << " corruptions, re-check in the next pause";
+        heap_->ReportConcurrentVerifyFailure(failCount);
+    }
+    return true;
+}
+
 bool Heap::FinishColdStartTask::Run([[maybe_unused]] uint32_t threadIndex)
 {
     heap_->NotifyFinishColdStart(false);
@@ -48,11 +48,13 @@ class ConcurrentCopyGC;
 class ConcurrentMarker;
 class ConcurrentSweeper;
 class EcmaVM;
+class ExternalMemoryTracker;
 class FullGC;
 class GCStats;
 class GCKeyStats;
 class HeapRegionAllocator;
 class HeapTracker;
+class ParallelVerification;
 #if !WIN_OR_MAC_OR_IOS_PLATFORM
 class HeapProfilerInterface;
 class HeapProfiler;
@@ -1209,6 +1211,7 @@ public:
     void CompactHeapBeforeFork();
     void DisableParallelGC();
     void EnableParallelGC();
+    void ApplyGCNumaPlacement();
 #if defined(ECMASCRIPT_SUPPORT_SNAPSHOT) && defined(PANDA_TARGET_OHOS) && defined(ENABLE_HISYSEVENT)
     void SetJsDumpThresholds(size_t thresholds) const;
 #endif
@@ -1547,6 +1550,29 @@ public:
     PUBLIC_API void WaitCCFinished() const;
     void WaitAndHandleCCFinished();
 
+    bool IsHeapVerifyParallel() const
+    {
+        return heapVerifyParallel_;
+    }
+
+    uint32_t GetHeapVerifySampleRate() const
+    {
+        return heapVerifySampleRate_;
+    }
+
+    uint64_t NextHeapVerifyEpoch()
+    {
+        return ++heapVerifyEpoch_;
+    }
+
+    // Post gc heap verification. With heap-verify-concurrent the objects surviving the gc are verified by a
+    // background task, and anything which may move or free them waits for it by WaitConcurrentVerifyFinished.
+    void VerifyHeapAfterGC();
+    void WaitConcurrentVerifyFinished();
+    // The background task reads objects the mutator may be writing, so a failure there is only a suspicion. It is
+    // re-checked when the task is waited for, which is in a pause, and only a failure of the re-check is fatal.
+    void ReportConcurrentVerifyFailure(size_t failCount);
+
     MemGrowingType GetMemGrowingType() const
     {
         return memGrowingtype_;
@@ -1854,9 +1880,20 @@ public:
 
     size_t GetGlobalNativeSize() const
     {
-        return GetNativeBindingSize() + nativeAreaAllocator_->GetNativeMemoryUsage();
+        return GetNativeBindingSize() + nativeAreaAllocator_->GetNativeMemoryUsage() + GetExternalMemorySize();
+    }
+
+    ExternalMemoryTracker *GetExternalMemoryTracker() const
+    {
+        return externalMemoryTracker_;
     }
 
+    size_t GetExternalMemorySize() const;
+    // Returns false if the module the memory is charged to went over its budget; a full mark is requested then.
+    bool RegisterExternalMemory(TaggedObject *object, size_t externalSize, size_t retainedSize,
+                                const CString &module);
+    void SetExternalMemoryBudget(const CString &module, size_t budget);
+
     void ResetNativeSizeAfterLastGC()
     {
         nativeSizeAfterLastGC_ = 0;
@@ -2025,6 +2062,20 @@ private:
         Heap *heap_;
     };
 
+    class ConcurrentVerifyTask : public common::Task {
+    public:
+        ConcurrentVerifyTask(int32_t id, Heap *heap, std::unique_ptr<ParallelVerification> verification);
+        // Notify the waiters here, the task may be dropped without running when the vm is terminated.
+        ~ConcurrentVerifyTask() override;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(ConcurrentVerifyTask);
+        NO_MOVE_SEMANTIC(ConcurrentVerifyTask);
+    private:
+        Heap *heap_;
+        std::unique_ptr<ParallelVerification> verification_;
+    };
+
     class FinishGCRestrainTask : public common::Task {
     public:
         FinishGCRestrainTask(int32_t id, Heap *heap)
@@ -2199,6 +2250,16 @@ private:
     // parallel evacuator task number.
     uint32_t maxEvacuateTaskCount_ {0};
 
+    // ONLY used for heap verification.
+    bool heapVerifyParallel_ {false};
+    bool heapVerifyConcurrent_ {false};
+    uint32_t heapVerifySampleRate_ {0};
+    uint64_t heapVerifyEpoch_ {0};
+    Mutex waitConcurrentVerifyMutex_;
+    ConditionVariable waitConcurrentVerifyCV_;
+    bool concurrentVerifyFinished_ {true};
+    size_t concurrentVerifyFailCount_ {0};
+
     uint64_t startupDurationInMs_ {0};
 
     Mutex setNewSpaceOvershootSizeMutex_;
@@ -2214,6 +2275,8 @@ private:
 
     IdleGCTrigger *idleGCTrigger_ {nullptr};
 
+    ExternalMemoryTracker *externalMemoryTracker_ {nullptr};
+
     JitFort *jitFort_ {nullptr};
 
     bool hasOOMDump_ {false};
@@ -17,6 +17,7 @@
 
 #include "ecmascript/jit/jit.h"
 #include "ecmascript/mem/mem_map_allocator.h"
+#include "ecmascript/platform/map.h"
 #include "ecmascript/runtime.h"
 #include "ecmascript/runtime_lock.h"
 
@@ -100,6 +101,9 @@ Region *HeapRegionAllocator::AllocateAlignedRegion(Space *space, size_t capacity
         UNREACHABLE();
     }
 #endif
+    if (int32_t node = GetPreferredNumaNode(); node != common::INVALID_NUMA_NODE) {
+        PagePreferNumaNode(mapMem, capacity, node);
+    }
     IncreaseAnnoMemoryUsage(capacity);
 
     uintptr_t mem = ToUintPtr(mapMem);
@@ -18,6 +18,7 @@
 
 #include <atomic>
 
+#include "common_components/platform/cpu.h"
 #include "ecmascript/js_runtime_options.h"
 #include "ecmascript/mem/mem.h"
 #include "ecmascript/platform/mutex.h"
@@ -65,6 +66,17 @@ public:
         return maxAnnoMemoryUsage_.load(std::memory_order_relaxed);
     }
 
+    // Regions allocated afterwards prefer physical pages on this node, INVALID_NUMA_NODE disables the preference.
+    void SetPreferredNumaNode(int32_t node)
+    {
+        preferredNumaNode_.store(node, std::memory_order_relaxed);
+    }
+
+    int32_t GetPreferredNumaNode() const
+    {
+        return preferredNumaNode_.load(std::memory_order_relaxed);
+    }
+
 private:
     NO_COPY_SEMANTIC(HeapRegionAllocator);
     NO_MOVE_SEMANTIC(HeapRegionAllocator);
@@ -74,6 +86,7 @@ private:
 
     std::atomic<size_t> annoMemoryUsage_ {0};
     std::atomic<size_t> maxAnnoMemoryUsage_ {0};
+    std::atomic<int32_t> preferredNumaNode_ {common::INVALID_NUMA_NODE};
     bool enablePageTagThreadId_ {false};
 };
 }  // namespace panda::ecmascript
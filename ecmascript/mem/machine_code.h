@@ -36,6 +36,13 @@ enum class MachineCodeType : uint8_t {
     ARKSTEED_CODE,
 };
 
+// Location of an absolute stub entry address materialized in baseline code, recorded so that the code can be
+// relocated when it is reloaded from the persistent jit code cache by another process.
+struct StubRelocation {
+    uint32_t offset {0};   // offset of the address materialization sequence from the start of the code
+    uintptr_t target {0};  // stub entry address encoded at offset
+};
+
 struct MachineCodeDesc {
     uintptr_t rodataAddrBeforeText {0};
     size_t rodataSizeBeforeText {0};
@@ -52,6 +59,10 @@ struct MachineCodeDesc {
     size_t heapConstantTableSize {0};
     uintptr_t codeCommentsAddr { 0 };
     size_t codeCommentsSize { 0 };
+    uintptr_t stubRelocationAddr {0};
+    size_t stubRelocationCount {0};
+    // false if the stub calls were not emitted patchable, such code can't be stored in the jit code cache
+    bool stubCallsPatchable {false};
     MachineCodeType codeType {MachineCodeType::FAST_JIT_CODE};
 #ifdef JIT_ENABLE_CODE_SIGN
     uintptr_t codeSigner {0};
@@ -310,6 +321,11 @@ public:
         Barriers::SetPrimitive(this, OSRMASK_OFFSET, flag);
     }
 
+    bool IsOsrDeopt() const
+    {
+        return (Barriers::GetPrimitive<uint16_t>(this, OSRMASK_OFFSET) & OSR_DEOPT_FLAG) != 0;
+    }
+
     void SetOsrExecuteCnt(uint16_t count)
     {
         Barriers::SetPrimitive(this, OSR_EXECUTE_CNT_OFFSET, count);
@@ -30,6 +30,10 @@
 #include "ecmascript/platform/map.h"
 #include "ecmascript/platform/mutex.h"
 
+namespace panda::test {
+class MemMapAllocatorTest;
+}  // namespace panda::test
+
 namespace panda::ecmascript {
 // Regular region with length of DEFAULT_REGION_SIZE(256kb)
 class MemMapPool {
@@ -335,6 +339,17 @@ public:
         capacity_ = LARGE_HEAP_POOL_SIZE;
     }
 
+    // Must be set before Initialize, regular region pools are then 2MB aligned and backed by huge pages.
+    void SetEnableHugePage(bool enable)
+    {
+        enableHugePage_ = enable;
+    }
+
+    bool IsEnableHugePage() const
+    {
+        return enableHugePage_;
+    }
+
     void IncreaseMemMapTotalSize(size_t bytes)
     {
         memMapTotalSize_.fetch_add(bytes);
@@ -358,6 +373,10 @@ public:
 
     void AsyncFree(void *mem, size_t size, bool isRegular, bool isCompress, bool shouldPageTag);
 
+    // Move released regular regions to the committed cache with their pages populated, until the cache
+    // holds cachedSize bytes, so the next young generation does not take first-touch page faults.
+    size_t PrefaultCommittedCache(size_t cachedSize);
+
 private:
 #ifdef USE_COMPRESSED_POINTER
     void InitializeRegularRegionMapForCompressedPointer(size_t capacity, void *addr);
@@ -392,6 +411,7 @@ private:
     }
 
     static constexpr size_t REGULAR_REGION_MMAP_SIZE = 4_MB;
+    static constexpr size_t HUGE_PAGE_SIZE = 2_MB;
     static constexpr uint64_t HUGE_OBJECT_MEM_MAP_BEGIN_ADDR = 0x1000000000;
     static constexpr uint64_t REGULAR_OBJECT_MEM_MAP_BEGIN_ADDR = 0x2000000000;
     static constexpr uint64_t STEP_INCREASE_MEM_MAP_ADDR = 0x1000000000;
@@ -399,6 +419,18 @@ private:
     static constexpr size_t RANDOM_SHIFT_BIT = 28;
     static constexpr size_t MEM_MAP_RETRY_NUM = 10;
 
+    size_t GetRegularPoolAlignment(size_t alignment) const
+    {
+        return enableHugePage_ ? std::max(alignment, HUGE_PAGE_SIZE) : alignment;
+    }
+
+    void AdviseRegularPool(const MemMap &memMap) const
+    {
+        if (enableHugePage_) {
+            PageAdviseHugePage(memMap.GetMem(), memMap.GetSize());
+        }
+    }
+
     void AdapterSuitablePoolCapacity(bool isLargeHeap);
     void Free(void *mem, size_t size, bool isRegular, bool isCompress);
     void ReleaseMemory(void *mem, size_t size, bool isRegular, bool isCompress);
@@ -410,6 +442,9 @@ private:
     MemMapFreeList memMapFreeList_;
     std::atomic_size_t memMapTotalSize_ {0};
     size_t capacity_ {0};
+    bool enableHugePage_ {false};
+
+    friend class panda::test::MemMapAllocatorTest;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_MEM_MEM_MAP_ALLOCATOR_H
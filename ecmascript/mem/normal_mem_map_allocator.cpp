@@ -30,10 +30,12 @@ void MemMapAllocator::InitializeRegularRegionMap([[maybe_unused]] size_t alignme
     while (i < MEM_MAP_RETRY_NUM) {
         void *addr = reinterpret_cast<void *>(ToUintPtr(RandomGenerateBigAddr(REGULAR_OBJECT_MEM_MAP_BEGIN_ADDR)) +
             i * STEP_INCREASE_MEM_MAP_ADDR);
-        MemMap memMap = PageMap(initialRegularObjectCapacity, PAGE_PROT_NONE, alignment, addr);
+        MemMap memMap = PageMap(initialRegularObjectCapacity, PAGE_PROT_NONE, GetRegularPoolAlignment(alignment),
+                                addr);
         if (ToUintPtr(memMap.GetMem()) >= ToUintPtr(addr)) {
             PageTag(memMap.GetMem(), memMap.GetSize(), PageTagType::HEAP);
             PageRelease(memMap.GetMem(), memMap.GetSize());
+            AdviseRegularPool(memMap);
             memMapPool_.InsertMemMap(memMap);
             memMapPool_.SplitMemMapToCache(memMap);
             break;
@@ -240,9 +242,10 @@ MemMap MemMapAllocator::AllocateFromMemPool(const uint32_t threadId, size_t size
         return mem;
     }
 
-    mem = PageMap(REGULAR_REGION_MMAP_SIZE, PAGE_PROT_NONE, alignment);
+    mem = PageMap(REGULAR_REGION_MMAP_SIZE, PAGE_PROT_NONE, GetRegularPoolAlignment(alignment));
     ASSERT(mem.GetMem() != nullptr);
     PageTag(mem.GetMem(), mem.GetSize(), type);
+    AdviseRegularPool(mem);
     memMapPool_.InsertMemMap(mem);
     mem = memMapPool_.SplitMemFromCache(mem);
     if (mem.GetMem() != nullptr) {
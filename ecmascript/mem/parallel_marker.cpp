@@ -318,6 +318,40 @@ void CompressGCMarker::ProcessMarkStackImpl(uint32_t threadId)
     }
 }
 
+void CompressGCMarker::ProcessWeakAggregates(uint32_t threadId)
+{
+    if (heap_->GetEvacuateNonMovableSpace()) {
+        ProcessWeakAggregatesImpl<true>(threadId);
+    } else {
+        ProcessWeakAggregatesImpl<false>(threadId);
+    }
+}
+
+template <bool evacuateNonMovableSpace>
+void CompressGCMarker::ProcessWeakAggregatesImpl(uint32_t threadId)
+{
+    WorkNodeHolder *workNodeHolder = workManager_->GetWorkNodeHolder(threadId);
+    FullGCRunner<evacuateNonMovableSpace> fullGCRunner(heap_, workNodeHolder, isAppSpawn_);
+    std::vector<WeakAggregate> unresolved;
+    WeakAggregate weakAggregate;
+    bool progress = false;
+    while (workNodeHolder->PopPendingWeakAggregate(&weakAggregate)) {
+        if (fullGCRunner.HandleWeakAggregate(weakAggregate)) {
+            progress = true;
+        } else {
+            unresolved.emplace_back(weakAggregate);
+        }
+    }
+    if (progress) {
+        weakAggregateProgress_.store(true, std::memory_order_relaxed);
+        ProcessMarkStackImpl<evacuateNonMovableSpace>(threadId);
+    }
+    for (const WeakAggregate &aggregate : unresolved) {
+        workNodeHolder->PushPendingWeakAggregate(aggregate);
+    }
+    workNodeHolder->pendingWeakAggregateWorkNodeWrapper_.PushWorkNodeToGlobal(workManager_);
+}
+
 template <bool evacuateNonMovableSpace>
 bool CompressGCMarker::ProcessWeakAggregate(FullGCRunner<evacuateNonMovableSpace> *runner, WeakAggregate weakAggregate)
 {
@@ -97,6 +97,21 @@ public:
         isAppSpawn_ = flag;
     }
 
+    // Retry the pending weak aggregates once and drain the mark work their values produce. Aggregates whose key
+    // is still unmarked are kept out of the global pool until this thread is done, so that one round visits every
+    // aggregate at most once per thread.
+    void ProcessWeakAggregates(uint32_t threadId);
+
+    void ResetWeakAggregateProgress()
+    {
+        weakAggregateProgress_.store(false, std::memory_order_relaxed);
+    }
+
+    bool HasWeakAggregateProgress() const
+    {
+        return weakAggregateProgress_.load(std::memory_order_relaxed);
+    }
+
 protected:
     void MarkJitCodeMap(uint32_t threadId) override;
     void ProcessMarkStack(uint32_t threadId) override;
@@ -105,11 +120,14 @@ private:
     template <bool evacuateNonMovableSpace>
     void ProcessMarkStackImpl(uint32_t threadId);
     template <bool evacuateNonMovableSpace>
+    void ProcessWeakAggregatesImpl(uint32_t threadId);
+    template <bool evacuateNonMovableSpace>
     void MarkJitCodeMapImpl(uint32_t threadId);
     template <bool evacuateNonMovableSpace>
     bool ProcessWeakAggregate(FullGCRunner<evacuateNonMovableSpace> *runner, WeakAggregate weakAggregate);
 
     bool isAppSpawn_ {false};
+    std::atomic_bool weakAggregateProgress_ {false};
     Mutex mutex_;
 
     friend class FullGC;
@@ -15,6 +15,8 @@
 
 #include "ecmascript/mem/verification.h"
 
+#include "common_components/taskpool/taskpool.h"
+#include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/shared_heap/shared_concurrent_sweeper.h"
 
 namespace panda::ecmascript {
@@ -523,7 +525,15 @@ size_t Verification::VerifyRoot() const
 
 size_t Verification::VerifyHeap() const
 {
-    size_t failCount = heap_->VerifyHeapObjects(verifyKind_);
+    size_t failCount = 0;
+    uint32_t sampleRate = heap_->GetHeapVerifySampleRate();
+    if (heap_->IsHeapVerifyParallel() || sampleRate < ParallelVerification::MAX_SAMPLE_RATE) {
+        ParallelVerification verification(heap_, verifyKind_, sampleRate);
+        verification.CollectRegions(heap_->NextHeapVerifyEpoch());
+        failCount = verification.Run(heap_->IsHeapVerifyParallel() ? heap_->GetMaxMarkTaskCount() : 0);
+    } else {
+        failCount = heap_->VerifyHeapObjects(verifyKind_);
+    }
     if (failCount > 0) {
         LOG_GC(ERROR) << "VerifyHeap detects deadObject count is " << failCount;
     }
@@ -595,6 +605,180 @@ void Verification::VerifyEvacuate(Heap *heap)
     }
 }
 
+bool ParallelVerification::IsSampled(const Region *region) const
+{
+    if (sampleRate_ >= MAX_SAMPLE_RATE) {
+        return true;
+    }
+    // Mix the region address with the epoch, so that every region is picked up by some gc over time.
+    constexpr uint64_t GOLDEN_RATIO = 0x9E3779B97F4A7C15ULL;
+    constexpr uint32_t HASH_SHIFT = 32;
+    uint64_t hash = (static_cast<uint64_t>(ToUintPtr(region)) + epoch_ * GOLDEN_RATIO) * GOLDEN_RATIO;
+    return (hash >> HASH_SHIFT) % MAX_SAMPLE_RATE < sampleRate_;
+}
+
+void ParallelVerification::AddRegion(Region *region, UnitKind kind)
+{
+    if (IsSampled(region)) {
+        units_.push_back({kind, region, nullptr});
+    }
+}
+
+void ParallelVerification::CollectRegions(uint64_t epoch)
+{
+    epoch_ = epoch;
+    units_.clear();
+    nextUnit_.store(0, std::memory_order_relaxed);
+    failCount_.store(0, std::memory_order_relaxed);
+    // The current allocation region of a linear space may be followed by unfilled memory, so a linear space is
+    // verified as a whole by one worker.
+    if constexpr (G_USE_CMS_GC) {
+        units_.push_back({UnitKind::SLOT_SPACE, nullptr, nullptr});
+    } else {
+        units_.push_back({UnitKind::LINEAR_SPACE, nullptr, heap_->GetNewSpace()});
+        if (verifyKind_ == VerifyKind::VERIFY_EVACUATE_YOUNG ||
+            verifyKind_ == VerifyKind::VERIFY_EVACUATE_OLD ||
+            verifyKind_ == VerifyKind::VERIFY_EVACUATE_FULL) {
+            heap_->GetFromSpaceDuringEvacuation()->EnumerateRegions([this](Region *region) {
+                AddRegion(region, UnitKind::INACTIVE_SEMI_SPACE);
+            });
+        }
+        heap_->GetOldSpace()->PrepareForIterate();
+        heap_->GetOldSpace()->EnumerateRegions([this](Region *region) {
+            AddRegion(region, UnitKind::ALL_OBJECTS);
+        });
+    }
+    heap_->GetAppSpawnSpace()->EnumerateRegions([this](Region *region) {
+        AddRegion(region, UnitKind::MARKED_OBJECTS);
+    });
+    heap_->GetNonMovableSpace()->PrepareForIterate();
+    heap_->GetNonMovableSpace()->EnumerateRegions([this](Region *region) {
+        AddRegion(region, UnitKind::ALL_OBJECTS);
+    });
+    heap_->GetMachineCodeSpace()->PrepareForIterate();
+    heap_->GetMachineCodeSpace()->EnumerateRegions([this](Region *region) {
+        AddRegion(region, UnitKind::ALL_OBJECTS);
+    });
+    heap_->GetHugeObjectSpace()->EnumerateRegions([this](Region *region) {
+        AddRegion(region, UnitKind::HUGE_OBJECT);
+    });
+    heap_->GetHugeMachineCodeSpace()->EnumerateRegions([this](Region *region) {
+        AddRegion(region, UnitKind::HUGE_OBJECT);
+    });
+    units_.push_back({UnitKind::LINEAR_SPACE, nullptr, heap_->GetSnapshotSpace()});
+}
+
+void ParallelVerification::CollectMarkedRegions(uint64_t epoch)
+{
+    epoch_ = epoch;
+    units_.clear();
+    nextUnit_.store(0, std::memory_order_relaxed);
+    failCount_.store(0, std::memory_order_relaxed);
+    heap_->EnumerateNonNewSpaceRegions([this](Region *region) {
+        if (!region->InSnapshotSpace()) {
+            AddRegion(region, UnitKind::MARKED_OBJECTS);
+        }
+    });
+}
+
+size_t ParallelVerification::Run(uint32_t taskNum)
+{
+    taskNum = std::min(taskNum, static_cast<uint32_t>(units_.size()));
+    {
+        LockHolder holder(mutex_);
+        runningTaskCount_ = taskNum;
+    }
+    for (uint32_t i = 0; i < taskNum; i++) {
+        common::Taskpool::GetCurrentTaskpool()->PostTask(
+            std::make_unique<VerifyTask>(heap_->GetJSThread()->GetThreadId(), this));
+    }
+    DrainUnits(true);
+    {
+        LockHolder holder(mutex_);
+        while (runningTaskCount_ > 0) {
+            condition_.Wait(&mutex_);
+        }
+    }
+    return failCount_.load(std::memory_order_relaxed);
+}
+
+bool ParallelVerification::VerifyTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    ECMA_BYTRACE_NAME(HITRACE_LEVEL_COMMERCIAL, HITRACE_TAG_ARK, "ParallelVerification::VerifyTask::Run", "");
+    verification_->DrainUnits(false);
+    return true;
+}
+
+void ParallelVerification::DrainUnits(bool isMain)
+{
+    size_t failCount = 0;
+    size_t index = nextUnit_.fetch_add(1, std::memory_order_relaxed);
+    while (index < units_.size()) {
+        VerifyUnit(units_[index], &failCount);
+        index = nextUnit_.fetch_add(1, std::memory_order_relaxed);
+    }
+    failCount_.fetch_add(failCount, std::memory_order_relaxed);
+    if (!isMain) {
+        LockHolder holder(mutex_);
+        if (--runningTaskCount_ == 0) {
+            condition_.SignalAll();
+        }
+    }
+}
+
+void ParallelVerification::VerifyUnit(const Unit &unit, size_t *failCount) const
+{
+    VerifyObjectVisitor verifier(heap_, failCount, verifyKind_);
+    Region *region = unit.region;
+    switch (unit.kind) {
+        case UnitKind::ALL_OBJECTS: {
+            uintptr_t curPtr = region->GetBegin();
+            uintptr_t endPtr = region->GetEnd();
+            while (curPtr < endPtr) {
+                auto freeObject = FreeObject::Cast(curPtr);
+                size_t objSize;
+                // If curPtr is freeObject, It must to mark unpoison first.
+                ASAN_UNPOISON_MEMORY_REGION(freeObject, TaggedObject::TaggedObjectSize());
+                if (!freeObject->IsFreeObject()) {
+                    auto obj = reinterpret_cast<TaggedObject *>(curPtr);
+                    verifier(obj);
+                    objSize = obj->GetSize();
+                } else {
+                    freeObject->AsanUnPoisonFreeObject();
+                    objSize = freeObject->Available();
+                    freeObject->AsanPoisonFreeObject();
+                }
+                curPtr += objSize;
+                CHECK_OBJECT_SIZE(objSize);
+            }
+            CHECK_REGION_END(curPtr, endPtr);
+            break;
+        }
+        case UnitKind::HUGE_OBJECT:
+            verifier(reinterpret_cast<TaggedObject *>(region->GetBegin()));
+            break;
+        case UnitKind::MARKED_OBJECTS:
+            region->IterateAllMarkedBits([&verifier](void *mem) {
+                verifier(reinterpret_cast<TaggedObject *>(mem));
+            });
+            break;
+        case UnitKind::INACTIVE_SEMI_SPACE:
+            region->IterateAllMarkedBits([this](void *mem) {
+                VerifyObjectVisitor::VerifyInactiveSemiSpaceMarkedObject(heap_, mem);
+            });
+            break;
+        case UnitKind::LINEAR_SPACE:
+            unit.space->IterateOverObjects(verifier);
+            break;
+        case UnitKind::SLOT_SPACE:
+            heap_->GetSlotSpace()->IterateOverObjects(verifier);
+            break;
+        default: // LCOV_EXCL_BR_LINE
+            LOG_GC(FATAL) << "this branch is unreachable, unit kind: " << static_cast<int>(unit.kind);
+            UNREACHABLE();
+    }
+}
+
 void SharedHeapVerification::VerifyAll() const
 {
     [[maybe_unused]] VerifyScope verifyScope(sHeap_);
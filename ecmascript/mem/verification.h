@@ -17,6 +17,7 @@
 #define ECMASCRIPT_MEM_HEAP_VERIFICATION_H
 
 #include <cstdint>
+#include <vector>
 
 #include "ecmascript/cross_vm/verification_hybrid.h"
 #include "ecmascript/js_tagged_value_wrapper.h"
@@ -144,6 +145,78 @@ private:
     VerifyKind verifyKind_;
 };
 
+// Verify heap objects region by region. The regions are collected in the gc pause, optionally sampled, and
+// then drained by the calling thread together with taskpool workers.
+class ParallelVerification {
+public:
+    static constexpr uint32_t MAX_SAMPLE_RATE = 100;
+
+    ParallelVerification(Heap *heap, VerifyKind verifyKind, uint32_t sampleRate = MAX_SAMPLE_RATE)
+        : heap_(heap), verifyKind_(verifyKind), sampleRate_(sampleRate) {}
+    ~ParallelVerification() = default;
+
+    // Must be called in the gc pause. The epoch changes which regions are sampled.
+    void CollectRegions(uint64_t epoch);
+    // Only collect the marked objects outside young space, which stay valid until the next gc starts, so they
+    // can be verified after the mutator is resumed.
+    void CollectMarkedRegions(uint64_t epoch);
+    size_t Run(uint32_t taskNum);
+
+    size_t GetUnitCount() const
+    {
+        return units_.size();
+    }
+
+private:
+    enum class UnitKind : uint8_t {
+        ALL_OBJECTS,
+        HUGE_OBJECT,
+        MARKED_OBJECTS,
+        INACTIVE_SEMI_SPACE,
+        LINEAR_SPACE,
+        SLOT_SPACE,
+    };
+
+    struct Unit {
+        UnitKind kind;
+        Region *region {nullptr};
+        const LinearSpace *space {nullptr};
+    };
+
+    class VerifyTask : public common::Task {
+    public:
+        VerifyTask(int32_t id, ParallelVerification *verification)
+            : common::Task(id), verification_(verification) {}
+        ~VerifyTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(VerifyTask);
+        NO_MOVE_SEMANTIC(VerifyTask);
+
+    private:
+        ParallelVerification *verification_;
+    };
+
+    bool IsSampled(const Region *region) const;
+    void AddRegion(Region *region, UnitKind kind);
+    void DrainUnits(bool isMain);
+    void VerifyUnit(const Unit &unit, size_t *failCount) const;
+
+    NO_COPY_SEMANTIC(ParallelVerification);
+    NO_MOVE_SEMANTIC(ParallelVerification);
+
+    Heap *heap_ {nullptr};
+    VerifyKind verifyKind_;
+    uint32_t sampleRate_ {MAX_SAMPLE_RATE};
+    uint64_t epoch_ {0};
+    std::vector<Unit> units_;
+    std::atomic<size_t> nextUnit_ {0};
+    std::atomic<size_t> failCount_ {0};
+    Mutex mutex_;
+    ConditionVariable condition_;
+    uint32_t runningTaskCount_ {0};
+};
+
 class SharedHeapVerification {
 public:
     explicit SharedHeapVerification(SharedHeap *heap, VerifyKind verifyKind)
@@ -208,8 +281,9 @@ public:
             ASSERT(!hclass->IsAllTaggedProp());
             int index = 0;
             for (ObjectSlot slot = start; slot < end; slot++) {
-                auto layout = LayoutInfo::Cast(hclass->GetLayout(thread_).GetTaggedObject());
-                auto attr = layout->GetAttr(thread_, index++);
+                // The visitor also runs on verification workers, which have no current JSThread.
+                auto layout = LayoutInfo::Cast(hclass->GetLayout<RBMode::FAST_NO_RB>(thread_).GetTaggedObject());
+                auto attr = layout->GetAttr<RBMode::FAST_NO_RB>(thread_, index++);
                 if (attr.IsTaggedRep()) {
                     cb_(slot, TaggedObject::Cast(root));
                 }
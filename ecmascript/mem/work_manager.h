@@ -48,6 +48,7 @@ enum ParallelGCTaskPhase {
     COMPRESS_HANDLE_GLOBAL_POOL_TASK,
     CONCURRENT_HANDLE_GLOBAL_POOL_TASK,
     UNIFIED_HANDLE_GLOBAL_POOL_TASK,
+    COMPRESS_HANDLE_WEAK_AGGREGATE_TASK,
     UNDEFINED_TASK,
     TASK_LAST  // Count of different common::Task phase
 };
@@ -16,6 +16,7 @@
 #ifndef ECMASCRIPT_NAPI_INCLUDE_JSNAPI_EXPO_H
 #define ECMASCRIPT_NAPI_INCLUDE_JSNAPI_EXPO_H
 
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <functional>
@@ -909,6 +910,13 @@ public:
                                                   size_t nativeBindingsize);
 };
 
+// Where the keys of a GetProperties or SetProperties call site were found in the layout of the last object, so
+// that objects of the same shape skip the property lookup. Keep one per call site and key list. The entries are
+// checked against the layout of every object, a stale cache only costs a lookup.
+struct PropertyBatchCache {
+    std::vector<int32_t> entries {};
+};
+
 class PUBLIC_API ObjectRef : public JSValueRef {
 public:
     enum class SendableType {
@@ -951,6 +959,13 @@ public:
     Local<JSValueRef> Get(const EcmaVM *vm, Local<JSValueRef> key);
     Local<JSValueRef> Get(const EcmaVM *vm, const char *utf8);
     Local<JSValueRef> Get(const EcmaVM *vm, int32_t key);
+    // Get and Set for count keys at once. The keys should be interned once, e.g. with StringRef::NewFromUtf8 kept in
+    // a Global, own data properties of plain objects are then read and written without a lookup. Stops at the first
+    // exception and returns false.
+    bool GetProperties(const EcmaVM *vm, uint32_t count, const Local<JSValueRef> *keys, Local<JSValueRef> *values,
+                       PropertyBatchCache *cache = nullptr);
+    bool SetProperties(const EcmaVM *vm, uint32_t count, const Local<JSValueRef> *keys,
+                       const Local<JSValueRef> *values, PropertyBatchCache *cache = nullptr);
 
     bool GetOwnProperty(const EcmaVM *vm, Local<JSValueRef> key, PropertyAttribute &property);
     Local<ArrayRef> GetOwnPropertyNames(const EcmaVM *vm);
@@ -989,6 +1004,39 @@ public:
 
 using FunctionCallback = Local<JSValueRef>(*)(JsiRuntimeCallInfo*);
 using InternalFunctionCallback = JSValueRef(*)(JsiRuntimeCallInfo*);
+
+// The types in the signature of a fast native function, see FunctionRef::NewFastCall.
+enum class FastCallType : uint8_t {
+    NONE,     // only as return type, the call returns undefined
+    INT32,    // an int, or a double with an int32 value
+    DOUBLE,   // any number
+    BOOL,
+    POINTER,  // a NativePointerRef, passed as its external pointer
+    STRING,   // a flat string of one byte characters, passed as a view of them; only as argument type
+};
+
+union FastCallValue {
+    int32_t i32;
+    double f64;
+    bool b;
+    void *ptr;
+    struct {
+        const char *data;
+        uint32_t length;
+    } str;
+};
+
+using FastFunctionCallback = FastCallValue(*)(void *data, const FastCallValue *args);
+
+struct FastCallInfo {
+    static constexpr uint32_t MAX_ARGS = 8;
+
+    FunctionCallback slowFunc {nullptr};
+    FastFunctionCallback fastFunc {nullptr};
+    FastCallType returnType {FastCallType::NONE};
+    uint32_t argCount {0};
+    std::array<FastCallType, MAX_ARGS> argTypes {};
+};
 class PUBLIC_API FunctionRef : public ObjectRef {
 public:
     struct SendablePropertiesInfos {
@@ -1035,6 +1083,13 @@ public:
                                                     InternalFunctionCallback nativeFunc, NativePointerCallback deleter,
                                                     const char *name, void *data = nullptr, bool callNapi = false,
                                                     size_t nativeBindingsize = 0);
+    // When the first info->argCount arguments of a call match info->argTypes, they are passed unboxed to
+    // info->fastFunc, which runs without a LocalScope and without leaving the running state; it must not call into
+    // the vm, throw or block. Any other call goes to info->slowFunc as for New. info is not copied and must outlive
+    // the function, the deleter gets it as the native pointer. Calls with up to three arguments from the interpreter
+    // and baseline code reach info->fastFunc from the call stub, without entering the native function.
+    static Local<FunctionRef> NewFastCall(EcmaVM *vm, const FastCallInfo *info, NativePointerCallback deleter = nullptr,
+        void *data = nullptr, bool callNapi = false, size_t nativeBindingsize = 0);
     static Local<FunctionRef> NewSendable(EcmaVM *vm,
                                           InternalFunctionCallback nativeFunc,
                                           NativePointerCallback deleter,
@@ -1381,6 +1436,14 @@ public:
     uint32_t Length(const EcmaVM *vm);
     static bool SetValueAt(const EcmaVM *vm, Local<JSValueRef> obj, uint32_t index, Local<JSValueRef> value);
     static Local<JSValueRef> GetValueAt(const EcmaVM *vm, Local<JSValueRef> obj, uint32_t index);
+    // Arrays filled from a native buffer in one go, their elements kind is INT, NUMBER or STRING from the start.
+    static Local<ArrayRef> NewFromInt32Buffer(const EcmaVM *vm, const int32_t *buffer, uint32_t length);
+    static Local<ArrayRef> NewFromDoubleBuffer(const EcmaVM *vm, const double *buffer, uint32_t length);
+    static Local<ArrayRef> NewFromUtf8Strings(const EcmaVM *vm, const char *const *strings, uint32_t length);
+    // Copies the first length elements to buffer. Returns false without a complete copy when the array is not a
+    // stable array of at least length elements, or an element is not an int32, respectively not a number.
+    bool CopyToInt32Buffer(const EcmaVM *vm, int32_t *buffer, uint32_t length);
+    bool CopyToDoubleBuffer(const EcmaVM *vm, double *buffer, uint32_t length);
 };
 
 class PUBLIC_API SendableArrayRef : public ObjectRef {
@@ -1937,6 +2000,14 @@ public:
     static void HintGC(const EcmaVM *vm, MemoryReduceDegree degree, ecmascript::GCReason reason);
     static void TriggerIdleGC(const EcmaVM *vm, TRIGGER_IDLE_GC_TYPE gcType);
     static size_t GetEcmaVMExpectedMemoryReclamationSize(const EcmaVM *vm);
+    // Attribute native memory to a js object until it is collected; 0 for both sizes unregisters it.
+    // retainedSize estimates the native bytes released together with the object. When module is not empty the
+    // memory is charged to that native module, and false is returned once the module exceeds its budget.
+    static bool SetExternalMemory(const EcmaVM *vm, Local<JSValueRef> object, size_t externalSize,
+                                  size_t retainedSize = 0, const std::string &module = "");
+    static void SetNativeModuleMemoryBudget(const EcmaVM *vm, const std::string &module, size_t budget);
+    static size_t GetNativeModuleMemorySize(const EcmaVM *vm, const std::string &module);
+    static size_t GetExternalMemorySize(const EcmaVM *vm);
     static void SetStartIdleMonitorCallback(const StartIdleMonitorCallback& callback);
     static StartIdleMonitorCallback GetStartIdleMonitorCallback();
     static void SetNotifyDeferFreezeCallback(const NotifyDeferFreezeCallback& callback);
@@ -14,8 +14,11 @@
  */
 
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <fcntl.h>
+#include <limits>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -453,7 +456,86 @@ JSTaggedValue Callback::RegisterCallback(ecmascript::EcmaRuntimeCallInfo *ecmaRu
     JSHandle<JSNativePointer> extraInfo(thread, extraInfoValue);
     // callBack
     FunctionCallback nativeFunc = reinterpret_cast<FunctionCallback>(extraInfo->GetExternalPointer());
+    return CallFunctionCallback(thread, function, nativeFunc, ecmaRuntimeCallInfo);
+}
+
+JSTaggedValue Callback::RegisterFastCallback(ecmascript::EcmaRuntimeCallInfo *ecmaRuntimeCallInfo)
+{
+    JSThread *thread = ecmaRuntimeCallInfo->GetThread();
+    ecmascript::ThreadManagedScope managedScope(thread);
+    JSHandle<JSTaggedValue> constructor = BuiltinsBase::GetConstructor(ecmaRuntimeCallInfo);
+    if (!constructor->IsJSFunction()) {
+        return JSTaggedValue::False();
+    }
+    JSFunctionBase *rawFunction = JSFunctionBase::Cast(constructor->GetTaggedObject());
+    JSTaggedValue extraInfoValue = rawFunction->GetFunctionExtraInfo(thread);
+    if (!extraInfoValue.IsJSNativePointer()) {
+        return JSTaggedValue::False();
+    }
+    if (ecmaRuntimeCallInfo->GetNewTargetValue().IsUndefined()) {
+        uint32_t argc = std::min<uint32_t>(ecmaRuntimeCallInfo->GetArgsNumber(), FastCallInfo::MAX_ARGS);
+        std::array<JSTaggedValue, FastCallInfo::MAX_ARGS> argv {};
+        for (uint32_t i = 0; i < argc; i++) {
+            argv[i] = ecmaRuntimeCallInfo->GetCallArgValue(i);
+        }
+        JSTaggedValue result = CallFastFunction(thread, rawFunction, argc, argv.data(), true);
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+    [[maybe_unused]] LocalScope scope(thread->GetEcmaVM());
+    JSHandle<JSFunctionBase> function(constructor);
+    const FastCallInfo *info = reinterpret_cast<const FastCallInfo *>(
+        JSNativePointer::Cast(extraInfoValue.GetTaggedObject())->GetExternalPointer());
+    return CallFunctionCallback(thread, function, info->slowFunc, ecmaRuntimeCallInfo);
+}
+
+JSTaggedValue Callback::CallFastFunction(JSThread *thread, JSFunctionBase *function, uint32_t argc,
+                                         const JSTaggedValue *argv, bool hasNativeFrame)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    JSTaggedValue extraInfoValue = function->GetFunctionExtraInfo(thread);
+    if (!extraInfoValue.IsJSNativePointer()) {
+        return JSTaggedValue::Hole();
+    }
+    JSNativePointer *extraInfo = JSNativePointer::Cast(extraInfoValue.GetTaggedObject());
+    const FastCallInfo *info = reinterpret_cast<const FastCallInfo *>(extraInfo->GetExternalPointer());
+    if (argc < info->argCount) {
+        return JSTaggedValue::Hole();
+    }
+    // no handle is created and nothing is allocated until the fast function returns, so the raw arguments,
+    // string views included, stay valid while it runs
+    std::array<FastCallValue, FastCallInfo::MAX_ARGS> args {};
+    for (uint32_t i = 0; i < info->argCount; i++) {
+        if (!UnboxFastCallArg(argv[i], info->argTypes[i], args[i])) {
+            return JSTaggedValue::Hole();
+        }
+    }
+#if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
+    // the profiler takes the stack from the frame of the native entry, callers without one use the generic path
+    bool getStackBeforeCallNapiSuccess = false;
+    if (thread->GetIsProfiling() && function->IsCallNapi()) {
+        if (!hasNativeFrame) {
+            return JSTaggedValue::Hole();
+        }
+        getStackBeforeCallNapiSuccess = thread->GetEcmaVM()->GetProfiler()->GetStackBeforeCallNapi(thread);
+    }
+#else
+    (void)hasNativeFrame;
+#endif
+    FastCallValue result = info->fastFunc(extraInfo->GetData(), args.data());
+#if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
+    if (getStackBeforeCallNapiSuccess) {
+        thread->GetEcmaVM()->GetProfiler()->GetStackAfterCallNapi(thread);
+    }
+#endif
+    return BoxFastCallResult(info->returnType, result);
+}
 
+JSTaggedValue Callback::CallFunctionCallback(JSThread *thread, const JSHandle<JSFunctionBase> &function,
+                                             FunctionCallback nativeFunc,
+                                             ecmascript::EcmaRuntimeCallInfo *ecmaRuntimeCallInfo)
+{
     JsiRuntimeCallInfo *jsiRuntimeCallInfo = reinterpret_cast<JsiRuntimeCallInfo *>(ecmaRuntimeCallInfo);
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
     bool getStackBeforeCallNapiSuccess = false;
@@ -476,4 +558,73 @@ JSTaggedValue Callback::RegisterCallback(ecmascript::EcmaRuntimeCallInfo *ecmaRu
 #endif
     return JSNApiHelper::ToJSHandle(result).GetTaggedValue();
 }
+
+bool Callback::UnboxFastCallArg(JSTaggedValue arg, FastCallType type, FastCallValue &value)
+{
+    switch (type) {
+        case FastCallType::INT32: {
+            if (arg.IsInt()) {
+                value.i32 = arg.GetInt();
+                return true;
+            }
+            if (!arg.IsDouble()) {
+                return false;
+            }
+            double number = arg.GetDouble();
+            // NaN, -0, fractions and numbers out of the int32 range take the slow path
+            if (!(number >= std::numeric_limits<int32_t>::min() && number <= std::numeric_limits<int32_t>::max()) ||
+                static_cast<int32_t>(number) != number || (number == 0 && std::signbit(number))) {
+                return false;
+            }
+            value.i32 = static_cast<int32_t>(number);
+            return true;
+        }
+        case FastCallType::DOUBLE:
+            if (!arg.IsNumber()) {
+                return false;
+            }
+            value.f64 = arg.GetNumber();
+            return true;
+        case FastCallType::BOOL:
+            if (!arg.IsBoolean()) {
+                return false;
+            }
+            value.b = arg.IsTrue();
+            return true;
+        case FastCallType::POINTER:
+            if (!arg.IsJSNativePointer()) {
+                return false;
+            }
+            value.ptr = JSNativePointer::Cast(arg.GetTaggedObject())->GetExternalPointer();
+            return true;
+        case FastCallType::STRING: {
+            if (!arg.IsString()) {
+                return false;
+            }
+            EcmaStringAccessor str(arg);
+            if (!str.IsLineString() || !str.IsUtf8()) {
+                return false;
+            }
+            value.str.data = reinterpret_cast<const char *>(str.GetDataUtf8());
+            value.str.length = str.GetLength();
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+JSTaggedValue Callback::BoxFastCallResult(FastCallType type, const FastCallValue &value)
+{
+    switch (type) {
+        case FastCallType::INT32:
+            return JSTaggedValue(value.i32);
+        case FastCallType::DOUBLE:
+            return JSTaggedValue(value.f64);
+        case FastCallType::BOOL:
+            return JSTaggedValue(value.b);
+        default:
+            return JSTaggedValue::Undefined();
+    }
+}
 }  // namespace panda
@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <limits>
 
 #include "ecmascript/base/json_stringifier.h"
 #include "ecmascript/base/typed_array_helper-inl.h"
@@ -27,14 +28,17 @@
 #endif
 #include "ecmascript/checkpoint/thread_state_transition.h"
 #include "ecmascript/ecma_global_storage.h"
+#include "ecmascript/element_accessor-inl.h"
 #include "ecmascript/ic/ic_info.h"
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
 #include "ecmascript/interpreter/interpreter_assembly.h"
 #include "ecmascript/jsnapi_sendable.h"
 #include "ecmascript/jspandafile/js_pandafile_executor.h"
 #include "ecmascript/js_hclass.h"
+#include "ecmascript/layout_info.h"
 #include "ecmascript/lexical_env.h"
 #include "ecmascript/linked_hash_table.h"
+#include "ecmascript/mem/external_memory_tracker.h"
 #include "ecmascript/mem/idle_gc_trigger.h"
 #include "ecmascript/module/module_logger.h"
 #include "ecmascript/module/napi_module_loader.h"
@@ -77,6 +81,8 @@ using ecmascript::ECMAObject;
 using ecmascript::EcmaRuntimeCallInfo;
 using ecmascript::EcmaString;
 using ecmascript::EcmaStringAccessor;
+using ecmascript::ElementAccessor;
+using ecmascript::ElementsKind;
 using ecmascript::ErrorType;
 using ecmascript::FastRuntimeStub;
 using ecmascript::GeneratorContext;
@@ -117,15 +123,18 @@ using ecmascript::JSThread;
 using ecmascript::JSType;
 using ecmascript::JSTypedArray;
 using ecmascript::JSNApiClassCreationHelper;
+using ecmascript::LayoutInfo;
 using ecmascript::LinkedHashMap;
 using ecmascript::LinkedHashSet;
 using ecmascript::LockHolder;
 using ecmascript::MemMapAllocator;
 using ecmascript::Method;
+using ecmascript::MutantTaggedArray;
 using ecmascript::NativeModuleFailureInfo;
 using ecmascript::ObjectFactory;
 using ecmascript::OperationResult;
 using ecmascript::PromiseCapability;
+using ecmascript::PropertyAttributes;
 using ecmascript::PropertyDescriptor;
 using ecmascript::Region;
 using ecmascript::ICInfo;
@@ -2943,6 +2952,114 @@ Local<NativePointerRef> ObjectRef::GetNativeBindingPointer(const EcmaVM *vm)
     return scope.Escape(JSNApiHelper::ToLocal<JSValueRef>(ret.GetValue()));
 }
 
+namespace {
+void PrepareBatchCache(PropertyBatchCache *cache, uint32_t count)
+{
+    if (cache != nullptr && cache->entries.size() != count) {
+        cache->entries.assign(count, -1);
+    }
+}
+
+// The layout entry of an own data property of a plain object, or -1 when the generic path has to handle the key.
+int32_t FindBatchPropertyEntry(const JSThread *thread, JSTaggedValue obj, JSTaggedValue key,
+                               PropertyBatchCache *cache, uint32_t index)
+{
+    if (!obj.IsHeapObject() || !(key.IsString() || key.IsSymbol())) {
+        return -1;
+    }
+    JSHClass *hclass = obj.GetTaggedObject()->GetClass();
+    // fields of aot hclasses may hold raw numbers, they are converted on the generic path
+    if (hclass->GetObjectType() != JSType::JS_OBJECT || hclass->IsDictionaryMode() || hclass->IsAOT()) {
+        return -1;
+    }
+    LayoutInfo *layout = LayoutInfo::Cast(hclass->GetLayout(thread).GetTaggedObject());
+    int32_t entry = -1;
+    if (cache != nullptr) {
+        int32_t cached = cache->entries[index];
+        if (cached >= 0 && cached < static_cast<int32_t>(hclass->NumberOfProps()) &&
+            layout->GetKey(thread, cached) == key) {
+            entry = cached;
+        }
+    }
+    if (entry == -1) {
+        entry = JSHClass::FindPropertyEntry(thread, hclass, key);
+        if (entry == -1) {
+            return -1;
+        }
+        if (cache != nullptr) {
+            cache->entries[index] = entry;
+        }
+    }
+    PropertyAttributes attr = layout->GetAttr(thread, entry);
+    if (attr.IsAccessor() || JSObject::Cast(obj)->GetProperty(thread, hclass, attr).IsHole()) {
+        return -1;
+    }
+    return entry;
+}
+}  // namespace
+
+bool ObjectRef::GetProperties(const EcmaVM *vm, uint32_t count, const Local<JSValueRef> *keys,
+                              Local<JSValueRef> *values, PropertyBatchCache *cache)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
+    ecmascript::ThreadManagedScope managedScope(thread);
+    JSHandle<JSTaggedValue> obj = JSNApiHelper::ToJSHandle(this);
+    LOG_IF_SPECIAL(obj, ERROR);
+    PrepareBatchCache(cache, count);
+    for (uint32_t i = 0; i < count; i++) {
+        JSTaggedValue key = JSNApiHelper::ToJSTaggedValue(*keys[i]);
+        int32_t entry = FindBatchPropertyEntry(thread, obj.GetTaggedValue(), key, cache, i);
+        JSTaggedValue result;
+        if (entry != -1) {
+            JSHClass *hclass = obj->GetTaggedObject()->GetClass();
+            LayoutInfo *layout = LayoutInfo::Cast(hclass->GetLayout(thread).GetTaggedObject());
+            result = JSObject::Cast(obj.GetTaggedValue())->GetProperty(thread, hclass, layout->GetAttr(thread, entry));
+        } else if (!obj->IsHeapObject()) {
+            OperationResult ret = JSTaggedValue::GetProperty(thread, obj, JSNApiHelper::ToJSHandle(keys[i]));
+            RETURN_VALUE_IF_ABRUPT(thread, false);
+            result = ret.GetValue().GetTaggedValue();
+        } else {
+            result = ObjectFastOperator::FastGetPropertyByValue(thread, obj.GetTaggedValue(), key);
+            RETURN_VALUE_IF_ABRUPT(thread, false);
+        }
+        values[i] = JSNApiHelper::ToLocal<JSValueRef>(JSHandle<JSTaggedValue>(thread, result));
+    }
+    return true;
+}
+
+bool ObjectRef::SetProperties(const EcmaVM *vm, uint32_t count, const Local<JSValueRef> *keys,
+                              const Local<JSValueRef> *values, PropertyBatchCache *cache)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
+    ecmascript::ThreadManagedScope managedScope(thread);
+    [[maybe_unused]] LocalScope scope(vm);
+    JSHandle<JSTaggedValue> obj = JSNApiHelper::ToJSHandle(this);
+    LOG_IF_SPECIAL(obj, ERROR);
+    PrepareBatchCache(cache, count);
+    for (uint32_t i = 0; i < count; i++) {
+        JSTaggedValue key = JSNApiHelper::ToJSTaggedValue(*keys[i]);
+        JSTaggedValue value = JSNApiHelper::ToJSTaggedValue(*values[i]);
+        int32_t entry = FindBatchPropertyEntry(thread, obj.GetTaggedValue(), key, cache, i);
+        if (entry != -1) {
+            JSHClass *hclass = obj->GetTaggedObject()->GetClass();
+            LayoutInfo *layout = LayoutInfo::Cast(hclass->GetLayout(thread).GetTaggedObject());
+            PropertyAttributes attr = layout->GetAttr(thread, entry);
+            if (attr.IsWritable()) {
+                JSObject::Cast(obj.GetTaggedValue())->SetProperty<true>(thread, hclass, attr, value);
+                continue;
+            }
+        }
+        bool success = obj->IsHeapObject() ?
+            ObjectFastOperator::FastSetPropertyByValue(thread, obj.GetTaggedValue(), key, value) :
+            JSTaggedValue::SetProperty(thread, obj, JSNApiHelper::ToJSHandle(keys[i]),
+                                       JSNApiHelper::ToJSHandle(values[i]));
+        if (!success || thread->HasPendingException()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ObjectRef::Set(const EcmaVM *vm, Local<JSValueRef> key, Local<JSValueRef> value)
 {
     CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
@@ -3847,6 +3964,25 @@ Local<FunctionRef> FunctionRef::New(EcmaVM *vm, FunctionCallback nativeFunc,
     return New(vm, context, nativeFunc, deleter, data, callNapi, nativeBindingsize);
 }
 
+Local<FunctionRef> FunctionRef::NewFastCall(EcmaVM *vm, const FastCallInfo *info,
+    NativePointerCallback deleter, void *data, bool callNapi, size_t nativeBindingsize)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, JSValueRef::Undefined(vm));
+    ecmascript::ThreadManagedScope managedScope(thread);
+    ASSERT(info != nullptr && info->slowFunc != nullptr && info->fastFunc != nullptr);
+    ASSERT(info->argCount <= FastCallInfo::MAX_ARGS);
+    ObjectFactory *factory = vm->GetFactory();
+    JSHandle<GlobalEnv> env = vm->GetGlobalEnv();
+    JSHandle<JSFunction> current(factory->NewJSFunction(env,
+        reinterpret_cast<void *>(Callback::RegisterFastCallback)));
+    JSFunction::SetFunctionExtraInfo(thread, current, const_cast<FastCallInfo *>(info),
+                                     deleter, data, nativeBindingsize);
+    current->SetCallNapi(callNapi);
+    current->SetFastNativeCall(true);
+    current->SetLexicalEnv(thread, env);
+    return JSNApiHelper::ToLocal<FunctionRef>(JSHandle<JSTaggedValue>(current));
+}
+
 Local<FunctionRef> FunctionRef::NewConcurrent(EcmaVM *vm, const Local<JSValueRef> &context, FunctionCallback nativeFunc,
     NativePointerCallback deleter, void *data, bool callNapi, size_t nativeBindingsize)
 {
@@ -4511,6 +4647,127 @@ bool ArrayRef::SetValueAt(const EcmaVM *vm, Local<JSValueRef> obj, uint32_t inde
     return JSArray::FastSetPropertyByValue(thread, objectHandle, index, valueHandle);
 }
 
+namespace {
+// The kind of all elements is known up front, so the elements are written without the per element kind
+// transitions of a generic store.
+template<typename T>
+JSHandle<JSTaggedValue> NewArrayFromBuffer(JSThread *thread, const T *buffer, uint32_t length, ElementsKind kind)
+{
+    if (length == 0) {
+        return JSArray::ArrayCreate(thread, JSTaggedNumber(0));
+    }
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    bool isMutant = thread->IsEnableMutantArray();
+    JSHandle<TaggedArray> elements = isMutant ? JSHandle<TaggedArray>(factory->NewMutantTaggedArray(length)) :
+                                                factory->NewTaggedArray(length);
+    for (uint32_t i = 0; i < length; i++) {
+        JSTaggedValue value(buffer[i]);
+        if (isMutant) {
+            ecmascript::Barriers::SetPrimitive<JSTaggedType>(elements->GetData(), JSTaggedValue::TaggedTypeSize() * i,
+                ElementAccessor::ConvertTaggedValueWithElementsKind(value, kind));
+        } else {
+            elements->Set<false>(thread, i, value);
+        }
+    }
+    JSHandle<JSArray> array = factory->NewJSStableArrayWithElements(elements);
+    if (thread->IsEnableElementsKind()) {
+        [[maybe_unused]] bool success = JSHClass::TransitToElementsKindUncheck(thread, JSHandle<JSObject>(array), kind);
+        ASSERT(success || !isMutant);
+    }
+    return JSHandle<JSTaggedValue>(array);
+}
+
+template<typename T, typename Convert>
+bool CopyArrayToBuffer(JSThread *thread, const JSHandle<JSTaggedValue> &array, T *buffer, uint32_t length,
+                       const Convert &convert)
+{
+    if (!array->IsStableJSArray(thread)) {
+        return false;
+    }
+    JSObject *obj = JSObject::Cast(array->GetTaggedObject());
+    if (JSArray::Cast(obj)->GetArrayLength() < length || ElementAccessor::GetElementsLength(thread, obj) < length) {
+        return false;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        if (!convert(ElementAccessor::Get(thread, obj, i), buffer[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+Local<ArrayRef> ArrayRef::NewFromInt32Buffer(const EcmaVM *vm, const int32_t *buffer, uint32_t length)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, JSValueRef::Undefined(vm));
+    ecmascript::ThreadManagedScope managedScope(thread);
+    return JSNApiHelper::ToLocal<ArrayRef>(NewArrayFromBuffer(thread, buffer, length, ElementsKind::INT));
+}
+
+Local<ArrayRef> ArrayRef::NewFromDoubleBuffer(const EcmaVM *vm, const double *buffer, uint32_t length)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, JSValueRef::Undefined(vm));
+    ecmascript::ThreadManagedScope managedScope(thread);
+    return JSNApiHelper::ToLocal<ArrayRef>(NewArrayFromBuffer(thread, buffer, length, ElementsKind::NUMBER));
+}
+
+Local<ArrayRef> ArrayRef::NewFromUtf8Strings(const EcmaVM *vm, const char *const *strings, uint32_t length)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, JSValueRef::Undefined(vm));
+    ecmascript::ThreadManagedScope managedScope(thread);
+    if (length == 0) {
+        return JSNApiHelper::ToLocal<ArrayRef>(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
+    }
+    ObjectFactory *factory = vm->GetFactory();
+    JSHandle<TaggedArray> elements = factory->NewTaggedArray(length);
+    for (uint32_t i = 0; i < length; i++) {
+        JSHandle<EcmaString> str = factory->NewFromUtf8(strings[i]);
+        elements->Set(thread, i, str.GetTaggedValue());
+    }
+    JSHandle<JSArray> array = factory->NewJSStableArrayWithElements(elements);
+    if (thread->IsEnableElementsKind()) {
+        JSHClass::TransitToElementsKindUncheck(thread, JSHandle<JSObject>(array), ElementsKind::STRING);
+    }
+    return JSNApiHelper::ToLocal<ArrayRef>(JSHandle<JSTaggedValue>(array));
+}
+
+bool ArrayRef::CopyToInt32Buffer(const EcmaVM *vm, int32_t *buffer, uint32_t length)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
+    ecmascript::ThreadManagedScope managedScope(thread);
+    return CopyArrayToBuffer(thread, JSNApiHelper::ToJSHandle(this), buffer, length,
+        [](JSTaggedValue value, int32_t &result) {
+            if (value.IsInt()) {
+                result = value.GetInt();
+                return true;
+            }
+            if (!value.IsDouble()) {
+                return false;
+            }
+            double number = value.GetDouble();
+            if (!(number >= std::numeric_limits<int32_t>::min() && number <= std::numeric_limits<int32_t>::max()) ||
+                static_cast<int32_t>(number) != number) {
+                return false;
+            }
+            result = static_cast<int32_t>(number);
+            return true;
+        });
+}
+
+bool ArrayRef::CopyToDoubleBuffer(const EcmaVM *vm, double *buffer, uint32_t length)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
+    ecmascript::ThreadManagedScope managedScope(thread);
+    return CopyArrayToBuffer(thread, JSNApiHelper::ToJSHandle(this), buffer, length,
+        [](JSTaggedValue value, double &result) {
+            if (!value.IsNumber()) {
+                return false;
+            }
+            result = value.GetNumber();
+            return true;
+        });
+}
+
 // ----------------------------------- SendableArrayRef ----------------------------------------
 Local<SendableArrayRef> SendableArrayRef::New(const EcmaVM *vm, uint32_t length)
 {
@@ -5447,6 +5704,41 @@ size_t JSNApi::GetEcmaVMExpectedMemoryReclamationSize(const EcmaVM *vm)
     return vm->GetHeap()->GetIdleGCTrigger()->GetExpectedMemoryReclamationSize();
 }
 
+bool JSNApi::SetExternalMemory(const EcmaVM *vm, Local<JSValueRef> object, size_t externalSize,
+                               size_t retainedSize, const std::string &module)
+{
+    CROSS_THREAD_AND_EXCEPTION_CHECK_WITH_RETURN(vm, false);
+    ecmascript::ThreadManagedScope managedScope(thread);
+    JSTaggedValue value = JSNApiHelper::ToJSTaggedValue(*object);
+    if (!value.IsHeapObject()) {
+        LOG_ECMA(ERROR) << "external memory can only be attributed to heap objects";
+        return false;
+    }
+    ecmascript::Heap *heap = const_cast<ecmascript::Heap *>(vm->GetHeap());
+    return heap->RegisterExternalMemory(value.GetTaggedObject(), externalSize, retainedSize, module.c_str());
+}
+
+void JSNApi::SetNativeModuleMemoryBudget(const EcmaVM *vm, const std::string &module, size_t budget)
+{
+    CROSS_THREAD_CHECK(vm);
+    const_cast<ecmascript::Heap *>(vm->GetHeap())->SetExternalMemoryBudget(module.c_str(), budget);
+}
+
+size_t JSNApi::GetNativeModuleMemorySize(const EcmaVM *vm, const std::string &module)
+{
+    CROSS_THREAD_CHECK(vm);
+    return vm->GetHeap()->GetExternalMemoryTracker()->GetModuleSize(module.c_str());
+}
+
+size_t JSNApi::GetExternalMemorySize(const EcmaVM *vm)
+{
+    if (vm == nullptr) {
+        LOG_ECMA(ERROR) << "get external memory size but vm is nullptr";
+        return 0;
+    }
+    return vm->GetHeap()->GetExternalMemorySize();
+}
+
 void JSNApi::SetStartIdleMonitorCallback(const StartIdleMonitorCallback& callback)
 {
     startIdleMonitorCallback_ = callback;
@@ -208,6 +208,20 @@ private:
 class Callback {
 public:
     static ecmascript::JSTaggedValue RegisterCallback(ecmascript::EcmaRuntimeCallInfo *ecmaRuntimeCallInfo);
+    static ecmascript::JSTaggedValue RegisterFastCallback(ecmascript::EcmaRuntimeCallInfo *ecmaRuntimeCallInfo);
+    // The fast path of RegisterFastCallback for callers which have the arguments at hand, e.g. the call stubs. It
+    // returns Hole when the arguments do not match the signature of function, the caller then takes the generic path.
+    static ecmascript::JSTaggedValue CallFastFunction(ecmascript::JSThread *thread,
+                                                      ecmascript::JSFunctionBase *function, uint32_t argc,
+                                                      const ecmascript::JSTaggedValue *argv, bool hasNativeFrame);
+
+private:
+    static ecmascript::JSTaggedValue CallFunctionCallback(ecmascript::JSThread *thread,
+                                                          const ecmascript::JSHandle<ecmascript::JSFunctionBase> &func,
+                                                          FunctionCallback nativeFunc,
+                                                          ecmascript::EcmaRuntimeCallInfo *ecmaRuntimeCallInfo);
+    static bool UnboxFastCallArg(ecmascript::JSTaggedValue arg, FastCallType type, FastCallValue &value);
+    static ecmascript::JSTaggedValue BoxFastCallResult(FastCallType type, const FastCallValue &value);
 };
 }  // namespace panda
 #endif  // ECMASCRIPT_NAPI_JSNAPI_HELPER_H
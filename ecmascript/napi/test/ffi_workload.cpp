@@ -7962,6 +7962,31 @@ HWTEST_F_L0(JSNApiSplTest, FunctionRef_Call2)
     TEST_TIME(FunctionRef::Call::StringRef);
 }
 
+HWTEST_F_L0(JSNApiSplTest, FunctionRef_Call_FastCall)
+{
+    LocalScope scope(vm_);
+    CalculateForTime();
+    static FastCallInfo info;
+    info.slowFunc = FunCallback;
+    info.fastFunc = [](void *, const FastCallValue *args) -> FastCallValue {
+        FastCallValue result;
+        result.i32 = args[0].i32 + 1;
+        return result;
+    };
+    info.returnType = FastCallType::INT32;
+    info.argCount = 1;
+    info.argTypes[0] = FastCallType::INT32;
+    std::vector<Local<JSValueRef>> argumentsInt;
+    argumentsInt.emplace_back(IntegerRef::New(vm_, 123)); // 123 = random number
+    Local<FunctionRef> callback = FunctionRef::NewFastCall(vm_, &info);
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        callback->Call(vm_, JSValueRef::Undefined(vm_), argumentsInt.data(), argumentsInt.size());
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(FunctionRef::Call::FastCall);
+}
+
 HWTEST_F_L0(JSNApiSplTest, FunctionRef_Constructor)
 {
     LocalScope scope(vm_);
@@ -61,6 +61,7 @@
 #include "ecmascript/pgo_profiler/pgo_profiler_decoder.h"
 #include "ecmascript/pgo_profiler/pgo_profiler_encoder.h"
 #include "ecmascript/pgo_profiler/pgo_profiler_manager.h"
+#include "ecmascript/stubs/runtime_stubs.h"
 #include "ecmascript/tagged_array.h"
 #include "ecmascript/tests/test_helper.h"
 #include "ecmascript/tagged_tree.h"
@@ -5385,6 +5386,198 @@ HWTEST_F_L0(JSNApiTests, GetGlobalHandleCount_005)
     vm_->SetEnableForceGC(true);
 }
 
+HWTEST_F_L0(JSNApiTests, SetExternalMemory)
+{
+    constexpr size_t externalSize = 1024 * 1024;
+    const std::string module = "libexternal_test.so";
+    vm_->SetEnableForceGC(false);
+    size_t sizeBefore = JSNApi::GetExternalMemorySize(vm_);
+    JSNApi::SetNativeModuleMemoryBudget(vm_, module, 3 * externalSize);
+    {
+        LocalScope scope(vm_);
+        Global<ObjectRef> alive(vm_, ObjectRef::New(vm_));
+        Local<ObjectRef> dead = ObjectRef::New(vm_);
+        EXPECT_TRUE(JSNApi::SetExternalMemory(vm_, alive.ToLocal(vm_), externalSize, 0, module));
+        // the retained estimate is what gets charged when it is larger
+        EXPECT_TRUE(JSNApi::SetExternalMemory(vm_, dead, externalSize, 2 * externalSize, module));
+        EXPECT_EQ(JSNApi::GetNativeModuleMemorySize(vm_, module), 3 * externalSize);
+        EXPECT_EQ(JSNApi::GetExternalMemorySize(vm_), sizeBefore + 3 * externalSize);
+        // re-registering replaces the previous size and goes over budget
+        EXPECT_FALSE(JSNApi::SetExternalMemory(vm_, dead, 3 * externalSize, 0, module));
+        EXPECT_EQ(JSNApi::GetNativeModuleMemorySize(vm_, module), 4 * externalSize);
+        EXPECT_FALSE(JSNApi::SetExternalMemory(vm_, JSValueRef::Undefined(vm_), externalSize));
+
+        vm_->CollectGarbage(TriggerGCType::YOUNG_GC);
+        EXPECT_EQ(JSNApi::GetNativeModuleMemorySize(vm_, module), 4 * externalSize);
+        vm_->CollectGarbage(TriggerGCType::FULL_GC);
+        EXPECT_EQ(JSNApi::GetNativeModuleMemorySize(vm_, module), 4 * externalSize);
+        alive.FreeGlobalHandleAddr();
+    }
+    vm_->CollectGarbage(TriggerGCType::FULL_GC);
+    EXPECT_EQ(JSNApi::GetNativeModuleMemorySize(vm_, module), 0U);
+    EXPECT_EQ(JSNApi::GetExternalMemorySize(vm_), sizeBefore);
+    vm_->SetEnableForceGC(true);
+}
+
+HWTEST_F_L0(JSNApiTests, NewFastCall)
+{
+    LocalScope scope(vm_);
+    static FastCallInfo addInfo;
+    addInfo.slowFunc = [](JsiRuntimeCallInfo *runtimeInfo) -> Local<JSValueRef> {
+        (*static_cast<int *>(runtimeInfo->GetData()))++;
+        return IntegerRef::New(runtimeInfo->GetVM(), -1);
+    };
+    addInfo.fastFunc = [](void *, const FastCallValue *args) -> FastCallValue {
+        FastCallValue result;
+        result.i32 = args[0].i32 + args[1].i32;
+        return result;
+    };
+    addInfo.returnType = FastCallType::INT32;
+    addInfo.argCount = 2;  // 2: a + b
+    addInfo.argTypes[0] = FastCallType::INT32;
+    addInfo.argTypes[1] = FastCallType::INT32;
+    int slowCalls = 0;
+    Local<FunctionRef> add = FunctionRef::NewFastCall(vm_, &addInfo, nullptr, &slowCalls);
+
+    Local<JSValueRef> intArgs[] = {IntegerRef::New(vm_, 1), NumberRef::New(vm_, 2.0)};
+    EXPECT_EQ(add->Call(vm_, JSValueRef::Undefined(vm_), intArgs, 2)->Int32Value(vm_), 3);
+    EXPECT_EQ(slowCalls, 0);
+    // a fraction or too few arguments take the slow function
+    Local<JSValueRef> doubleArgs[] = {IntegerRef::New(vm_, 1), NumberRef::New(vm_, 2.5)};
+    EXPECT_EQ(add->Call(vm_, JSValueRef::Undefined(vm_), doubleArgs, 2)->Int32Value(vm_), -1);
+    EXPECT_EQ(add->Call(vm_, JSValueRef::Undefined(vm_), intArgs, 1)->Int32Value(vm_), -1);
+    EXPECT_EQ(slowCalls, 2);  // 2: the calls above
+
+    static FastCallInfo lengthInfo;
+    lengthInfo.slowFunc = addInfo.slowFunc;
+    lengthInfo.fastFunc = [](void *, const FastCallValue *args) -> FastCallValue {
+        FastCallValue result;
+        result.f64 = args[0].str.length;
+        return result;
+    };
+    lengthInfo.returnType = FastCallType::DOUBLE;
+    lengthInfo.argCount = 1;
+    lengthInfo.argTypes[0] = FastCallType::STRING;
+    Local<FunctionRef> length = FunctionRef::NewFastCall(vm_, &lengthInfo, nullptr, &slowCalls);
+    Local<JSValueRef> stringArgs[] = {StringRef::NewFromUtf8(vm_, "fast")};
+    EXPECT_EQ(length->Call(vm_, JSValueRef::Undefined(vm_), stringArgs, 1)->Int32Value(vm_), 4);
+    Local<JSValueRef> utf16Args[] = {StringRef::NewFromUtf16(vm_, u"\u4e2d\u6587")};
+    EXPECT_EQ(length->Call(vm_, JSValueRef::Undefined(vm_), utf16Args, 1)->Int32Value(vm_), -1);
+    EXPECT_EQ(slowCalls, 3);  // 3: one more slow call
+}
+
+HWTEST_F_L0(JSNApiTests, NewFastCallFromCallStubs)
+{
+    LocalScope scope(vm_);
+    static FastCallInfo info;
+    info.slowFunc = [](JsiRuntimeCallInfo *runtimeInfo) -> Local<JSValueRef> {
+        return IntegerRef::New(runtimeInfo->GetVM(), -1);
+    };
+    info.fastFunc = [](void *data, const FastCallValue *args) -> FastCallValue {
+        (*static_cast<int *>(data))++;
+        FastCallValue result;
+        result.f64 = args[0].f64 * args[1].i32;
+        return result;
+    };
+    info.returnType = FastCallType::DOUBLE;
+    info.argCount = 2;  // 2: x * n
+    info.argTypes[0] = FastCallType::DOUBLE;
+    info.argTypes[1] = FastCallType::INT32;
+    int fastCalls = 0;
+    Local<FunctionRef> mul = FunctionRef::NewFastCall(vm_, &info, nullptr, &fastCalls);
+    JSTaggedValue func = JSNApiHelper::ToJSTaggedValue(*mul);
+    // the call stubs only take the shortcut for functions with the flag
+    EXPECT_TRUE(JSFunctionBase::Cast(func.GetTaggedObject())->IsFastNativeCall());
+    Local<FunctionRef> plain = FunctionRef::New(vm_, info.slowFunc);
+    EXPECT_FALSE(JSFunctionBase::Cast(JSNApiHelper::ToJSTaggedValue(*plain).GetTaggedObject())->IsFastNativeCall());
+
+    uintptr_t glue = thread_->GetGlueAddr();
+    JSTaggedType undefined = JSTaggedValue::Undefined().GetRawData();
+    JSTaggedValue result = RuntimeStubs::CallFastNativeFunction(glue, func.GetRawData(), 2,  // 2: two arguments
+        JSTaggedValue(1.5).GetRawData(), JSTaggedValue(4).GetRawData(), undefined);  // 4: n
+    EXPECT_EQ(result.GetNumber(), 6.0);
+    EXPECT_EQ(fastCalls, 1);
+    // too few or mismatching arguments are left to the native entry
+    EXPECT_TRUE(RuntimeStubs::CallFastNativeFunction(glue, func.GetRawData(), 1,
+        JSTaggedValue(1.5).GetRawData(), undefined, undefined).IsHole());
+    EXPECT_TRUE(RuntimeStubs::CallFastNativeFunction(glue, func.GetRawData(), 2,  // 2: two arguments
+        JSTaggedValue(1.5).GetRawData(), JSTaggedValue(0.5).GetRawData(), undefined).IsHole());
+    EXPECT_EQ(fastCalls, 1);
+}
+
+HWTEST_F_L0(JSNApiTests, GetAndSetProperties)
+{
+    LocalScope scope(vm_);
+    Local<JSValueRef> keys[] = {StringRef::NewFromUtf8(vm_, "x"), StringRef::NewFromUtf8(vm_, "y"),
+                                StringRef::NewFromUtf8(vm_, "z")};
+    Local<JSValueRef> values[] = {IntegerRef::New(vm_, 1), NumberRef::New(vm_, 2.5), StringRef::NewFromUtf8(vm_, "s")};
+    PropertyBatchCache cache;
+    Local<ObjectRef> first = ObjectRef::New(vm_);
+    Local<ObjectRef> second = ObjectRef::New(vm_);
+    // the first call adds the properties, the second finds them in the cached layout entries
+    EXPECT_TRUE(first->SetProperties(vm_, 3, keys, values, &cache));  // 3: number of keys
+    EXPECT_TRUE(second->SetProperties(vm_, 3, keys, values, &cache));  // 3: number of keys
+    values[0] = IntegerRef::New(vm_, 7);  // 7: new value of x
+    EXPECT_TRUE(second->SetProperties(vm_, 3, keys, values, &cache));  // 3: number of keys
+
+    Local<JSValueRef> results[3];  // 3: number of keys
+    EXPECT_TRUE(first->GetProperties(vm_, 3, keys, results, &cache));  // 3: number of keys
+    EXPECT_EQ(results[0]->Int32Value(vm_), 1);
+    EXPECT_TRUE(second->GetProperties(vm_, 3, keys, results, &cache));  // 3: number of keys
+    EXPECT_EQ(results[0]->Int32Value(vm_), 7);
+    EXPECT_EQ(results[1]->ToNumber(vm_)->Value(), 2.5);
+    EXPECT_TRUE(results[2]->IsString(vm_));
+
+    // a missing own property is looked up on the prototype chain
+    Local<JSValueRef> otherKeys[] = {StringRef::NewFromUtf8(vm_, "toString")};
+    EXPECT_TRUE(second->GetProperties(vm_, 1, otherKeys, results, &cache));
+    EXPECT_TRUE(results[0]->IsFunction(vm_));
+}
+
+HWTEST_F_L0(JSNApiTests, GetAndSetPropertiesOfAOTHClass)
+{
+    LocalScope scope(vm_);
+    Local<JSValueRef> keys[] = {StringRef::NewFromUtf8(vm_, "aotBatchA"), StringRef::NewFromUtf8(vm_, "aotBatchB")};
+    Local<JSValueRef> values[] = {IntegerRef::New(vm_, 1), NumberRef::New(vm_, 2.5)};
+    PropertyBatchCache cache;
+    Local<ObjectRef> object = ObjectRef::New(vm_);
+    EXPECT_TRUE(object->SetProperties(vm_, 2, keys, values, &cache));  // 2: number of keys
+    // the entries cached above must not be used once the hclass is an aot one
+    JSNApiHelper::ToJSTaggedValue(*object).GetTaggedObject()->GetClass()->SetAOT(true);
+    values[0] = IntegerRef::New(vm_, 3);  // 3: new value of aotBatchA
+    EXPECT_TRUE(object->SetProperties(vm_, 2, keys, values, &cache));  // 2: number of keys
+
+    Local<JSValueRef> results[2];  // 2: number of keys
+    EXPECT_TRUE(object->GetProperties(vm_, 2, keys, results, &cache));  // 2: number of keys
+    EXPECT_EQ(results[0]->Int32Value(vm_), 3);
+    EXPECT_EQ(results[1]->ToNumber(vm_)->Value(), 2.5);
+}
+
+HWTEST_F_L0(JSNApiTests, ArrayBufferCopy)
+{
+    LocalScope scope(vm_);
+    int32_t ints[] = {1, -2, 3};
+    Local<ArrayRef> intArray = ArrayRef::NewFromInt32Buffer(vm_, ints, 3);  // 3: length of ints
+    EXPECT_EQ(intArray->Length(vm_), 3U);
+    EXPECT_EQ(ArrayRef::GetValueAt(vm_, intArray, 1)->Int32Value(vm_), -2);
+    int32_t intResult[3] = {0};  // 3: length of ints
+    EXPECT_TRUE(intArray->CopyToInt32Buffer(vm_, intResult, 3));  // 3: length of ints
+    EXPECT_EQ(intResult[2], 3);
+    EXPECT_FALSE(intArray->CopyToInt32Buffer(vm_, intResult, 4));  // 4: more than the length
+
+    double doubles[] = {0.5, 2};
+    Local<ArrayRef> doubleArray = ArrayRef::NewFromDoubleBuffer(vm_, doubles, 2);  // 2: length of doubles
+    double doubleResult[2] = {0};  // 2: length of doubles
+    EXPECT_TRUE(doubleArray->CopyToDoubleBuffer(vm_, doubleResult, 2));  // 2: length of doubles
+    EXPECT_EQ(doubleResult[0], 0.5);
+    EXPECT_FALSE(doubleArray->CopyToInt32Buffer(vm_, intResult, 2));  // 2: length of doubles
+
+    const char *strings[] = {"a", "bc"};
+    Local<ArrayRef> stringArray = ArrayRef::NewFromUtf8Strings(vm_, strings, 2);  // 2: length of strings
+    EXPECT_EQ(ArrayRef::GetValueAt(vm_, stringArray, 1)->ToString(vm_)->ToString(vm_), "bc");
+    EXPECT_FALSE(stringArray->CopyToDoubleBuffer(vm_, doubleResult, 2));  // 2: length of strings
+}
+
 class JSNApiGlobalLeakCheckTests : public testing::Test {
 public:
     static void SetUpTestCase()
@@ -932,6 +932,12 @@ void PGOProfiler::ProfileBytecode(ApEntityId abcId, const CString& recordName, J
                 DumpInstanceof(abcId, recordName, methodId, bcOffset, slotId, profileTypeInfo);
                 break;
             }
+            case EcmaOpcode::ISIN_IMM8_V8: {
+                uint8_t slotId = READ_INST_8_0();
+                CHECK_SLOTID_BREAK(slotId);
+                DumpIsIn(abcId, recordName, methodId, bcOffset, slotId, profileTypeInfo);
+                break;
+            }
             case EcmaOpcode::DEFINEGETTERSETTERBYVALUE_V8_V8_V8_V8:
             default:
                 break;
@@ -1498,6 +1504,7 @@ void PGOProfiler::DumpNewObjRange(ApEntityId abcId, const CString &recordName, E
         JSFunction *callee = JSFunction::Cast(slotValue);
         Method *calleeMethod = Method::Cast(callee->GetMethod(thread));
         ctorMethodId = static_cast<int>(calleeMethod->GetMethodId().GetOffset());
+        UpdateFinalObjSizeLayout(callee);
     } else {
         return;
     }
@@ -1528,20 +1535,85 @@ void PGOProfiler::DumpInstanceof(ApEntityId abcId, const CString &recordName, En
         TaggedObject *object = firstValue.GetWeakReferentUnChecked();
         if (object->GetClass()->IsHClass()) {
             JSHClass *hclass = JSHClass::Cast(object);
-            // Since pgo does not support symbol, we choose to return if hclass having @@hasInstance
-            JSHandle<GlobalEnv> env = GetCurrentGlobalEnv();
-            JSTaggedValue key = thread->GlobalConstants()->GetHasInstanceSymbol();
-            JSHClass *functionPrototypeHC = JSObject::Cast(env->GetFunctionPrototype().GetTaggedValue())->GetClass();
-            JSTaggedValue foundHClass = TryFindKeyInPrototypeChain(object, hclass, key);
-            if (!foundHClass.IsUndefined() && JSHClass::Cast(foundHClass.GetTaggedObject()) != functionPrototypeHC) {
+            if (HasCustomHasInstance(hclass)) {
                 return;
             }
             AddObjectInfo(abcId, recordName, methodId, bcOffset, hclass, hclass, hclass);
         }
         return;
     }
-    // Poly Not Consider now
-    return;
+    if (!firstValue.IsTaggedArray()) {
+        return;
+    }
+    // a poly site is only recorded if no constructor of it overrides @@hasInstance
+    auto array = TaggedArray::Cast(firstValue);
+    uint32_t length = array->GetLength();
+    for (uint32_t i = 0; i < length; i += 2) { // 2 means one ic, two slot
+        auto result = array->Get(thread, i);
+        if (!result.IsHeapObject() || !result.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = result.GetWeakReferentUnChecked();
+        if (object->GetClass()->IsHClass() && HasCustomHasInstance(JSHClass::Cast(object))) {
+            AddObjectInfoWithMega(abcId, recordName, methodId, bcOffset);
+            return;
+        }
+    }
+    for (uint32_t i = 0; i < length; i += 2) { // 2 means one ic, two slot
+        auto result = array->Get(thread, i);
+        if (!result.IsHeapObject() || !result.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = result.GetWeakReferentUnChecked();
+        if (!object->GetClass()->IsHClass()) {
+            continue;
+        }
+        JSHClass *hclass = JSHClass::Cast(object);
+        AddObjectInfo(abcId, recordName, methodId, bcOffset, hclass, hclass, hclass);
+    }
+}
+
+bool PGOProfiler::HasCustomHasInstance(JSHClass *hclass)
+{
+    // Since pgo does not support symbol, a constructor having its own @@hasInstance is not recorded
+    const JSThread *thread = vm_->GetJSThread();
+    JSHandle<GlobalEnv> env = GetCurrentGlobalEnv();
+    JSTaggedValue key = thread->GlobalConstants()->GetHasInstanceSymbol();
+    JSHClass *functionPrototypeHC = JSObject::Cast(env->GetFunctionPrototype().GetTaggedValue())->GetClass();
+    JSTaggedValue foundHClass = TryFindKeyInPrototypeChain(hclass, hclass, key);
+    return !foundHClass.IsUndefined() && JSHClass::Cast(foundHClass.GetTaggedObject()) != functionPrototypeHC;
+}
+
+void PGOProfiler::DumpIsIn(ApEntityId abcId, const CString &recordName, EntityId methodId, int32_t bcOffset,
+                           uint32_t slotId, ProfileTypeInfo *profileTypeInfo)
+{
+    const JSThread *thread = vm_->GetJSThread();
+    JSTaggedValue cacheValue = profileTypeInfo->GetICSlot(thread, slotId);
+    if (!cacheValue.IsHeapObject()) {
+        if (cacheValue.IsHole()) {
+            // Mega state
+            AddObjectInfoWithMega(abcId, recordName, methodId, bcOffset);
+        }
+        return;
+    }
+    if (!cacheValue.IsTaggedArray()) {
+        return;
+    }
+    // only the receiver hclasses are recorded, the compiler looks the key up in their layouts itself
+    auto array = TaggedArray::Cast(cacheValue);
+    uint32_t length = array->GetLength();
+    for (uint32_t i = 0; i < length; i += IsInICRuntime::ENTRY_SIZE) {
+        auto cachedHClass = array->Get(thread, i + IsInICRuntime::HCLASS_INDEX);
+        if (!cachedHClass.IsHeapObject() || !cachedHClass.IsWeak()) {
+            continue;
+        }
+        TaggedObject *object = cachedHClass.GetWeakReferentUnChecked();
+        if (!object->GetClass()->IsHClass()) {
+            continue;
+        }
+        JSHClass *hclass = JSHClass::Cast(object);
+        AddObjectInfo(abcId, recordName, methodId, bcOffset, hclass, hclass, hclass);
+    }
 }
 
 void PGOProfiler::UpdateLayout(JSHClass *hclass)
@@ -1572,6 +1644,26 @@ void PGOProfiler::UpdateLayout(JSHClass *hclass)
     }
 }
 
+void PGOProfiler::UpdateFinalObjSizeLayout(JSFunction *ctor)
+{
+    // Once slack tracking is finished, the instances of ctor are as large as the hclass with the most properties in
+    // the transition tree of its initial hclass. Recording the transitions up to that hclass lets aot code allocate
+    // instances of that size from the start, even if no profiled site saw an instance with all of its properties.
+    JSThread *thread = vm_->GetJSThread();
+    JSTaggedValue protoOrHClass = ctor->GetProtoOrHClass(thread);
+    if (!protoOrHClass.IsJSHClass()) {
+        return;
+    }
+    auto ihc = JSHClass::Cast(protoOrHClass.GetTaggedObject());
+    if (ihc->IsAOT() || ihc->IsObjSizeTrackingInProgress() || !GetProfileType(ihc, true).IsRootType()) {
+        return;
+    }
+    auto maxPropsHClass = JSHClass::VisitTransitionAndFindMaxPropsHClass(thread, ihc);
+    if (maxPropsHClass != ihc) {
+        UpdateLayout(maxPropsHClass);
+    }
+}
+
 void PGOProfiler::UpdateTransitionLayout(JSHClass* parent, JSHClass* child)
 {
     JSThread *thread = vm_->GetJSThread();
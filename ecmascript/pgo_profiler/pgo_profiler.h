@@ -208,7 +208,15 @@ private:
                         int32_t bcOffset,
                         uint32_t slotId,
                         ProfileTypeInfo* profileTypeInfo);
+    bool HasCustomHasInstance(JSHClass* hclass);
+    void DumpIsIn(ApEntityId abcId,
+                  const CString& recordName,
+                  EntityId methodId,
+                  int32_t bcOffset,
+                  uint32_t slotId,
+                  ProfileTypeInfo* profileTypeInfo);
     void UpdateLayout(JSHClass* hclass);
+    void UpdateFinalObjSizeLayout(JSFunction* ctor);
     void UpdateTransitionLayout(JSHClass* parent, JSHClass* child);
     bool AddTransitionObjectInfo(ProfileType recordType,
                                  EntityId methodId,
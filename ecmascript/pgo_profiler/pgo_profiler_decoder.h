@@ -115,6 +115,24 @@ public:
         recordSimpleInfos_->GetTypeInfo(GetNormalizedFileDesc(jsPandaFile), recordName, methodName, callback);
     }
 
+    // hit count of the method in the profile, 0 for a method that is not in it
+    uint32_t GetMethodCount(const JSPandaFile *jsPandaFile, const CString &recordName,
+                            const MethodLiteral *methodLiteral) const
+    {
+        if (!isLoaded_ || !isVerifySuccess_ || methodLiteral == nullptr) {
+            return 0;
+        }
+        const auto *methodName = MethodLiteral::GetMethodName(jsPandaFile, methodLiteral->GetMethodId());
+        if (IsMethodMatchEnabled()) {
+            auto checksum =
+                PGOMethodInfo::CalcChecksum(methodName, methodLiteral->GetBytecodeArray(),
+                                            MethodLiteral::GetCodeSize(jsPandaFile, methodLiteral->GetMethodId()));
+            return recordSimpleInfos_->GetMethodCount(GetNormalizedFileDesc(jsPandaFile), recordName, methodName,
+                                                      checksum);
+        }
+        return recordSimpleInfos_->GetMethodCount(GetNormalizedFileDesc(jsPandaFile), recordName, methodName);
+    }
+
     void MatchAndMarkMethod(const JSPandaFile *jsPandaFile, const CString &recordName, const char *methodName,
                             EntityId methodId)
     {
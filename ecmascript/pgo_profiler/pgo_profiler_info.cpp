@@ -524,6 +524,7 @@ bool PGOMethodIdSet::ParseFromBinary(PGOContext &context, void **buffer)
         auto ret = methodInfoMap_.try_emplace(info->GetMethodName(), chunk_);
         auto methodNameSetIter = ret.first;
         auto& methodInfo = methodNameSetIter->second.GetOrCreateMethodInfo(checksum, info->GetMethodId());
+        methodInfo.SetCount(info->GetCount());
         if (header->SupportType()) {
             methodInfo.GetPGOMethodTypeSet().ParseFromBinary(context, buffer, PGOProfilerEncoder::MAX_AP_FILE_SIZE);
         }
@@ -566,6 +567,7 @@ void PGODecodeMethodInfo::Merge(const PGODecodeMethodInfo &from)
         LOG_ECMA(ERROR) << "MethodId not match. " << methodId_ << " vs " << from.methodId_;
         return;
     }
+    count_ = std::min(count_ + from.count_, PGOMethodInfo::METHOD_MAX_HIT_COUNT);
     pgoMethodTypeSet_.Merge(&from.pgoMethodTypeSet_);
 }
 
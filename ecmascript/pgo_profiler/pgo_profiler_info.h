@@ -286,10 +286,22 @@ public:
         return pgoMethodTypeSet_;
     }
 
+    uint32_t GetCount() const
+    {
+        return count_;
+    }
+
+    void SetCount(uint32_t count)
+    {
+        count_ = count;
+    }
+
     void Merge(const PGODecodeMethodInfo &from);
 
 private:
     PGOMethodId methodId_ {0};
+    // hit count of the method in the profile, capped at PGOMethodInfo::METHOD_MAX_HIT_COUNT
+    uint32_t count_ {0};
     PGOMethodTypeSet pgoMethodTypeSet_ {};
 };
 
@@ -404,6 +416,24 @@ public:
         LOG_ECMA(DEBUG) << "Method checksum mismatched, name: " << methodName;
     }
 
+    uint32_t GetMethodCount(const char *methodName)
+    {
+        auto iter = methodInfoMap_.find(methodName);
+        if ((iter != methodInfoMap_.end()) && (iter->second.GetFirstMethodInfo() != nullptr)) {
+            return iter->second.GetFirstMethodInfo()->GetCount();
+        }
+        return 0;
+    }
+
+    uint32_t GetMethodCount(const char *methodName, uint32_t checksum)
+    {
+        auto iter = methodInfoMap_.find(methodName);
+        if ((iter != methodInfoMap_.end()) && (iter->second.GetMethodInfo(checksum) != nullptr)) {
+            return iter->second.GetMethodInfo(checksum)->GetCount();
+        }
+        return 0;
+    }
+
     void MatchAndMarkMethod(const char *methodName, EntityId methodId)
     {
         const auto &iter = methodInfoMap_.find(methodName);
@@ -706,6 +736,33 @@ public:
         }
     }
 
+    uint32_t GetMethodCount(const CString &abcNormalizedDesc, const CString &recordName, const char *methodName)
+    {
+        auto abcMethodIds = methodIds_.find(abcNormalizedDesc);
+        if (abcMethodIds == methodIds_.end()) {
+            return 0;
+        }
+        auto iter = abcMethodIds->second.find(recordName);
+        if (iter == abcMethodIds->second.end()) {
+            return 0;
+        }
+        return iter->second->GetMethodCount(methodName);
+    }
+
+    uint32_t GetMethodCount(const CString &abcNormalizedDesc, const CString &recordName, const char *methodName,
+                            uint32_t checksum)
+    {
+        auto abcMethodIds = methodIds_.find(abcNormalizedDesc);
+        if (abcMethodIds == methodIds_.end()) {
+            return 0;
+        }
+        auto iter = abcMethodIds->second.find(recordName);
+        if (iter == abcMethodIds->second.end()) {
+            return 0;
+        }
+        return iter->second->GetMethodCount(methodName, checksum);
+    }
+
     std::shared_ptr<PGOProtoTransitionPool> GetProtoTransitionPool() const
     {
         return protoTransitionPool_;
@@ -1708,4 +1708,24 @@ HWTEST_F_L0(PGOProfilerTest, ProcessToTextFileConsistencyTest)
     EXPECT_TRUE(content.find("100") != std::string::npos);
     EXPECT_TRUE(content.find("Checksum") != std::string::npos);
 }
+
+HWTEST_F_L0(PGOProfilerTest, DecodeMethodInfoMergeCountTest)
+{
+    PGODecodeMethodInfo info(PGOMethodId(1000));
+    PGODecodeMethodInfo other(PGOMethodId(1000));
+    info.SetCount(10);
+    other.SetCount(20);
+    info.Merge(other);
+    EXPECT_EQ(info.GetCount(), 30U);
+
+    other.SetCount(PGOMethodInfo::METHOD_MAX_HIT_COUNT);
+    info.Merge(other);
+    EXPECT_EQ(info.GetCount(), PGOMethodInfo::METHOD_MAX_HIT_COUNT);
+
+    // a method of another id is not merged
+    PGODecodeMethodInfo mismatch(PGOMethodId(2000));
+    mismatch.SetCount(5);
+    mismatch.Merge(other);
+    EXPECT_EQ(mismatch.GetCount(), 5U);
+}
 }  // namespace panda::test
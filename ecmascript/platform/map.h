@@ -101,6 +101,12 @@ MemMap PUBLIC_API MachineCodePageMap(size_t size, int prot = PAGE_PROT_NONE, siz
 void PUBLIC_API MachineCodePageUnmap(MemMap it);
 void PageRelease(void *mem, size_t size);
 void PUBLIC_API PagePreRead(void *mem, size_t size);
+// Ask the kernel to back the range with transparent huge pages, no-op if not supported.
+void PageAdviseHugePage(void *mem, size_t size);
+// Populate physical pages of a readable and writable range ahead of the first access.
+void PagePreFault(void *mem, size_t size);
+// Prefer physical pages of the range to be faulted in on the given NUMA node, no-op if not supported.
+void PagePreferNumaNode(void *mem, size_t size, int32_t node);
 void PageTag(void *mem, size_t size, PageTagType type, const std::string &spaceName = "",
              const uint32_t threadId = 0);
 void PageClearTag(void *mem, size_t size);
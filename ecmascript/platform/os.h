@@ -39,5 +39,11 @@ PUBLIC_API bool HasJitFortACL();
 void PUBLIC_API *PageMapExecFortSpace(void *addr, size_t size, int prot);
 bool CheckDiskSpace(const std::string& path, size_t requiredBytes);
 uint64_t PUBLIC_API GetDeviceValidSize(const std::string &path);
+// Minor and major page faults of the process so far, 0 if not supported.
+uint64_t GetPageFaultCount();
+// Counter of data TLB misses of the thread threadId of this process, 0 for the calling thread. -1 if not supported.
+int OpenDTLBMissCounter(uint32_t threadId = 0);
+uint64_t ReadDTLBMissCounter(int fd);
+void CloseDTLBMissCounter(int fd);
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_PLATFORM_OS_H
@@ -15,10 +15,13 @@
 
 #include "ecmascript/platform/os.h"
 
+#include <linux/perf_event.h>
 #include <malloc.h>
 #include <sys/mman.h>
 #include <sys/prctl.h>
 #include <sys/ptrace.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <sys/statfs.h>
 #include <sys/statvfs.h>
 #include <sys/xattr.h>
@@ -151,4 +154,46 @@ uint64_t GetDeviceValidSize(const std::string &path)
     }
     return (bfree * bsize) / (units * units);
 }
+
+uint64_t GetPageFaultCount()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(usage.ru_minflt) + static_cast<uint64_t>(usage.ru_majflt);
+}
+
+int OpenDTLBMissCounter(uint32_t threadId)
+{
+    struct perf_event_attr attr {};
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | // 8: op shift
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16); // 16: result shift
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    long fd = syscall(SYS_perf_event_open, &attr, static_cast<pid_t>(threadId), -1, -1, 0);
+    if (fd < 0) {
+        LOG_ECMA(DEBUG) << "Open dTLB miss counter of thread " << threadId << " failed, error code is " << errno;
+        return -1;
+    }
+    return static_cast<int>(fd);
+}
+
+uint64_t ReadDTLBMissCounter(int fd)
+{
+    uint64_t count = 0;
+    if (fd < 0 || read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+        return 0;
+    }
+    return count;
+}
+
+void CloseDTLBMissCounter(int fd)
+{
+    if (fd >= 0) {
+        close(fd);
+    }
+}
 }  // namespace panda::ecmascript
@@ -96,4 +96,23 @@ uint64_t GetDeviceValidSize(const std::string &path)
 {
     return 0;
 }
+
+uint64_t GetPageFaultCount()
+{
+    return 0;
+}
+
+int OpenDTLBMissCounter([[maybe_unused]] uint32_t threadId)
+{
+    return -1;
+}
+
+uint64_t ReadDTLBMissCounter([[maybe_unused]] int fd)
+{
+    return 0;
+}
+
+void CloseDTLBMissCounter([[maybe_unused]] int fd)
+{
+}
 }  // namespace panda::ecmascript
@@ -15,6 +15,7 @@
 
 #include "ecmascript/platform/map.h"
 
+#include <limits>
 #include <sys/mman.h>
 #include <sys/syscall.h>
 #include <unistd.h>
@@ -125,6 +126,48 @@ void PagePreRead(void *mem, size_t size)
     madvise(mem, size, MADV_WILLNEED);
 }
 
+void PageAdviseHugePage([[maybe_unused]] void *mem, [[maybe_unused]] size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    if (madvise(mem, size, MADV_HUGEPAGE) != 0) {
+        LOG_ECMA(DEBUG) << "PageAdviseHugePage mem = " << mem << ", size = " << size
+                        << " failed, error code is " << errno;
+    }
+#endif
+}
+
+void PagePreFault(void *mem, size_t size)
+{
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(mem, size, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    // Fallback for old kernels, rewrite one byte per page to fault it in without changing the content.
+    size_t pageSize = PageSize();
+    uintptr_t start = reinterpret_cast<uintptr_t>(mem);
+    for (uintptr_t addr = start; addr < start + size; addr += pageSize) {
+        volatile uint8_t *byte = reinterpret_cast<volatile uint8_t *>(addr);
+        *byte = *byte;
+    }
+}
+
+void PagePreferNumaNode([[maybe_unused]] void *mem, [[maybe_unused]] size_t size, [[maybe_unused]] int32_t node)
+{
+#ifdef SYS_mbind
+    static constexpr int MPOL_PREFERRED_MODE = 1;
+    static constexpr size_t NODE_MASK_BITS = std::numeric_limits<unsigned long>::digits;
+    if (node < 0 || static_cast<size_t>(node) >= NODE_MASK_BITS) {
+        return;
+    }
+    unsigned long nodeMask = 1UL << static_cast<uint32_t>(node);
+    if (syscall(SYS_mbind, mem, size, MPOL_PREFERRED_MODE, &nodeMask, NODE_MASK_BITS + 1, 0) != 0) {
+        LOG_ECMA(DEBUG) << "PagePreferNumaNode mem = " << mem << ", size = " << size << ", node = " << node
+                        << " failed, error code is " << errno;
+    }
+#endif
+}
+
 void PageTag(void *mem, size_t size, PageTagType type, [[maybe_unused]] const std::string &spaceName,
     [[maybe_unused]] const uint32_t threadId)
 {
@@ -90,6 +90,18 @@ void PagePreRead([[maybe_unused]] void *mem, [[maybe_unused]] size_t size)
 {
 }
 
+void PageAdviseHugePage([[maybe_unused]] void *mem, [[maybe_unused]] size_t size)
+{
+}
+
+void PagePreFault([[maybe_unused]] void *mem, [[maybe_unused]] size_t size)
+{
+}
+
+void PagePreferNumaNode([[maybe_unused]] void *mem, [[maybe_unused]] size_t size, [[maybe_unused]] int32_t node)
+{
+}
+
 void PageTag([[maybe_unused]] void *mem, [[maybe_unused]] size_t size, [[maybe_unused]] PageTagType type,
              [[maybe_unused]] const std::string &spaceName, [[maybe_unused]] const uint32_t threadId)
 {
@@ -99,6 +99,7 @@ void Runtime::CreateIfFirstVm(const JSRuntimeOptions &options)
         InitGCConfig(options);
         common::Log::Initialize(options.GetLogOptions());
         EcmaVM::InitializeIcuData(options);
+        MemMapAllocator::GetInstance()->SetEnableHugePage(options.EnableHeapHugePage());
         MemMapAllocator::GetInstance()->Initialize(ecmascript::DEFAULT_REGION_SIZE, options.GetLargeHeap());
         PGOProfilerManager::GetInstance()->Initialize(options.GetPGOProfilerPath(),
                                                       options.GetPGOHotnessThreshold());
@@ -69,6 +69,75 @@ void ArkStackMapParser::GetArkDeopt(uint8_t *stackmapAddr,
     ParseArkDeopt(callsiteHead, stackmapAddr, deopts);
 }
 
+// the parsed registers are the ones of the host, the builder expects the dwarf registers of the target triple
+static LLVMStackMapType::DwarfRegType GetDwarfReg(LLVMStackMapType::DwarfRegType reg, Triple triple)
+{
+    if (reg == GCStackMapRegisters::FP) {
+        return GCStackMapRegisters::GetFpRegByTriple(triple);
+    }
+    return GCStackMapRegisters::GetSpRegByTriple(triple);
+}
+
+void ArkStackMapParser::ParseCallSiteInfo(const CallsiteHeader& callsiteHead, uint8_t *ptr, Triple triple,
+                                          LLVMStackMapType::CallSiteInfo &callSiteInfo) const
+{
+    LLVMStackMapType::DwarfRegType reg;
+    LLVMStackMapType::OffsetType offsetType;
+    uint32_t offset = callsiteHead.stackmapOffsetInSMSec;
+    for (uint32_t j = 0; j < callsiteHead.stackmapNum; j++) {
+        auto [regOffset, regOffsetSize, isFull] =
+            panda::leb128::DecodeSigned<LLVMStackMapType::SLeb128Type>(ptr + offset);
+        bool isBaseDerivedEq = LLVMStackMapType::DecodeRegAndOffset(regOffset, reg, offsetType);
+        offset += regOffsetSize;
+        LLVMStackMapType::DwarfRegAndOffsetType info = std::make_pair(GetDwarfReg(reg, triple), offsetType);
+        callSiteInfo.emplace_back(info);
+        // the builder keeps a single entry for a base reference whose derived reference is itself
+        if (isBaseDerivedEq) {
+            callSiteInfo.emplace_back(info);
+        }
+    }
+}
+
+void ArkStackMapParser::CollectCallSiteInfos(uint8_t *stackmapAddr, uint32_t begin, uint32_t end, int64_t delta,
+                                             Triple triple, LLVMStackMapInfo &stackMapInfo) const
+{
+    ArkStackMapHeader *head = reinterpret_cast<ArkStackMapHeader *>(stackmapAddr);
+    ASSERT(head != nullptr);
+    uint32_t callsiteNum = head->callsiteNum;
+    CallsiteHeader *callsiteHead = reinterpret_cast<CallsiteHeader *>(stackmapAddr + sizeof(ArkStackMapHeader));
+    LLVMStackMapType::Pc2CallSiteInfo pc2CallSiteInfo;
+    LLVMStackMapType::Pc2Deopt pc2Deopt;
+    for (uint32_t i = 0; i < callsiteNum; i++) {
+        const CallsiteHeader &callsite = callsiteHead[i];
+        // the return address of a call ending the code is the end of it
+        if (callsite.calliteOffsetInTxtSec < begin || callsite.calliteOffsetInTxtSec > end) {
+            continue;
+        }
+        uintptr_t pc = static_cast<uintptr_t>(static_cast<int64_t>(callsite.calliteOffsetInTxtSec) + delta);
+        LLVMStackMapType::CallSiteInfo callSiteInfo;
+        ParseCallSiteInfo(callsite, stackmapAddr, triple, callSiteInfo);
+        pc2CallSiteInfo.emplace(pc, callSiteInfo);
+        if (callsite.deoptNum == 0) {
+            continue;
+        }
+        std::vector<ARKDeopt> deopts;
+        ParseArkDeopt(callsite, stackmapAddr, deopts);
+        LLVMStackMapType::DeoptInfoType deoptInfo;
+        for (ARKDeopt &deopt : deopts) {
+            deoptInfo.emplace_back(static_cast<LLVMStackMapType::IntType>(deopt.id));
+            if (deopt.kind == LocationTy::Kind::INDIRECT) {
+                auto [reg, offset] = std::get<LLVMStackMapType::DwarfRegAndOffsetType>(deopt.value);
+                deoptInfo.emplace_back(std::make_pair(GetDwarfReg(reg, triple), offset));
+            } else {
+                deoptInfo.emplace_back(deopt.value);
+            }
+        }
+        pc2Deopt.emplace(pc, deoptInfo);
+    }
+    stackMapInfo.AppendCallSiteInfo(pc2CallSiteInfo);
+    stackMapInfo.AppendDeoptInfo(pc2Deopt);
+}
+
 // implement simple binary-search is improve performance. if use std api, it'll trigger copy CallsiteHeader.
 int ArkStackMapParser::BinaraySearch(CallsiteHeader *callsiteHead, uint32_t callsiteNum, uintptr_t callSiteAddr) const
 {
@@ -59,6 +59,10 @@ public:
                                   uintptr_t callSiteAddr, uintptr_t callsiteFp,
                                   uintptr_t callSiteSp, uint8_t *stackmapAddr) const;
     void GetArkDeopt(uintptr_t callSiteAddr, uint8_t *stackmapAddr, std::vector<ARKDeopt>& deopts) const;
+    // converts the callsites whose offset in text is in [begin, end] back to llvm stackmap info, moving them by
+    // delta, so that code copied out of an old an file can be given stackmaps again in a new one
+    void CollectCallSiteInfos(uint8_t *stackmapAddr, uint32_t begin, uint32_t end, int64_t delta, Triple triple,
+                              LLVMStackMapInfo &stackMapInfo) const;
 
 private:
     static constexpr size_t DEOPT_ENTRY_SIZE = 2;
@@ -68,6 +72,8 @@ private:
     void GetArkDeopt(uint8_t *stackmapAddr, const CallsiteHeader& callsiteHead,
                      std::vector<ARKDeopt>& deopt) const;
     void ParseArkDeopt(const CallsiteHeader& callsiteHead, uint8_t *ptr, std::vector<ARKDeopt>& deopts) const;
+    void ParseCallSiteInfo(const CallsiteHeader& callsiteHead, uint8_t *ptr, Triple triple,
+                           LLVMStackMapType::CallSiteInfo &callSiteInfo) const;
 #ifndef NDEBUG
     void ParseArkStackMap(const CallsiteHeader& callsiteHead, uint8_t *ptr, ArkStackMap& stackMap) const;
     void ParseArkStackMapAndDeopt(uint8_t *ptr, uint32_t length) const;
@@ -111,7 +111,8 @@ namespace panda::ecmascript {
 #define ARKSTEED_TRAMPOLINE_LIST(V)                      \
     V(ArkSteedCallEntry)                                 \
     V(SteedCallAndPushArgv)                              \
-    V(SteedCallWithArgVAndPushArgv)
+    V(SteedCallWithArgVAndPushArgv)                      \
+    V(SteedOsrEntry)
 
 #define JS_CALL_TRAMPOLINE_LIST(V)           \
     V(CallRuntime)                           \
@@ -165,6 +166,7 @@ namespace panda::ecmascript {
     V(DebugPrintInstruction)                   \
     V(CollectingOpcodes)                       \
     V(DebugOsrEntry)                           \
+    V(FindOsrCodeEntry)                        \
     V(Comment)                                 \
     V(FatalPrint)                              \
     V(FatalPrintCustom)                        \
@@ -220,6 +222,7 @@ namespace panda::ecmascript {
     V(DoubleLexicographicCompare)              \
     V(FastArraySortString)                     \
     V(StringToNumber)                          \
+    V(CallFastNativeFunction)                  \
     V(StringGetStart)                          \
     V(StringGetEnd)                            \
     V(ArrayTrim)                               \
@@ -319,6 +322,7 @@ namespace panda::ecmascript {
     V(CreateClassWithBuffer)                                   \
     V(LoadICByName)                                            \
     V(LoadPrototype)                                           \
+    V(IsInIC)                                                  \
     V(StoreICByName)                                           \
     V(StoreOwnICByName)                                        \
     V(GetModuleNamespaceByIndex)                               \
@@ -483,6 +487,7 @@ namespace panda::ecmascript {
     V(RTSubstitution)                                          \
     V(NameDictionaryGetAllEnumKeys)                            \
     V(NumberDictionaryGetAllEnumKeys)                          \
+    V(GetEnumKeysSnapshot)                                     \
     V(PropertiesSetValue)                                      \
     V(NewEcmaHClass)                                           \
     V(UpdateLayOutAndAddTransition)                            \
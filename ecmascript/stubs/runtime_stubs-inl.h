@@ -458,6 +458,10 @@ JSTaggedValue RuntimeStubs::RuntimeCopyDataProperties(JSThread *thread, const JS
         // 2. Let from be ! ToObject(source).
         JSHandle<JSTaggedValue> from(JSTaggedValue::ToObject(thread, src));
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+        if (dst->IsJSObject() && from->IsJSObject() &&
+            JSObject::TryCopyDataPropertiesWithSameHClass(thread, JSHandle<JSObject>(dst), JSHandle<JSObject>(from))) {
+            return dst.GetTaggedValue();
+        }
         JSHandle<TaggedArray> keys = JSTaggedValue::GetOwnPropertyKeys(thread, from);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
 
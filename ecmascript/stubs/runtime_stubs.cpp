@@ -50,6 +50,7 @@
 #include "ecmascript/module/module_value_accessor.h"
 #include "ecmascript/module/module_message_helper.h"
 #include "ecmascript/module/module_path_helper.h"
+#include "ecmascript/napi/jsnapi_helper.h"
 #include "ecmascript/platform/time.h"
 #include "common_components/heap/allocator/region_desc.h"
 #include "common_components/mutator/mutator.h"
@@ -841,6 +842,30 @@ void RuntimeStubs::DebugOsrEntry([[maybe_unused]] uintptr_t argGlue, const uint8
     LOG_JIT(DEBUG) << "[OSR]: Enter OSR Code: " << reinterpret_cast<const void*>(codeEntry);
 }
 
+// Returns the entry of the OSR code compiled for the loop closed by the jump at osrOffset, or 0 if there is none yet
+uintptr_t RuntimeStubs::FindOsrCodeEntry(uintptr_t argGlue, JSTaggedType profileTypeInfo, int32_t osrOffset)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    auto thread = JSThread::GlueToJSThread(argGlue);
+    JSTaggedValue osrCodes = ProfileTypeInfo::Cast(JSTaggedValue(profileTypeInfo).GetTaggedObject())->GetJitOsr(thread);
+    if (!osrCodes.IsTaggedArray()) {
+        return 0;
+    }
+    TaggedArray *codes = TaggedArray::Cast(osrCodes.GetTaggedObject());
+    for (uint32_t i = 0; i < codes->GetLength(); i++) {
+        JSTaggedValue value = codes->Get(thread, i);
+        if (!value.IsMachineCodeObject()) {
+            continue;
+        }
+        MachineCode *machineCode = MachineCode::Cast(value.GetTaggedObject());
+        if (machineCode->GetOSROffset() == osrOffset && !machineCode->IsOsrDeopt()) {
+            LOG_JIT(DEBUG) << "[OSR]: Enter OSR Code: " << reinterpret_cast<void *>(machineCode->GetFuncAddr());
+            return machineCode->GetFuncAddr();
+        }
+    }
+    return 0;
+}
+
 void RuntimeStubs::Comment(uintptr_t argStr)
 {
     std::string str(reinterpret_cast<char *>(argStr));
@@ -1803,6 +1828,21 @@ DEF_RUNTIME_STUBS(LoadPrototype)
     return result.GetRawData();
 }
 
+DEF_RUNTIME_STUBS(IsInIC)
+{
+    RUNTIME_STUBS_HEADER(IsInIC);
+    JSHandle<JSTaggedValue> profileHandle = GetHArg<JSTaggedValue>(argv, argc, 0);  // 0: means the zeroth parameter
+    JSHandle<JSTaggedValue> prop = GetHArg<JSTaggedValue>(argv, argc, 1);  // 1: means the first parameter
+    JSHandle<JSTaggedValue> obj = GetHArg<JSTaggedValue>(argv, argc, 2);  // 2: means the second parameter
+    JSTaggedValue slotId = GetArg(argv, argc, 3);  // 3: means the third parameter
+
+    if (profileHandle->IsUndefined()) {
+        return RuntimeIsIn(thread, prop, obj).GetRawData();
+    }
+    IsInICRuntime icRuntime(thread, JSHandle<ProfileTypeInfo>::Cast(profileHandle), slotId.GetInt());
+    return icRuntime.IsInMiss(prop, obj).GetRawData();
+}
+
 DEF_RUNTIME_STUBS(TryLdGlobalICByName)
 {
     RUNTIME_STUBS_HEADER(TryLdGlobalICByName);
@@ -4207,6 +4247,13 @@ DEF_RUNTIME_STUBS(NumberDictionaryGetAllEnumKeys)
     return JSTaggedValue::Undefined().GetRawData();
 }
 
+DEF_RUNTIME_STUBS(GetEnumKeysSnapshot)
+{
+    RUNTIME_STUBS_HEADER(GetEnumKeysSnapshot);
+    JSHandle<JSObject> obj = GetHArg<JSObject>(argv, argc, 0);  // 0: means the zeroth parameter
+    return JSObject::GetEnumKeysSnapshot(thread, obj).GetRawData();
+}
+
 DEF_RUNTIME_STUBS(NumberToString)
 {
     RUNTIME_STUBS_HEADER(NumberToString);
@@ -4314,6 +4361,18 @@ JSTaggedValue RuntimeStubs::StringToNumber(uintptr_t argGlue, JSTaggedType numbe
     return base::NumberHelper::StringToNumber(JSThread::GlueToJSThread(argGlue), input, radix);
 }
 
+JSTaggedValue RuntimeStubs::CallFastNativeFunction(uintptr_t argGlue, JSTaggedType func, int32_t argc,
+                                                   JSTaggedType arg0, JSTaggedType arg1, JSTaggedType arg2)
+{
+    DISALLOW_GARBAGE_COLLECTION;
+    auto thread = JSThread::GlueToJSThread(argGlue);
+    std::array<JSTaggedValue, 3> argv = {  // 3: at most three arguments come from the call stubs
+        JSTaggedValue(arg0), JSTaggedValue(arg1), JSTaggedValue(arg2)
+    };
+    JSFunctionBase *function = JSFunctionBase::Cast(JSTaggedValue(func).GetTaggedObject());
+    return panda::Callback::CallFastFunction(thread, function, static_cast<uint32_t>(argc), argv.data(), false);
+}
+
 void RuntimeStubs::ArrayTrim(uintptr_t argGlue, TaggedArray *array, int64_t newLength)
 {
     DISALLOW_GARBAGE_COLLECTION;
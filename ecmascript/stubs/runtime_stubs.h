@@ -98,6 +98,7 @@ public:
     static void DebugPrintInstruction([[maybe_unused]] uintptr_t argGlue, const uint8_t *pc);
     static void CollectingOpcodes([[maybe_unused]] uintptr_t argGlue, const uint8_t *pc);
     static void DebugOsrEntry([[maybe_unused]] uintptr_t argGlue, const uint8_t *codeEntry);
+    static uintptr_t FindOsrCodeEntry(uintptr_t argGlue, JSTaggedType profileTypeInfo, int32_t osrOffset);
     static void Comment(uintptr_t argStr);
     static void FatalPrint(int fmtMessageId, ...);
     static void FatalPrintCustom(uintptr_t fmt, ...);
@@ -163,6 +164,8 @@ public:
     static int DoubleLexicographicCompare(JSTaggedType x, JSTaggedType y);
     static int FastArraySortString(uintptr_t argGlue, JSTaggedValue x, JSTaggedValue y);
     static JSTaggedValue StringToNumber(uintptr_t argGlue, JSTaggedType numberString, int32_t radix);
+    static JSTaggedValue CallFastNativeFunction(uintptr_t argGlue, JSTaggedType func, int32_t argc,
+                                                JSTaggedType arg0, JSTaggedType arg1, JSTaggedType arg2);
     static void ArrayTrim(uintptr_t argGlue, TaggedArray *array, int64_t newLength);
     static double TimeClip(double time);
     static double CalcTimeValue(double year, double month, double day);
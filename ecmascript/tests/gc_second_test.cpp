@@ -72,6 +72,8 @@ public:
     using GCStats::MergeGCStatistic;
     using GCStats::RecordGCStatisticEnd;
     using GCStats::RecordGCStatisticStart;
+    using GCStats::RecordMemoryCountersAfterGC;
+    using GCStats::RecordMemoryCountersBeforeGC;
     using GCStats::SetRecordDuration;
 
     void SetGCTypeForTest(GCType type)
@@ -1276,4 +1278,48 @@ HWTEST_F_L0(GCTest, IsLongGCTest004)
     EXPECT_TRUE(stats.IsLongGC(GCReason::IDLE_NATIVE, false, true,
         static_cast<float>(GCKeyStats::GC_BACKGROUD_IDLE_LONG_TIME) + 0.1f));
 }
+
+HWTEST_F_L0(GCTest, MemoryCountersTest001)
+{
+    auto heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    TestableGCStats stats(heap);
+    constexpr size_t TOUCHED_PAGES = 64;
+    size_t pageSize = PageSize();
+    auto touchFreshPages = [pageSize]() {
+        MemMap mem = PageMap(TOUCHED_PAGES * pageSize, PAGE_PROT_READWRITE);
+        for (size_t i = 0; i < TOUCHED_PAGES; i++) {
+            static_cast<volatile uint8_t *>(mem.GetMem())[i * pageSize] = 1;
+        }
+        PageUnmap(mem);
+    };
+
+    // nothing is recorded while the counters are disabled
+    stats.RecordMemoryCountersBeforeGC();
+    touchFreshPages();
+    stats.RecordMemoryCountersAfterGC();
+    EXPECT_EQ(stats.GetRecordData(RecordData::GC_PAGE_FAULTS), 0U);
+    EXPECT_EQ(stats.GetRecordData(RecordData::GC_TOTAL_PAGE_FAULTS), 0U);
+
+    stats.EnableMemoryCounters();
+    ASSERT_TRUE(stats.IsMemoryCountersEnabled());
+    stats.RecordMemoryCountersBeforeGC();
+    touchFreshPages();
+    stats.RecordMemoryCountersAfterGC();
+    size_t firstPageFaults = stats.GetRecordData(RecordData::GC_PAGE_FAULTS);
+    size_t firstDTLBMisses = stats.GetRecordData(RecordData::GC_DTLB_MISSES);
+#if !WIN_OR_MAC_OR_IOS_PLATFORM
+    EXPECT_GE(firstPageFaults, TOUCHED_PAGES);
+#endif
+
+    stats.RecordMemoryCountersBeforeGC();
+    touchFreshPages();
+    stats.RecordMemoryCountersAfterGC();
+    EXPECT_EQ(stats.GetRecordData(RecordData::GC_TOTAL_PAGE_FAULTS),
+              firstPageFaults + stats.GetRecordData(RecordData::GC_PAGE_FAULTS));
+    EXPECT_EQ(stats.GetRecordData(RecordData::GC_TOTAL_DTLB_MISSES),
+              firstDTLBMisses + stats.GetRecordData(RecordData::GC_DTLB_MISSES));
+
+    stats.DisableMemoryCounters();
+    EXPECT_FALSE(stats.IsMemoryCountersEnabled());
+}
 } // namespace panda::test
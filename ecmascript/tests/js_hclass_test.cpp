@@ -310,6 +310,70 @@ HWTEST_F_L0(JSHClassTest, AddProperty)
     EXPECT_TRUE(JSObject::HasProperty(thread, Obj, keyHandle2));
 }
 
+HWTEST_F_L0(JSHClassTest, VisitTransitionAndFindMaxPropsHClass)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> keyA(factory->NewFromASCII("a"));
+    JSHandle<JSTaggedValue> keyB(factory->NewFromASCII("b"));
+    JSHandle<JSTaggedValue> keyC(factory->NewFromASCII("c"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(1));
+    JSHandle<JSHClass> rootClass = CreateJSHClass(thread);
+    EXPECT_EQ(JSHClass::VisitTransitionAndFindMaxPropsHClass(thread, *rootClass), *rootClass);
+
+    // two branches of the transition tree: a -> b -> c and a -> c
+    JSHandle<JSObject> obj1 = factory->NewJSObject(rootClass);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj1), keyA, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj1), keyB, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj1), keyC, value);
+    JSHandle<JSObject> obj2 = factory->NewJSObject(rootClass);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj2), keyA, value);
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj2), keyC, value);
+
+    EXPECT_EQ(JSHClass::VisitTransitionAndFindMaxPropsHClass(thread, *rootClass), obj1->GetJSHClass());
+    EXPECT_EQ(JSHClass::VisitTransitionAndFindMaxNumOfProps(thread, *rootClass), 3U);
+}
+
+HWTEST_F_L0(JSHClassTest, ConvertOrTransitionWithRep)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> key(factory->NewFromASCII("x"));
+    JSHandle<JSHClass> rootClass = CreateJSHClass(thread);
+    rootClass->SetIsAllTaggedProp(false);
+    JSHandle<JSObject> obj = factory->NewJSObject(rootClass);
+    PropertyAttributes attr = PropertyAttributes::Default();
+    attr.SetIsInlinedProps(true);
+    attr.SetOffset(0);
+    attr.SetRepresentation(Representation::INT);
+    JSHClass::AddProperty(thread, obj, key, attr);
+    obj->SetPropertyInlinedProps<false>(thread, 0, JSTaggedValue(static_cast<JSTaggedType>(1)));
+    JSHClass *intClass = obj->GetJSHClass();
+
+    // int -> double keeps the field unboxed
+    JSHandle<JSTaggedValue> doubleValue(thread, JSTaggedValue(1.5));
+    TransitionResult result = JSHClass::ConvertOrTransitionWithRep(thread, obj, key, doubleValue, attr);
+    EXPECT_FALSE(result.isTagged);
+    EXPECT_TRUE(result.isTransition);
+    EXPECT_EQ(attr.GetRepresentation(), Representation::DOUBLE);
+    EXPECT_NE(obj->GetJSHClass(), intClass);
+    obj->SetProperty<false>(thread, obj->GetJSHClass(), attr, result.value);
+    EXPECT_EQ(obj->GetProperty(thread, obj->GetJSHClass(), attr).GetDouble(), 1.5);
+
+    // an int fits the double field without another transition
+    JSHClass *doubleClass = obj->GetJSHClass();
+    JSHandle<JSTaggedValue> intValue(thread, JSTaggedValue(2));
+    result = JSHClass::ConvertOrTransitionWithRep(thread, obj, key, intValue, attr);
+    EXPECT_FALSE(result.isTransition);
+    EXPECT_EQ(obj->GetJSHClass(), doubleClass);
+
+    // double -> tagged once an object comes
+    JSHandle<JSTaggedValue> objValue(factory->NewEmptyJSObject(0));
+    result = JSHClass::ConvertOrTransitionWithRep(thread, obj, key, objValue, attr);
+    EXPECT_TRUE(result.isTagged);
+    EXPECT_TRUE(result.isTransition);
+    EXPECT_EQ(attr.GetRepresentation(), Representation::TAGGED);
+    EXPECT_NE(obj->GetJSHClass(), doubleClass);
+}
+
 HWTEST_F_L0(JSHClassTest, TransitionExtension)
 {
     EcmaVM *vm = thread->GetEcmaVM();
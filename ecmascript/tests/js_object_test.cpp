@@ -481,6 +481,82 @@ HWTEST_F_L0(JSObjectTest, EnumerableOwnNames)
     EXPECT_EQ(JSObject::GetProperty(thread, JSHandle<JSTaggedValue>(obj), keyNoConfig).GetValue()->GetInt(), 1);
 }
 
+HWTEST_F_L0(JSObjectTest, EnumKeysSnapshot)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> objFunc(thread, JSObjectTestCreate(thread));
+    JSHandle<JSTaggedValue> keyX(factory->NewFromASCII("x"));
+    JSHandle<JSTaggedValue> keyY(factory->NewFromASCII("y"));
+    auto setInt = [this](const JSHandle<JSObject> &obj, const JSHandle<JSTaggedValue> &key, int value) {
+        JSHandle<JSTaggedValue> valueHandle(thread, JSTaggedValue(value));
+        JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), key, valueHandle);
+    };
+    JSHandle<JSObject> obj1 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    JSHandle<JSObject> obj2 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    setInt(obj1, keyX, 1);
+    setInt(obj1, keyY, 2);
+    setInt(obj2, keyX, 3);
+    setInt(obj2, keyY, 4);
+    ASSERT_EQ(obj1->GetJSHClass(), obj2->GetJSHClass());
+
+    // for-in and the other generic users of the enum cache keep the movable array of keys
+    uint32_t keys = 0;
+    JSObject::GetAllEnumKeys(thread, obj1, 2, &keys);
+    EXPECT_EQ(keys, 2U);
+    JSTaggedValue cacheOwn = EnumCache::Cast(obj1->GetJSHClass()->GetEnumCache(thread))->GetEnumCacheOwn(thread);
+    ASSERT_TRUE(cacheOwn.IsTaggedArray());
+    EXPECT_FALSE(cacheOwn.IsCOWArray());
+
+    // objects of one hclass share one copy-on-write snapshot of their keys, which replaces the cached keys
+    JSTaggedValue snapshot = JSObject::GetEnumKeysSnapshot(thread, obj1);
+    ASSERT_TRUE(snapshot.IsCOWArray());
+    EXPECT_EQ(EnumCache::Cast(obj1->GetJSHClass()->GetEnumCache(thread))->GetEnumCacheOwn(thread), snapshot);
+    EXPECT_EQ(JSObject::GetEnumKeysSnapshot(thread, obj2), snapshot);
+    EXPECT_EQ(TaggedArray::Cast(snapshot.GetTaggedObject())->GetLength(), 2U);
+    EXPECT_EQ(TaggedArray::Cast(snapshot.GetTaggedObject())->Get(thread, 0), keyX.GetTaggedValue());
+
+    JSHandle<TaggedArray> values = JSObject::EnumerableOwnPropertyNames(thread, obj2, PropertyKind::VALUE);
+    ASSERT_EQ(values->GetLength(), 2U);
+    EXPECT_EQ(values->Get(thread, 0).GetInt(), 3);
+    EXPECT_EQ(values->Get(thread, 1).GetInt(), 4);
+
+    // elements are not described by the hclass
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj2), JSHandle<JSTaggedValue>(thread, JSTaggedValue(0)),
+                          JSHandle<JSTaggedValue>(thread, JSTaggedValue(5)));
+    EXPECT_TRUE(JSObject::GetEnumKeysSnapshot(thread, obj2).IsUndefined());
+}
+
+HWTEST_F_L0(JSObjectTest, CopyDataPropertiesWithSameHClass)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<JSTaggedValue> objFunc(thread, JSObjectTestCreate(thread));
+    JSHandle<JSTaggedValue> keyX(factory->NewFromASCII("x"));
+    JSHandle<JSTaggedValue> keyY(factory->NewFromASCII("y"));
+    auto setInt = [this](const JSHandle<JSObject> &obj, const JSHandle<JSTaggedValue> &key, int value) {
+        JSHandle<JSTaggedValue> valueHandle(thread, JSTaggedValue(value));
+        JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(obj), key, valueHandle);
+    };
+    JSHandle<JSObject> src = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    setInt(src, keyX, 1);
+    setInt(src, keyY, 2);
+
+    JSHandle<JSObject> dst = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    ASSERT_TRUE(JSObject::TryCopyDataPropertiesWithSameHClass(thread, dst, src));
+    EXPECT_EQ(dst->GetJSHClass(), src->GetJSHClass());
+    EXPECT_EQ(JSObject::GetProperty(thread, JSHandle<JSTaggedValue>(dst), keyY).GetValue()->GetInt(), 2);
+    // the copy does not alias src
+    setInt(dst, keyX, 3);
+    EXPECT_EQ(JSObject::GetProperty(thread, JSHandle<JSTaggedValue>(src), keyX).GetValue()->GetInt(), 1);
+
+    // a non-enumerable property is not copied, so the hclass of src does not fit the copy
+    PropertyDescriptor descNoEnum(thread);
+    descNoEnum.SetEnumerable(false);
+    JSTaggedValue::DefinePropertyOrThrow(thread, JSHandle<JSTaggedValue>(src), keyX, descNoEnum);
+    JSHandle<JSObject> dst2 = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFunc), objFunc);
+    EXPECT_FALSE(JSObject::TryCopyDataPropertiesWithSameHClass(thread, dst2, src));
+    EXPECT_EQ(dst2->GetJSHClass()->NumberOfProps(), 0U);
+}
+
 HWTEST_F_L0(JSObjectTest, SetIntegrityLevelSealed)
 {
     JSHandle<JSTaggedValue> hclass1(thread, JSObjectTestCreate(thread));
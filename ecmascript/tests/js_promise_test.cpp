@@ -105,4 +105,31 @@ HWTEST_F_L0(JSPromiseTest, RejectPromise)
     EXPECT_EQ(newPromise->GetPromiseState(), PromiseState::REJECTED);
     EXPECT_EQ(JSTaggedValue::SameValue(thread, newPromise->GetPromiseResult(thread), JSTaggedValue(44)), true);
 }
+
+HWTEST_F_L0(JSPromiseTest, IsUnmodifiedNativePromise)
+{
+    EcmaVM *ecmaVM = thread->GetEcmaVM();
+    JSHandle<GlobalEnv> env = ecmaVM->GetGlobalEnv();
+    ObjectFactory *factory = ecmaVM->GetFactory();
+    JSHandle<JSTaggedValue> promiseFunc = env->GetPromiseFunction();
+    JSHandle<JSTaggedValue> constructorKey = thread->GlobalConstants()->GetHandledConstructorString();
+
+    JSHandle<JSPromise> native = factory->NewJSPromise();
+    EXPECT_TRUE(JSPromise::IsUnmodifiedNativePromise(thread, native.GetTaggedValue()));
+    EXPECT_FALSE(JSPromise::IsUnmodifiedNativePromise(thread, JSTaggedValue(1)));
+    EXPECT_FALSE(JSPromise::IsUnmodifiedNativePromise(thread, factory->NewEmptyJSObject(0).GetTaggedValue()));
+
+    // an own "constructor" moves the promise off the initial hclass
+    JSHandle<JSPromise> withOwnConstructor = factory->NewJSPromise();
+    JSHandle<JSTaggedValue> other(factory->NewEmptyJSObject(0));
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(withOwnConstructor), constructorKey, other);
+    EXPECT_FALSE(JSPromise::IsUnmodifiedNativePromise(thread, withOwnConstructor.GetTaggedValue()));
+
+    // Promise.prototype.constructor is looked up on every check
+    JSHandle<JSTaggedValue> proto(thread, native->GetJSHClass()->GetPrototype(thread));
+    JSObject::SetProperty(thread, proto, constructorKey, other);
+    EXPECT_FALSE(JSPromise::IsUnmodifiedNativePromise(thread, native.GetTaggedValue()));
+    JSObject::SetProperty(thread, proto, constructorKey, promiseFunc);
+    EXPECT_TRUE(JSPromise::IsUnmodifiedNativePromise(thread, native.GetTaggedValue()));
+}
 }  // namespace panda::test
@@ -82,6 +82,58 @@ HWTEST_F_L0(JSVerificationTest, VerifyHeapObjects)
     const_cast<SemiSpace *>(heap->GetNewSpace())->IterateOverObjects(objVerifier);  // newspace reference the old space
 }
 
+HWTEST_F_L0(JSVerificationTest, ParallelVerification)
+{
+    auto ecmaVm = thread->GetEcmaVM();
+    auto heap = const_cast<Heap *>(ecmaVm->GetHeap());
+    auto objectFactory = ecmaVm->GetFactory();
+    {
+        EcmaHandleScope handleScope(thread);
+        for (int i = 0; i < 100; i++) {
+            objectFactory->NewTaggedArray(1024, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        }
+    }
+    heap->CollectGarbage(TriggerGCType::OLD_GC);
+
+    ParallelVerification verification(heap, VerifyKind::VERIFY_PRE_GC);
+    verification.CollectRegions(heap->NextHeapVerifyEpoch());
+    size_t allUnits = verification.GetUnitCount();
+    EXPECT_GT(allUnits, 0U);
+    EXPECT_EQ(verification.Run(heap->GetMaxMarkTaskCount()), 0U);
+
+    ParallelVerification sampled(heap, VerifyKind::VERIFY_PRE_GC, 1);
+    sampled.CollectRegions(heap->NextHeapVerifyEpoch());
+    EXPECT_LE(sampled.GetUnitCount(), allUnits);
+    EXPECT_EQ(sampled.Run(0), 0U);
+
+    ParallelVerification marked(heap, VerifyKind::VERIFY_NO_SLOT_CHECK);
+    marked.CollectMarkedRegions(heap->NextHeapVerifyEpoch());
+    EXPECT_EQ(marked.Run(0), 0U);
+}
+
+HWTEST_F_L0(JSVerificationTest, ConcurrentVerifyFailureRecheckedInPause)
+{
+    auto ecmaVm = thread->GetEcmaVM();
+    auto heap = const_cast<Heap *>(ecmaVm->GetHeap());
+    auto objectFactory = ecmaVm->GetFactory();
+    {
+        EcmaHandleScope handleScope(thread);
+        for (int i = 0; i < 100; i++) {
+            objectFactory->NewTaggedArray(1024, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        }
+    }
+    heap->CollectGarbage(TriggerGCType::OLD_GC);
+    heap->WaitConcurrentVerifyFinished();
+
+    // A write racing with the background task looks like a corruption to it. The heap is intact, so the re-check
+    // in the pause must pass instead of aborting, and the suspicion is consumed by it.
+    heap->ReportConcurrentVerifyFailure(1);
+    heap->WaitConcurrentVerifyFinished();
+    heap->WaitConcurrentVerifyFinished();
+    heap->CollectGarbage(TriggerGCType::OLD_GC);
+    EXPECT_EQ(heap->VerifyHeapObjects(), 0U);
+}
+
 HWTEST_F_L0(JSVerificationTest, NoBarrierInternalAccessor)
 {
     auto ecmaVm = thread->GetEcmaVM();
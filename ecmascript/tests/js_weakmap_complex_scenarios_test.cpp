@@ -1106,6 +1106,66 @@ HWTEST_F_L0(JSWeakMapComplexScenariosTest, Test21_DeepNestingWithExternalRef)
     }
 }
 
+// Test 22: long chain spread over several WeakMaps, resolved by the parallel full gc fixpoint
+// Expected: the chain reachable from the external key survives, the unreachable cycle is collected
+HWTEST_F_L0(JSWeakMapComplexScenariosTest, Test22_ParallelFixPointAcrossWeakMaps)
+{
+    constexpr int mapCount = 8;
+    constexpr int chainLength = 400;
+    std::vector<JSHandle<JSWeakMap>> weakMaps;
+    for (int i = 0; i < mapCount; i++) {
+        weakMaps.push_back(CreateWeakMap());
+    }
+
+    std::vector<JSMutableHandle<JSWeakRef>> aliveRefs;
+    std::vector<JSMutableHandle<JSWeakRef>> deadRefs;
+    for (int i = 0; i < chainLength; i++) {
+        aliveRefs.push_back(JSMutableHandle<JSWeakRef>(thread, JSTaggedValue::Undefined()));
+        deadRefs.push_back(JSMutableHandle<JSWeakRef>(thread, JSTaggedValue::Undefined()));
+    }
+    JSMutableHandle<JSObject> strongK(thread, JSTaggedValue::Undefined());
+    {
+        [[maybe_unused]] ecmascript::EcmaHandleScope baseScope(thread);
+        std::vector<JSHandle<JSObject>> aliveKeys;
+        std::vector<JSHandle<JSObject>> deadKeys;
+        for (int i = 0; i < chainLength; i++) {
+            aliveKeys.push_back(CreateObject());
+            deadKeys.push_back(CreateObject());
+        }
+        strongK.Update(aliveKeys[0]);
+
+        // v[i] references k[i+1]; entries are inserted in reverse so each key is resolved late.
+        for (int i = chainLength - 1; i >= 0; i--) {
+            auto aliveValue = CreateObject();
+            auto deadValue = CreateObject();
+            int next = (i + 1) % chainLength;
+            SetProperty(aliveValue, "ref", JSHandle<JSTaggedValue>(thread, aliveKeys[next].GetTaggedValue()));
+            SetProperty(deadValue, "ref", JSHandle<JSTaggedValue>(thread, deadKeys[next].GetTaggedValue()));
+            JSHandle<JSWeakMap> weakMap = weakMaps[i % mapCount];
+            JSWeakMap::Set(thread, weakMap, JSHandle<JSTaggedValue>(thread, aliveKeys[i].GetTaggedValue()),
+                           JSHandle<JSTaggedValue>(thread, aliveValue.GetTaggedValue()));
+            JSWeakMap::Set(thread, weakMap, JSHandle<JSTaggedValue>(thread, deadKeys[i].GetTaggedValue()),
+                           JSHandle<JSTaggedValue>(thread, deadValue.GetTaggedValue()));
+        }
+        for (int i = 0; i < chainLength; i++) {
+            aliveRefs[i].Update(CreateWeakRef(JSHandle<JSTaggedValue>(thread, aliveKeys[i].GetTaggedValue())));
+            deadRefs[i].Update(CreateWeakRef(JSHandle<JSTaggedValue>(thread, deadKeys[i].GetTaggedValue())));
+        }
+    }
+
+    Heap *heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+    bool prev = heap->IsParallelGCEnabled();
+    heap->SetParallelGCEnabled(true);
+    thread->GetEcmaVM()->ClearKeptObjects(thread);
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    heap->SetParallelGCEnabled(prev);
+
+    for (int i = 0; i < chainLength; i++) {
+        EXPECT_FALSE(IsCollected(aliveRefs[i]));
+        EXPECT_TRUE(IsCollected(deadRefs[i]));
+    }
+}
+
 HWTEST_F_L0(JSWeakMapComplexScenariosTest, Test_OldGC)
 {
     auto weakMap = CreateWeakMap();
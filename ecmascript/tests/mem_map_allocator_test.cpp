@@ -29,6 +29,24 @@ namespace panda::test {
 constexpr size_t HUGE_OBJECT_CAPACITY = 1024_MB;
 
 class MemMapAllocatorTest : public BaseTestWithScope<false> {
+public:
+    static MemMapPool &GetRegularPool(MemMapAllocator &allocator)
+    {
+        return allocator.memMapPool_;
+    }
+
+    static size_t GetRegularPoolAlignment(const MemMapAllocator &allocator, size_t alignment)
+    {
+        return allocator.GetRegularPoolAlignment(alignment);
+    }
+
+    // Hand the regions of a fresh mapping to the regular pool, like the regions released after a gc.
+    static void AddRegularRegions(MemMapAllocator &allocator, size_t regionNum)
+    {
+        MemMap memMap = PageMap(regionNum * DEFAULT_REGION_SIZE, PAGE_PROT_NONE, DEFAULT_REGION_SIZE);
+        allocator.memMapPool_.InsertMemMap(memMap);
+        allocator.memMapPool_.SplitMemMapToCache(memMap);
+    }
 };
 
 HWTEST_F_L0(MemMapAllocatorTest, GetMemFromList)
@@ -221,4 +239,59 @@ HWTEST_F_L0(MemMapAllocatorTest, InitialMemPool_HugeMachineCodeWithoutPageTag)
         Jit::GetInstance()->IsEnableJitFort(), false, false);
     EXPECT_EQ(mem.GetSize(), TEST_SIZE);
 }
+
+HWTEST_F_L0(MemMapAllocatorTest, PrefaultCommittedCache_RefillUpToCachedSize)
+{
+    MemMapAllocator allocator;
+    allocator.ResetLargePoolSize();
+    constexpr size_t REGION_NUM = 4;
+    AddRegularRegions(allocator, REGION_NUM);
+
+    constexpr size_t CACHED_SIZE = 2 * DEFAULT_REGION_SIZE;
+    EXPECT_EQ(allocator.PrefaultCommittedCache(CACHED_SIZE), CACHED_SIZE);
+    EXPECT_EQ(allocator.GetTotalSize(), CACHED_SIZE);
+    EXPECT_TRUE(GetRegularPool(allocator).IsRegularCommittedFull(CACHED_SIZE));
+    // the cache is full, nothing more is faulted in
+    EXPECT_EQ(allocator.PrefaultCommittedCache(CACHED_SIZE), 0U);
+
+    // a prefaulted region is handed out writable and is already counted in the total size
+    MemMap mem = allocator.Allocate(0, DEFAULT_REGION_SIZE, DEFAULT_REGION_SIZE, "", true, false, false, false,
+                                    false, false);
+    ASSERT_NE(mem.GetMem(), nullptr);
+    static_cast<volatile uint8_t *>(mem.GetMem())[0] = 1;
+    EXPECT_EQ(allocator.GetTotalSize(), CACHED_SIZE);
+    allocator.Finalize();
+}
+
+HWTEST_F_L0(MemMapAllocatorTest, PrefaultCommittedCache_RespectCapacity)
+{
+    MemMapAllocator allocator;
+    allocator.ResetLargePoolSize();
+    constexpr size_t REGION_NUM = 4;
+    AddRegularRegions(allocator, REGION_NUM);
+
+    // leave room for a single region below the capacity
+    allocator.IncreaseMemMapTotalSize(allocator.GetCapacity() - DEFAULT_REGION_SIZE);
+    EXPECT_EQ(allocator.PrefaultCommittedCache(REGION_NUM * DEFAULT_REGION_SIZE), DEFAULT_REGION_SIZE);
+    EXPECT_EQ(allocator.GetTotalSize(), allocator.GetCapacity());
+    EXPECT_FALSE(GetRegularPool(allocator).IsRegularCommittedFull(REGION_NUM * DEFAULT_REGION_SIZE));
+    allocator.Finalize();
+}
+
+HWTEST_F_L0(MemMapAllocatorTest, HugePageRegularPoolAlignment)
+{
+    MemMapAllocator allocator;
+    allocator.ResetLargePoolSize();
+    EXPECT_EQ(GetRegularPoolAlignment(allocator, DEFAULT_REGION_SIZE), DEFAULT_REGION_SIZE);
+    allocator.SetEnableHugePage(true);
+    EXPECT_EQ(GetRegularPoolAlignment(allocator, DEFAULT_REGION_SIZE), 2_MB);
+#ifndef USE_COMPRESSED_POINTER
+    // the pool is empty, so the region is split from the head of a freshly mapped pool
+    MemMap mem = allocator.Allocate(0, DEFAULT_REGION_SIZE, DEFAULT_REGION_SIZE, "", true, false, false, false,
+                                    false, false);
+    ASSERT_NE(mem.GetMem(), nullptr);
+    EXPECT_TRUE(IsAligned(ToUintPtr(mem.GetMem()), 2_MB));
+#endif
+    allocator.Finalize();
+}
 }  // namespace panda::test
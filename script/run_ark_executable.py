@@ -114,6 +114,8 @@ def parse_args() -> object:
     parser.add_argument('--skip', type=bool, default=False, help='skip execute')
     parser.add_argument('--clean-path', action='append', default=[],
                         help='remove file/dir before execute, can be specified multiple times')
+    parser.add_argument('--copy-file', action='append', nargs=2, default=[], metavar=('SRC', 'DST'),
+                        help='copy file SRC to DST after cleaning, can be specified multiple times')
     args = parser.parse_args()
     return args
 
@@ -129,6 +131,13 @@ def clean_paths(paths: list):
             shutil.rmtree(path)
 
 
+def copy_files(pairs: list):
+    """Copy input files into place before command execution."""
+    for src, dst in pairs:
+        os.makedirs(os.path.dirname(dst), exist_ok=True)
+        shutil.copyfile(src, dst)
+
+
 def process_open(args: object) -> [str, object]:
     """get command and open subprocess."""
     if args.env_path:
@@ -243,6 +252,7 @@ def judge_output(args: object):
         return
 
     clean_paths(args.clean_path)
+    copy_files(args.copy_file)
 
     start_time = time.time()
     [cmd, subp] = process_open(args)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+declare function print(arg:any):string;
+
+// await of a primitive or of a settled native promise resumes in the same tick as a promise reaction would
+async function order() {
+    let log: string[] = [];
+    let p = Promise.resolve();
+    p.then(() => log.push("then1")).then(() => log.push("then2"));
+    (async () => {
+        log.push("start");
+        await 0;
+        log.push("await1");
+        await p;
+        log.push("await2");
+    })();
+    await null;
+    await null;
+    await null;
+    await null;
+    print(log.join(","));
+}
+
+async function rejected() {
+    try {
+        await Promise.reject("boom");
+    } catch (e) {
+        print("caught " + e);
+    }
+}
+
+// the fast path must not skip a "constructor" getter
+async function ownConstructor() {
+    let p = Promise.resolve(3);
+    Object.defineProperty(p, "constructor", {
+        get() {
+            print("constructor getter");
+            return Promise;
+        }
+    });
+    print("own constructor " + await p);
+}
+
+async function thenable() {
+    let v = await {
+        then(resolve: (v: number) => void) {
+            print("then called");
+            resolve(4);
+        }
+    };
+    print("thenable " + v);
+}
+
+class MyPromise extends Promise<number> {
+}
+
+async function subclass() {
+    print("subclass " + await MyPromise.resolve(5));
+}
+
+async function* gen() {
+    let x = await 6;
+    yield x;
+}
+
+async function generator() {
+    for await (let v of gen()) {
+        print("generator " + v);
+    }
+}
+
+async function loop() {
+    let sum = 0;
+    let resolved = Promise.resolve(1);
+    for (let i = 0; i < 1000; i++) {
+        sum += await i;
+        sum -= await resolved;
+    }
+    print("loop " + sum);
+}
+
+async function main() {
+    await order();
+    await rejected();
+    await ownConstructor();
+    await thenable();
+    await subclass();
+    await generator();
+    await loop();
+}
+
+main();
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(arg: any): string;
+declare var ArkTools: any;
+
+// The code grows compared to ../changed, so the reused modules land at another text offset of the new an file
+function scale(x: number): number {
+    let result = x;
+    for (let i = 0; i < 2; i++) {
+        result += x;
+    }
+    return result;
+}
+
+function shift(x: number): number {
+    return scale(x) + 1;
+}
+
+print("changed: " + ArkTools.isAOTCompiled(shift) + " " + shift(21));
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(arg: any): string;
+declare var ArkTools: any;
+
+// The code of this file is taken over from the first an file by the incremental compilation
+
+class Vec {
+    x: number;
+    y: number;
+    constructor(x: number, y: number) {
+        this.x = x;
+        this.y = y;
+    }
+    length(): number {
+        return Math.sqrt(this.x * this.x + this.y * this.y);
+    }
+}
+
+// the allocations trigger gcs, which walk the reused frames with their stackmaps
+function sumLengths(n: number): number {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        let v = new Vec(i % 3, i % 4);
+        sum += v.length();
+    }
+    return sum;
+}
+
+function keepOverGC(a: number, b: number): number {
+    let kept = [a, b];
+    ArkTools.forceFullGC();
+    return kept[0] + kept[1];
+}
+
+function throwFromDepth(depth: number): number {
+    if (depth == 0) {
+        throw new Error("thrown at depth 0");
+    }
+    return throwFromDepth(depth - 1) + 1;
+}
+
+print("unchanged: " + ArkTools.isAOTCompiled(sumLengths));
+print(sumLengths(100000).toFixed(3));
+print(keepOverGC(40, 2));
+try {
+    throwFromDepth(5);
+} catch (e) {
+    print(e.message);
+}
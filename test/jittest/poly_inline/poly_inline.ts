@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(arg:any):string;
+declare var ArkTools:any;
+
+class Square {
+    side: number;
+    constructor(side: number) {
+        this.side = side;
+    }
+    area(): number {
+        return this.side * this.side;
+    }
+}
+
+class Rect {
+    width: number;
+    height: number;
+    constructor(width: number, height: number) {
+        this.width = width;
+        this.height = height;
+    }
+    area(): number {
+        return this.width * this.height;
+    }
+}
+
+class Triangle {
+    base: number;
+    height: number;
+    constructor(base: number, height: number) {
+        this.base = base;
+        this.height = height;
+    }
+    area(): number {
+        return this.base * this.height / 2;
+    }
+}
+
+class Circle {
+    radius: number;
+    constructor(radius: number) {
+        this.radius = radius;
+    }
+    area(): number {
+        return this.radius * this.radius * 3;
+    }
+}
+
+function totalArea(shapes: any[]): number {
+    let sum = 0;
+    for (let i = 0; i < shapes.length; i++) {
+        sum += shapes[i].area();
+    }
+    return sum;
+}
+
+let shapes: any[] = [];
+for (let i = 0; i < 30; i++) {
+    shapes.push(new Square(i));
+    shapes.push(new Rect(i, 2));
+    shapes.push(new Triangle(i, 4));
+}
+
+function Test(): number {
+    return totalArea(shapes);
+}
+
+for (let i = 0; i < 20; i++) {
+    Test();
+}
+print(Test());
+ArkTools.jitCompileAsync(Test);
+let res = ArkTools.waitJitCompileFinish(Test);
+print(res);
+print(Test());
+// a receiver the compiled code has not seen leaves the inlined cases through the deopt fallback
+shapes.push(new Circle(5));
+print(Test());
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * @tc.name:comparebranch
+ * @tc.desc:test the compare handlers which step over the jeqz/jnez after them, and ldai fused with an int compare
+ * @tc.type: FUNC
+ */
+
+// "if (a op b)" is a compare followed by jeqz, taken when the compare is false
+function branchJeqz(a, b) {
+    let taken = "";
+    if (a == b) { taken += "1"; } else { taken += "0"; }
+    if (a != b) { taken += "1"; } else { taken += "0"; }
+    if (a < b) { taken += "1"; } else { taken += "0"; }
+    if (a <= b) { taken += "1"; } else { taken += "0"; }
+    if (a > b) { taken += "1"; } else { taken += "0"; }
+    if (a >= b) { taken += "1"; } else { taken += "0"; }
+    if (a === b) { taken += "1"; } else { taken += "0"; }
+    if (a !== b) { taken += "1"; } else { taken += "0"; }
+    return taken;
+}
+
+// "if (!(a op b))" is a compare followed by jnez, taken when the compare is true
+function branchJnez(a, b) {
+    let taken = "";
+    if (!(a == b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a != b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a < b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a <= b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a > b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a >= b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a === b)) { taken += "1"; } else { taken += "0"; }
+    if (!(a !== b)) { taken += "1"; } else { taken += "0"; }
+    return taken;
+}
+
+let operands = [[1, 1], [1, 2], [2, 1], ["1", 1], [1.5, 1.5], [NaN, NaN], ["a", "b"], [true, 1]];
+for (let [a, b] of operands) {
+    print(typeof a + " " + typeof b + ": " + branchJeqz(a, b) + " " + branchJnez(a, b));
+}
+
+// the loop conditions run the fused path until the last iteration takes the branch
+function loops(n) {
+    let count = 0;
+    let i = 0;
+    while (i < n) {
+        i++;
+        count++;
+    }
+    while (!(i <= 0)) {
+        i--;
+        count++;
+    }
+    do {
+        count++;
+        i++;
+    } while (i < n);
+    return count;
+}
+print(loops(5));
+print(loops(0));
+
+// the valueOf of an operand throws, no branch may run after the exception
+function throwingCompare(op) {
+    let obj = { valueOf() { throw new Error("valueOf of " + op); } };
+    let result = "none";
+    try {
+        switch (op) {
+            case "==": if (obj == 1) { result = "then"; } else { result = "else"; } break;
+            case "!=": if (obj != 1) { result = "then"; } else { result = "else"; } break;
+            case "<": if (obj < 1) { result = "then"; } else { result = "else"; } break;
+            case "<=": if (obj <= 1) { result = "then"; } else { result = "else"; } break;
+            case ">": if (obj > 1) { result = "then"; } else { result = "else"; } break;
+            case ">=": if (!(obj >= 1)) { result = "then"; } else { result = "else"; } break;
+        }
+    } catch (e) {
+        result = "caught " + e.message;
+    }
+    return result;
+}
+for (let op of ["==", "!=", "<", "<=", ">", ">="]) {
+    print(throwingCompare(op));
+}
+
+// every compare calls valueOf once, fused or not
+let valueOfCalls = 0;
+let counted = { valueOf() { valueOfCalls++; return 3; } };
+let countedTaken = 0;
+for (let i = 0; i < 10; i++) {
+    if (counted < i) {
+        countedTaken++;
+    }
+}
+print(valueOfCalls + " " + countedTaken);
+
+// the jeqz after the second compare is also the target of the jmp after the first one, so jumping to it runs its
+// own handler
+function landOnBranch(c, x, y) {
+    if (c ? x < y : x > y) {
+        return "then";
+    }
+    return "else";
+}
+print(landOnBranch(true, 1, 2) + " " + landOnBranch(true, 2, 1) + " " + landOnBranch(false, 1, 2) + " " +
+      landOnBranch(false, 2, 1));
+let landed = [];
+for (let i = 0; i < 4; i++) {
+    landed.push(landOnBranch(i % 2 == 0, i, 2));
+}
+print(landed.join(" "));
+
+// ldai followed by a compare with a register, the register holds an int only in the first loop
+function ldaiCompare(start, step) {
+    let count = 0;
+    for (let i = start; i < 100; i += step) {
+        count++;
+    }
+    for (let i = start; i <= 100; i += step) {
+        count++;
+    }
+    for (let i = 100 + start; i > 100; i -= step) {
+        count++;
+    }
+    for (let i = 100 + start; i >= 100; i -= step) {
+        count++;
+    }
+    return count;
+}
+print(ldaiCompare(0, 1));
+print(ldaiCompare(0.5, 1));
+print(ldaiCompare(0, 0.5));
+
+let notInts = ["99", "100", "abc", undefined, null, true, 1e10, -0, { valueOf() { return 50; } }];
+let ldaiResult = [];
+for (let v of notInts) {
+    let x = v;
+    ldaiResult.push((x < 100 ? "1" : "0") + (x <= 100 ? "1" : "0") + (x > 100 ? "1" : "0") + (x >= 100 ? "1" : "0"));
+}
+print(ldaiResult.join(" "));
+
+let ldaiThrows = { valueOf() { throw new Error("valueOf after ldai"); } };
+try {
+    if (ldaiThrows < 100) {
+        print("then");
+    } else {
+        print("else");
+    }
+} catch (e) {
+    print("caught " + e.message);
+}
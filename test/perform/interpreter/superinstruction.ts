@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Loops whose conditions run as superinstructions in the asm interpreter, run it with --asm-interpreter=true and
+// without jit. In a build with ECMASCRIPT_ENABLE_COLLECTING_OPCODES the handler dispatches of every test are
+// printed as "Total Handler Dispatches"; compare them with a build before the superinstructions.
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+    startCollectingOpcodes?(arg:any):void
+    stopCollectingOpcodes?(arg:any):void
+}
+
+function measure(name: string, test: () => number) {
+    if (ArkTools.startCollectingOpcodes) {
+        ArkTools.startCollectingOpcodes(name);
+    }
+    let start = ArkTools.timeInUs();
+    let result = test();
+    let end = ArkTools.timeInUs();
+    if (ArkTools.stopCollectingOpcodes) {
+        ArkTools.stopCollectingOpcodes(name);
+    }
+    let time = (end - start) / 1000
+    print(result);
+    print("Interpreter " + name + ":\t" + String(time) + "\tms");
+}
+
+// ldai + less + jeqz
+function countedLoop(): number {
+    let sum = 0;
+    for (let i = 0; i < 1_000_000; i++) {
+        sum += i & 1;
+    }
+    return sum;
+}
+
+// less + jeqz, with the bound in a register
+function boundLoop(): number {
+    let sum = 0;
+    let n = 1_000_000;
+    for (let i = 0; i < n; i++) {
+        sum += i & 3;
+    }
+    return sum;
+}
+
+// greatereq + jeqz and stricteq + jeqz
+function countdownLoop(): number {
+    let count = 0;
+    for (let i = 1_000_000; i >= 0; i--) {
+        if ((i & 7) === 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+measure("CountedLoop", countedLoop);
+measure("BoundLoop", boundLoop);
+measure("CountdownLoop", countdownLoop);
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Type dispatch by instanceof and by `in` checks, over monomorphic and polymorphic sites.
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+}
+
+class Shape {
+    kind: number = 0;
+}
+class Circle extends Shape {
+    radius: number = 1;
+}
+class Square extends Shape {
+    side: number = 2;
+}
+class Line {
+    length: number = 3;
+}
+
+function measure(name: string, test: () => number) {
+    let start = ArkTools.timeInUs();
+    let result = test();
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(result);
+    print("Object " + name + ":\t" + String(time) + "\tms");
+}
+
+const shapes: Object[] = [new Circle(), new Square(), new Line(), new Circle()];
+
+function instanceofMono(): number {
+    let count = 0;
+    let circle = new Circle();
+    for (let i = 0; i < 1_000_000; i++) {
+        if (circle instanceof Shape) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function instanceofPoly(): number {
+    let count = 0;
+    const ctors = [Circle, Square, Line];
+    for (let i = 0; i < 1_000_000; i++) {
+        if (shapes[i & 3] instanceof ctors[i % 3]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function inOwn(): number {
+    let count = 0;
+    for (let i = 0; i < 1_000_000; i++) {
+        if ("radius" in shapes[i & 3]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function inPrototype(): number {
+    let count = 0;
+    for (let i = 0; i < 1_000_000; i++) {
+        if ("toString" in shapes[i & 3]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+measure("InstanceofMono", instanceofMono);
+measure("InstanceofPoly", instanceofPoly);
+measure("InOwn", inOwn);
+measure("InPrototype", inPrototype);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Object.keys/values/entries and object spread over many objects of a few shapes.
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+}
+
+function measure(name: string, test: () => number) {
+    let start = ArkTools.timeInUs();
+    let result = test();
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(result);
+    print("Object " + name + ":\t" + String(time) + "\tms");
+}
+
+const points: Object[] = [];
+for (let i = 0; i < 100; i++) {
+    points.push({x: i, y: i + 1, z: i + 2});
+    points.push({x: i, y: i + 1});
+    points.push({id: i, name: "p" + i, x: i, y: i + 1});
+}
+
+function keys(): number {
+    let count = 0;
+    for (let i = 0; i < 10_000; i++) {
+        for (let j = 0; j < points.length; j++) {
+            count += Object.keys(points[j]).length;
+        }
+    }
+    return count;
+}
+
+function values(): number {
+    let count = 0;
+    for (let i = 0; i < 3_000; i++) {
+        for (let j = 0; j < points.length; j++) {
+            count += Object.values(points[j]).length;
+        }
+    }
+    return count;
+}
+
+function entries(): number {
+    let count = 0;
+    for (let i = 0; i < 1_000; i++) {
+        for (let j = 0; j < points.length; j++) {
+            count += Object.entries(points[j]).length;
+        }
+    }
+    return count;
+}
+
+function spread(): number {
+    let count = 0;
+    for (let i = 0; i < 3_000; i++) {
+        for (let j = 0; j < points.length; j++) {
+            let copy: any = {...points[j]};
+            count += copy.x;
+        }
+    }
+    return count;
+}
+
+measure("Keys", keys);
+measure("Values", values);
+measure("Entries", entries);
+measure("Spread", spread);
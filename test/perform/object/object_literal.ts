@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+}
+
+class Point {
+    x: number;
+    y: number;
+    constructor(x: number, y: number) {
+        this.x = x;
+        this.y = y;
+    }
+}
+
+function testEmptyObjectLiterals() {
+    let sum = 0;
+    let start = ArkTools.timeInUs();
+    for (let i = 0; i < 1_000_000; i++) {
+        const a = {};
+        const b = {};
+        const c = {};
+        sum += (a === b || b === c) ? 0 : 1;
+    }
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(sum);
+    print("Object EmptyObjectLiterals:\t"+String(time)+"\tms");
+}
+
+function testObjectLiterals() {
+    let sum = 0;
+    let start = ArkTools.timeInUs();
+    for (let i = 0; i < 1_000_000; i++) {
+        const from = { x: i, y: i + 1 };
+        const to = { x: i + 2, y: i + 3 };
+        const line = { from: from, to: to };
+        sum += line.to.x - line.from.y;
+    }
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(sum);
+    print("Object ObjectLiterals:\t"+String(time)+"\tms");
+}
+
+function testArrayLiterals() {
+    let sum = 0;
+    let start = ArkTools.timeInUs();
+    for (let i = 0; i < 1_000_000; i++) {
+        const pair = [i, i + 1];
+        const triple = [i, i + 1, i + 2];
+        sum += pair[1] + triple[2];
+    }
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(sum);
+    print("Object ArrayLiterals:\t"+String(time)+"\tms");
+}
+
+function testNewObjects() {
+    let sum = 0;
+    let start = ArkTools.timeInUs();
+    for (let i = 0; i < 1_000_000; i++) {
+        const p = new Point(i, i + 1);
+        const q = new Point(i + 2, i + 3);
+        sum += q.x - p.y;
+    }
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(sum);
+    print("Object NewObjects:\t"+String(time)+"\tms");
+}
+
+testEmptyObjectLiterals();
+testObjectLiterals();
+testArrayLiterals();
+testNewObjects();
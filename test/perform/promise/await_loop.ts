@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The nested await loops of test/aottest/await_loop, scaled up. Run it in the interpreter, with baseline and with
+// jit or aot; the awaits there take the fast path while no async stack trace is recorded.
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+}
+
+const OUTER = 1000;
+const INNER = 100;
+
+function bar() {
+}
+
+function bar2(): number {
+    return 1;
+}
+
+async function measure(name: string, test: () => Promise<number>) {
+    let start = ArkTools.timeInUs();
+    let result = await test();
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(result);
+    print("Await " + name + ":\t" + String(time) + "\tms");
+}
+
+// await of undefined and of numbers
+async function nestedLoop(): Promise<number> {
+    let sum = 0;
+    for (let i = 0; i < OUTER; ++i) {
+        await bar();
+        for (let j = 0; j < INNER; ++j) {
+            sum += await bar2();
+        }
+    }
+    return sum;
+}
+
+// await of a promise which is settled before the loop
+async function resolvedLoop(): Promise<number> {
+    let sum = 0;
+    let resolved = Promise.resolve(1);
+    for (let i = 0; i < OUTER * INNER; ++i) {
+        sum += await resolved;
+    }
+    return sum;
+}
+
+// await of a promise which is still pending, this takes the full protocol
+async function pendingLoop(): Promise<number> {
+    let sum = 0;
+    for (let i = 0; i < OUTER * INNER; ++i) {
+        sum += await Promise.resolve(0).then(() => 1);
+    }
+    return sum;
+}
+
+async function main() {
+    await measure("NestedLoop", nestedLoop);
+    await measure("ResolvedLoop", resolvedLoop);
+    await measure("PendingLoop", pendingLoop);
+}
+
+main();
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microtask throughput: every test queues a large number of promise jobs and reports the time until all of them
+// have run. The tests run one after another, each starts when the jobs of the previous one are drained.
+declare function print(arg:any) : string;
+declare interface ArkTools {
+    timeInUs(arg:any):number
+}
+
+const JOB_COUNT = 200_000;
+
+async function measure(name: string, test: () => Promise<number>) {
+    let start = ArkTools.timeInUs();
+    let result = await test();
+    let end = ArkTools.timeInUs();
+    let time = (end - start) / 1000
+    print(result);
+    print("Promise " + name + ":\t" + String(time) + "\tms");
+}
+
+// a chain of then callbacks, one reaction job per link
+function thenChain(): Promise<number> {
+    let p = Promise.resolve(0);
+    for (let i = 0; i < JOB_COUNT; i++) {
+        p = p.then((v: number) => v + 1);
+    }
+    return p;
+}
+
+// many reactions on one settled promise, all queued at once
+function fanOut(): Promise<number> {
+    let count = 0;
+    let resolved = Promise.resolve(1);
+    let all: Promise<void>[] = [];
+    for (let i = 0; i < JOB_COUNT; i++) {
+        all.push(resolved.then((v: number) => {
+            count += v;
+        }));
+    }
+    return Promise.all(all).then(() => count);
+}
+
+// await of plain values, one resumption of the async function per await
+async function awaitLoop(): Promise<number> {
+    let sum = 0;
+    for (let i = 0; i < JOB_COUNT; i++) {
+        sum += await i;
+    }
+    return sum;
+}
+
+// await of settled promises
+async function awaitResolved(): Promise<number> {
+    let sum = 0;
+    let resolved = Promise.resolve(2);
+    for (let i = 0; i < JOB_COUNT; i++) {
+        sum += await resolved;
+    }
+    return sum;
+}
+
+async function main() {
+    await measure("ThenChain", thenChain);
+    await measure("FanOut", fanOut);
+    await measure("AwaitLoop", awaitLoop);
+    await measure("AwaitResolved", awaitResolved);
+}
+
+main();